@@ -0,0 +1,88 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "delegate.h"
+
+using bench_delegate = delegate<uint32_t (uint32_t)>;
+
+class delegate_bench_base
+{
+public:
+	virtual ~delegate_bench_base() { }
+	virtual uint32_t virtual_func(uint32_t data) { return data + 1; }
+
+	uint32_t m_base_value = 0;
+};
+
+class delegate_bench_mixin
+{
+public:
+	virtual ~delegate_bench_mixin() { }
+	uint32_t mixin_func(uint32_t data) { return data ^ m_mixin_value; }
+
+	uint32_t m_mixin_value = 0x55;
+};
+
+// second base forces a non-zero "this" adjustment for mixin_func
+class delegate_bench : public delegate_bench_base, public delegate_bench_mixin
+{
+public:
+	uint32_t member_func(uint32_t data) { return data + m_value; }
+	virtual uint32_t virtual_func(uint32_t data) override { return data + m_value + 1; }
+	static uint32_t static_func(delegate_bench &object, uint32_t data) { return data + object.m_value; }
+
+	uint32_t m_value = 3;
+};
+
+template <typename Func>
+static void run_delegate(benchmark::State& state, Func const &func) {
+	uint32_t value = 0;
+	while (state.KeepRunning()) {
+		value = func(value);
+		benchmark::DoNotOptimize(value);
+	}
+}
+
+static void BM_delegate_member(benchmark::State& state) {
+	delegate_bench object;
+	bench_delegate func(&delegate_bench::member_func, &object);
+	run_delegate(state, func);
+}
+BENCHMARK(BM_delegate_member);
+
+static void BM_delegate_virtual(benchmark::State& state) {
+	delegate_bench object;
+	bench_delegate func(&delegate_bench::virtual_func, &object);
+	run_delegate(state, func);
+}
+BENCHMARK(BM_delegate_virtual);
+
+static void BM_delegate_second_base(benchmark::State& state) {
+	delegate_bench object;
+	bench_delegate func(&delegate_bench_mixin::mixin_func, static_cast<delegate_bench_mixin *>(&object));
+	run_delegate(state, func);
+}
+BENCHMARK(BM_delegate_second_base);
+
+static void BM_delegate_static(benchmark::State& state) {
+	delegate_bench object;
+	bench_delegate func(&delegate_bench::static_func, &object);
+	run_delegate(state, func);
+}
+BENCHMARK(BM_delegate_static);
+
+static void BM_delegate_functional(benchmark::State& state) {
+	delegate_bench object;
+	bench_delegate func([&object] (uint32_t data) { return object.member_func(data); });
+	run_delegate(state, func);
+}
+BENCHMARK(BM_delegate_functional);
+
+// baseline: the same virtual call made through std::function
+static void BM_std_function_virtual(benchmark::State& state) {
+	delegate_bench object;
+	delegate_bench_base *base = &object;
+	benchmark::DoNotOptimize(base);
+	std::function<uint32_t (uint32_t)> func([base] (uint32_t data) { return base->virtual_func(data); });
+	run_delegate(state, func);
+}
+BENCHMARK(BM_std_function_virtual);
@@ -0,0 +1,47 @@
+// Benchmarks for every eminline.h helper.  Included by eminline_native.cpp
+// and eminline_noasm.cpp, with EMINLINE_SUFFIX naming the implementation.
+
+#define EMINLINE_BM_NAME2(name, suffix) name##_##suffix
+#define EMINLINE_BM_NAME1(name, suffix) EMINLINE_BM_NAME2(name, suffix)
+#define EMINLINE_BM_NAME(name) EMINLINE_BM_NAME1(name, EMINLINE_SUFFIX)
+#define EMINLINE_BM_REGISTER(name) BENCHMARK(name)
+
+// the helper name is pasted straight away, as the x86 helpers are macros
+#define EMINLINE_BENCHMARK(name, expr) \
+	static void EMINLINE_BM_NAME(BM_##name)(benchmark::State& state) { \
+		uint32_t cnt = 0x332533; \
+		while (state.KeepRunning()) { \
+			benchmark::DoNotOptimize(expr); \
+			cnt = cnt * 1103515245 + 12345; \
+		} \
+	} \
+	EMINLINE_BM_REGISTER(EMINLINE_BM_NAME(BM_##name));
+
+// operands are chosen so that no quotient overflows 32 bits
+EMINLINE_BENCHMARK(mul_32x32, mul_32x32(int32_t(cnt), int32_t(cnt ^ 0x5a5a5a5a)))
+EMINLINE_BENCHMARK(mulu_32x32, mulu_32x32(cnt, cnt ^ 0x5a5a5a5a))
+EMINLINE_BENCHMARK(mul_32x32_hi, mul_32x32_hi(int32_t(cnt), int32_t(cnt ^ 0x5a5a5a5a)))
+EMINLINE_BENCHMARK(mulu_32x32_hi, mulu_32x32_hi(cnt, cnt ^ 0x5a5a5a5a))
+EMINLINE_BENCHMARK(mul_32x32_shift, mul_32x32_shift(int32_t(cnt), int32_t(cnt ^ 0x5a5a5a5a), 16))
+EMINLINE_BENCHMARK(mulu_32x32_shift, mulu_32x32_shift(cnt, cnt ^ 0x5a5a5a5a, 16))
+EMINLINE_BENCHMARK(div_64x32, div_64x32(int64_t(int32_t(cnt)) << 8, 0x10001))
+EMINLINE_BENCHMARK(divu_64x32, divu_64x32(uint64_t(cnt) << 8, 0x10001))
+EMINLINE_BENCHMARK(div_64x32_rem, [&cnt] { int32_t rem; int32_t quo = div_64x32_rem(int64_t(int32_t(cnt)) << 8, 0x10001, &rem); return quo + rem; }())
+EMINLINE_BENCHMARK(divu_64x32_rem, [&cnt] { uint32_t rem; uint32_t quo = divu_64x32_rem(uint64_t(cnt) << 8, 0x10001, &rem); return quo + rem; }())
+EMINLINE_BENCHMARK(div_32x32_shift, div_32x32_shift(int32_t(cnt >> 8), int32_t(cnt | 0x10000), 8))
+EMINLINE_BENCHMARK(divu_32x32_shift, divu_32x32_shift(cnt >> 8, cnt | 0x10000, 8))
+EMINLINE_BENCHMARK(mod_64x32, mod_64x32(int64_t(int32_t(cnt)) << 8, 0x10001))
+EMINLINE_BENCHMARK(modu_64x32, modu_64x32(uint64_t(cnt) << 8, 0x10001))
+EMINLINE_BENCHMARK(recip_approx, recip_approx(float(cnt | 1)))
+EMINLINE_BENCHMARK(mul_64x64, [&cnt] { int64_t hi; int64_t lo = mul_64x64(int64_t(cnt) * 0x9e3779b97f4a7c15LL, int64_t(cnt) << 31, &hi); return lo ^ hi; }())
+EMINLINE_BENCHMARK(mulu_64x64, [&cnt] { uint64_t hi; uint64_t lo = mulu_64x64(uint64_t(cnt) * 0x9e3779b97f4a7c15ULL, uint64_t(cnt) << 31, &hi); return lo ^ hi; }())
+EMINLINE_BENCHMARK(count_leading_zeros, count_leading_zeros(cnt >> (cnt & 31)))
+EMINLINE_BENCHMARK(count_leading_ones, count_leading_ones(~(cnt >> (cnt & 31))))
+EMINLINE_BENCHMARK(population_count_32, population_count_32(cnt))
+EMINLINE_BENCHMARK(population_count_64, population_count_64(uint64_t(cnt) * 0x9e3779b97f4a7c15ULL))
+
+#undef EMINLINE_BENCHMARK
+#undef EMINLINE_BM_REGISTER
+#undef EMINLINE_BM_NAME
+#undef EMINLINE_BM_NAME1
+#undef EMINLINE_BM_NAME2
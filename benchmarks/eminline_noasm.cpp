@@ -10,12 +10,5 @@ osd_ticks_t osd_ticks(void)
 }
 #include "eminline.h"
 
-static void BM_count_leading_zeros_noasm(benchmark::State& state) {
-	uint32_t cnt = 0x332533;
-	while (state.KeepRunning()) {
-		(void)count_leading_zeros(cnt);
-		cnt++;
-	}
-}
-// Register the function as a benchmark
-BENCHMARK(BM_count_leading_zeros_noasm);
+#define EMINLINE_SUFFIX noasm
+#include "eminline.ipp"
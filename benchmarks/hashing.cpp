@@ -0,0 +1,44 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "hashing.h"
+#include <vector>
+
+static std::vector<uint8_t> make_hash_buffer(int size) {
+	std::vector<uint8_t> buffer(size);
+	uint32_t seed = 0x332533;
+	for (uint8_t &b : buffer) {
+		seed = seed * 1103515245 + 12345;
+		b = seed >> 16;
+	}
+	return buffer;
+}
+
+static void BM_crc32(benchmark::State& state) {
+	const std::vector<uint8_t> buffer = make_hash_buffer(state.range(0));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::crc32_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_crc32)->Range(64, 1<<20);
+
+static void BM_crc16(benchmark::State& state) {
+	const std::vector<uint8_t> buffer = make_hash_buffer(state.range(0));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::crc16_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_crc16)->Range(64, 1<<20);
+
+static void BM_sha1(benchmark::State& state) {
+	const std::vector<uint8_t> buffer = make_hash_buffer(state.range(0));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::sha1_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_sha1)->Range(64, 1<<20);
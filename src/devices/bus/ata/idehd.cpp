@@ -821,7 +821,6 @@ void ide_hdd_device::device_start()
 
 void ide_hdd_device::device_reset()
 {
-	m_handle = m_image->get_chd_file();
 	m_disk = m_image->get_hard_disk_file();
 
 	if (m_disk != nullptr && !m_can_identify_device)
@@ -838,7 +837,7 @@ void ide_hdd_device::device_reset()
 
 		// build the features page
 		uint32_t metalength;
-		if (m_handle && m_handle->read_metadata (HARD_DISK_IDENT_METADATA_TAG, 0, &m_buffer[0], 512, metalength) == CHDERR_NONE)
+		if (hard_disk_read_metadata(m_disk, HARD_DISK_IDENT_METADATA_TAG, 0, &m_buffer[0], 512, metalength) == CHDERR_NONE)
 		{
 			for( int w = 0; w < 256; w++ )
 			{
@@ -45,9 +45,7 @@ void nscsi_harddisk_device::device_reset()
 		const hard_disk_info *hdinfo = hard_disk_get_info(harddisk);
 		bytes_per_sector = hdinfo->sectorbytes;
 
-		chd_file *chd = image->get_chd_file();
-		if(chd != nullptr)
-			chd->read_metadata(HARD_DISK_IDENT_METADATA_TAG, 0, m_inquiry_data);
+		hard_disk_read_metadata(harddisk, HARD_DISK_IDENT_METADATA_TAG, 0, m_inquiry_data);
 	}
 	cur_lba = -1;
 }
@@ -425,6 +425,16 @@ int arm7_cpu_device::detect_fault(int desc_lvl1, int ap, int flags)
 }
 
 
+void arm7_cpu_device::tlb_cache_flush()
+{
+	for (tlb_cache_entry &entry : m_tlb_cache)
+	{
+		entry.vpage = ~uint32_t(0);
+		entry.access = 0;
+	}
+}
+
+
 bool arm7_cpu_device::arm7_tlb_translate(offs_t &addr, int flags, bool no_exception)
 {
 	if (addr < 0x2000000)
@@ -432,6 +442,17 @@ bool arm7_cpu_device::arm7_tlb_translate(offs_t &addr, int flags, bool no_except
 		addr += m_pid_offset;
 	}
 
+	// reuse a recent translation if this kind of access has already been permitted
+	uint32_t const vpage = addr >> 10;
+	uint8_t const access = flags & (ARM7_TLB_READ | ARM7_TLB_WRITE);
+	bool const user = (m_r[eCPSR] & MODE_FLAG) == eARM7_MODE_USER;
+	tlb_cache_entry &cached = m_tlb_cache[vpage & (TLB_CACHE_ENTRIES - 1)];
+	if (access && (cached.vpage == vpage) && (cached.user == user) && ((cached.access & access) == access))
+	{
+		addr = cached.ppage | (addr & 0x3ff);
+		return true;
+	}
+
 	uint32_t desc_lvl1 = m_program->read_dword(m_tlb_base_mask | ((addr & COPRO_TLB_VADDR_FLTI_MASK) >> COPRO_TLB_VADDR_FLTI_MASK_SHIFT));
 
 #if ARM7_MMU_ENABLE_HACK
@@ -590,6 +611,19 @@ bool arm7_cpu_device::arm7_tlb_translate(offs_t &addr, int flags, bool no_except
 		}
 	}
 
+	// remember the translation for next time
+	if (access)
+	{
+		if ((cached.vpage != vpage) || (cached.user != user))
+		{
+			cached.vpage = vpage;
+			cached.user = user;
+			cached.access = 0;
+		}
+		cached.ppage = addr & ~0x3ff;
+		cached.access |= access;
+	}
+
 	return true;
 }
 
@@ -615,6 +649,7 @@ bool arm7_cpu_device::memory_translate(int spacenum, int intention, offs_t &addr
 void arm7_cpu_device::postload()
 {
 	update_reg_ptr();
+	tlb_cache_flush();
 }
 
 void arm7_cpu_device::device_start()
@@ -654,6 +689,7 @@ void arm7_cpu_device::device_start()
 	save_item(NAME(m_domainAccessControl));
 	save_item(NAME(m_decoded_access_control));
 	machine().save().register_postload(save_prepost_delegate(FUNC(arm7_cpu_device::postload), this));
+	tlb_cache_flush();
 
 	set_icountptr(m_icount);
 
@@ -777,6 +813,7 @@ void arm7_cpu_device::device_reset()
 	m_pid_offset = 0;
 	m_domainAccessControl = 0;
 	memset(m_decoded_access_control, 0, sizeof(uint8_t) * 16);
+	tlb_cache_flush();
 
 	/* start up in SVC mode with interrupts disabled. */
 	m_r[eCPSR] = I_MASK | F_MASK | 0x10;
@@ -1392,6 +1429,9 @@ WRITE32_MEMBER( arm7_cpu_device::arm7_rt_w_callback )
 		}
 	}
 
+	// any CP15 write may change translation or permissions
+	tlb_cache_flush();
+
 	switch (cReg)
 	{
 		case 0:
@@ -1817,6 +1857,7 @@ WRITE32_MEMBER( arm1176jzf_s_cpu_device::arm7_rt_w_callback )
 	if (cpnum == 15)
 	{
 		LOGMASKED(LOG_COPRO_WRITES, "arm7_rt_w_callback: CP15 CRn %02x Op1 %02x CRm %02x Op2 %02x data %08x\n", crn, op1, crm, op2, data);
+		tlb_cache_flush();
 		if(crn == 1 && op1 == 0 && crm == 0 && op2 == 0) m_control = data;
 	}
 }
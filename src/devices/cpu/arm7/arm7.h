@@ -179,6 +179,17 @@ protected:
 	uint32_t m_domainAccessControl;
 	uint8_t m_decoded_access_control[16];
 
+	/* recent successful MMU translations, one per 1KB virtual page; flushed on any CP15 write */
+	struct tlb_cache_entry
+	{
+		uint32_t vpage;             // virtual address >> 10, or ~0 if empty
+		uint32_t ppage;             // physical address of the page
+		uint8_t access;             // ARM7_TLB_READ/ARM7_TLB_WRITE accesses known to be permitted
+		bool user;                  // translation was made in user mode
+	};
+	static constexpr unsigned TLB_CACHE_ENTRIES = 256;
+	tlb_cache_entry m_tlb_cache[TLB_CACHE_ENTRIES];
+
 	uint8_t m_archRev;          // ARM architecture revision (3, 4, 5, and 6 are valid)
 	uint32_t m_archFlags;        // architecture flags
 
@@ -232,6 +243,7 @@ protected:
 
 	void set_cpsr(uint32_t val);
 	bool arm7_tlb_translate(offs_t &addr, int flags, bool no_exception = false);
+	void tlb_cache_flush();
 	uint32_t arm7_tlb_get_second_level_descriptor( uint32_t granularity, uint32_t first_desc, uint32_t vaddr );
 	int detect_fault(int desc_lvl1, int ap, int flags);
 	void arm7_check_irq_state();
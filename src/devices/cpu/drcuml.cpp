@@ -39,6 +39,7 @@
 #include "drcbex86.h"
 #include "drcbex64.h"
 
+#include <algorithm>
 #include <fstream>
 
 
@@ -75,6 +76,11 @@ struct bevalidate_test
 };
 
 
+#if VALIDATE_BACKEND
+static void validate_backend(drcuml_state &drcuml);
+#endif
+
+
 
 //**************************************************************************
 //  DRC BACKEND INTERFACE
@@ -143,10 +149,24 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_umllog(device.machine().options().drc_log_uml()
 			? new std::ofstream(util::string_format("drcuml_%s.asm", device.shortname()))
 			: nullptr)
+	, m_optimize_dataflow(device.machine().options().drc_optimize_uml())
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_persistent(*device.machine().options().drc_cache_directory() != 0)
+	, m_persistent_blocks()
+	, m_persistent_pending()
+	, m_persistent_key(0)
 {
+	// the cache is allocated up front, so account for all of it
+	device.machine().add_memory_usage(device, "drc", cache.size());
+
+	// reload the blocks compiled last time and arrange to save them on exit
+	if (m_persistent)
+	{
+		persistent_load();
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::persistent_save, this));
+	}
 }
 
 
@@ -180,15 +200,12 @@ void drcuml_state::reset()
 		m_beintf->reset();
 
 		// do a one-time validation if requested
-#if 0
-		if (VALIDATE_BACKEND)
+#if VALIDATE_BACKEND
+		static bool validated = false;
+		if (!validated)
 		{
-			static bool validated = false;
-			if (!validated)
-			{
-				validated = true;
-				validate_backend(this);
-			}
+			validated = true;
+			validate_backend(*this);
 		}
 #endif
 	}
@@ -273,6 +290,135 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  persistent_record - note a block compiled by
+//  the front-end so it can be recompiled early on
+//  the next run
+//-------------------------------------------------
+
+void drcuml_state::persistent_record(u32 mode, u32 pc, u32 crc)
+{
+	if (m_persistent)
+		m_persistent_blocks[std::make_pair(mode, pc)] = crc;
+}
+
+
+//-------------------------------------------------
+//  persistent_take - return the blocks loaded
+//  from the previous run so the front-end can
+//  recompile them; subsequent calls return
+//  nothing
+//-------------------------------------------------
+
+std::vector<drcuml_state::persistent_entry> drcuml_state::persistent_take()
+{
+	// keep them for the next run even if the front-end can't use them now
+	for (persistent_entry const &entry : m_persistent_pending)
+		m_persistent_blocks.emplace(std::make_pair(entry.mode, entry.pc), entry.crc);
+
+	std::vector<persistent_entry> result;
+	result.swap(m_persistent_pending);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  persistent_filename - return the name of the
+//  block list file for this device
+//-------------------------------------------------
+
+std::string drcuml_state::persistent_filename() const
+{
+	std::string tag(m_device.tag() + 1);
+	strreplace(tag, ":", "_");
+	return util::string_format("%s%s%s.drc", m_device.machine().basename(), PATH_SEPARATOR, tag);
+}
+
+
+//-------------------------------------------------
+//  persistent_key - compute a value identifying
+//  the loaded ROM contents and UML version
+//-------------------------------------------------
+
+u32 drcuml_state::persistent_key() const
+{
+	// regions are hashed in name order so the key is stable between runs
+	std::map<std::string, u32> regions;
+	for (auto const &region : m_device.machine().memory().regions())
+		regions.emplace(region.first, util::crc32_creator::simple(region.second->base(), region.second->bytes()));
+
+	util::crc32_creator crc;
+	u32 const version(little_endianize_int32(DRCUML_PERSISTENT_VERSION));
+	crc.append(&version, sizeof(version));
+	for (auto const &region : regions)
+	{
+		u32 const regioncrc(little_endianize_int32(region.second));
+		crc.append(region.first.c_str(), region.first.length());
+		crc.append(&regioncrc, sizeof(regioncrc));
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  persistent_load - read the list of blocks
+//  compiled on the previous run
+//-------------------------------------------------
+
+void drcuml_state::persistent_load()
+{
+	// hash the regions once, before anything modifies them at run time
+	m_persistent_key = persistent_key();
+
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_READ);
+	if (file.open(persistent_filename()) != osd_file::error::NONE)
+		return;
+
+	// the header must match our ROMs and UML version
+	u32 header[3];
+	if ((file.read(header, sizeof(header)) != sizeof(header)) ||
+			(little_endianize_int32(header[0]) != DRCUML_PERSISTENT_VERSION) ||
+			(little_endianize_int32(header[1]) != m_persistent_key))
+		return;
+
+	u32 const count(little_endianize_int32(header[2]));
+	for (u32 entrynum = 0; entrynum < count; entrynum++)
+	{
+		u32 entry[3];
+		if (file.read(entry, sizeof(entry)) != sizeof(entry))
+			break;
+		m_persistent_pending.emplace_back(persistent_entry{ little_endianize_int32(entry[0]), little_endianize_int32(entry[1]), little_endianize_int32(entry[2]) });
+	}
+}
+
+
+//-------------------------------------------------
+//  persistent_save - write the list of blocks
+//  compiled on this run
+//-------------------------------------------------
+
+void drcuml_state::persistent_save()
+{
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(persistent_filename()) != osd_file::error::NONE)
+		return;
+
+	u32 const header[3] = {
+			little_endianize_int32(DRCUML_PERSISTENT_VERSION),
+			little_endianize_int32(m_persistent_key),
+			little_endianize_int32(u32(m_persistent_blocks.size())) };
+	file.write(header, sizeof(header));
+	for (auto const &block : m_persistent_blocks)
+	{
+		u32 const entry[3] = {
+				little_endianize_int32(block.first.first),
+				little_endianize_int32(block.first.second),
+				little_endianize_int32(block.second) };
+		file.write(entry, sizeof(entry));
+	}
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -340,6 +486,8 @@ void drcuml_block::end()
 
 	// optimize the resulting code first
 	optimize();
+	if (m_drcuml.optimize_dataflow())
+		optimize_dataflow();
 
 	// if we have a logfile, generate a disassembly of the block
 	if (m_drcuml.logging())
@@ -431,6 +579,216 @@ void drcuml_block::optimize()
 }
 
 
+//-------------------------------------------------
+//  optimize_dataflow - propagate constants and
+//  memory values through integer registers and
+//  remove dead stores within straight-line runs
+//  of a block
+//-------------------------------------------------
+
+void drcuml_block::optimize_dataflow()
+{
+	optimize_dataflow(m_inst.data(), m_nextinst);
+}
+
+void drcuml_block::optimize_dataflow(uml::instruction *insts, int count)
+{
+	// what is known about the contents of an integer register
+	struct reg_value
+	{
+		enum { UNKNOWN, IMMEDIATE, MEMORY } kind = UNKNOWN;
+		u8 size = 0;
+		u64 value = 0;
+	};
+
+	// a store that has not yet been observed
+	struct pending_store
+	{
+		void *base;
+		u8 size;
+		uml::opcode_t opcode;
+		u32 instnum;
+	};
+
+	reg_value known[uml::REG_I_COUNT];
+	std::vector<pending_store> pending;
+
+	auto const forget_all = [&known, &pending] ()
+	{
+		for (reg_value &reg : known)
+			reg.kind = reg_value::UNKNOWN;
+		pending.clear();
+	};
+	auto const forget_memory = [&known] ()
+	{
+		for (reg_value &reg : known)
+			if (reg.kind == reg_value::MEMORY)
+				reg.kind = reg_value::UNKNOWN;
+	};
+
+	// iterate over instructions
+	for (int instnum = 0; instnum < count; instnum++)
+	{
+		uml::instruction &inst(insts[instnum]);
+
+		// substitute known constants for pure integer register inputs
+		bool substituted(false);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (param.is_int_register() && !inst.param_is_output(pnum) && inst.param_allows(pnum, uml::parameter::PTYPE_IMMEDIATE))
+			{
+				reg_value const &reg(known[param.ireg() - uml::REG_I0]);
+				if ((reg.kind == reg_value::IMMEDIATE) && (reg.size == inst.param_size(pnum)))
+				{
+					inst.set_immediate(pnum, reg.value);
+					substituted = true;
+				}
+			}
+		}
+		if (substituted)
+			inst.simplify();
+
+		// a register already holding the value being loaded makes the load redundant
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && inst.param(0).is_int_register() && inst.param(1).is_memory())
+		{
+			for (int regnum = 0; regnum < uml::REG_I_COUNT; regnum++)
+			{
+				reg_value const &reg(known[regnum]);
+				if ((reg.kind == reg_value::MEMORY) && (reg.size == inst.size()) && (reg.value == reinterpret_cast<uintptr_t>(inst.param(1).memory())))
+				{
+					uml::parameter const dst(inst.param(0));
+					if (dst.ireg() == (uml::REG_I0 + regnum))
+						inst.nop();
+					else if (inst.size() == 4)
+						inst.mov(dst, uml::parameter::make_ireg(uml::REG_I0 + regnum));
+					else
+						inst.dmov(dst, uml::parameter::make_ireg(uml::REG_I0 + regnum));
+					break;
+				}
+			}
+		}
+
+		switch (inst.opcode())
+		{
+		// anything that can be reached from elsewhere, leaves the block, or touches
+		// memory we can't see must invalidate everything
+		case uml::OP_HANDLE:
+		case uml::OP_HASH:
+		case uml::OP_LABEL:
+		case uml::OP_DEBUG:
+		case uml::OP_EXIT:
+		case uml::OP_HASHJMP:
+		case uml::OP_JMP:
+		case uml::OP_EXH:
+		case uml::OP_CALLH:
+		case uml::OP_RET:
+		case uml::OP_CALLC:
+		case uml::OP_RECOVER:
+		case uml::OP_SAVE:
+		case uml::OP_RESTORE:
+		case uml::OP_LOAD:
+		case uml::OP_LOADS:
+		case uml::OP_STORE:
+		case uml::OP_READ:
+		case uml::OP_READM:
+		case uml::OP_WRITE:
+		case uml::OP_WRITEM:
+		case uml::OP_FLOAD:
+		case uml::OP_FSTORE:
+		case uml::OP_FREAD:
+		case uml::OP_FWRITE:
+			forget_all();
+			continue;
+
+		default:
+			break;
+		}
+
+		// reading any memory operand may observe a pending store
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_memory() && inst.param_is_input(pnum))
+				pending.clear();
+
+		// an unconditional move to memory makes an earlier identical store dead
+		if (((inst.opcode() == uml::OP_MOV) || (inst.opcode() == uml::OP_FMOV)) && (inst.condition() == uml::COND_ALWAYS) && inst.param(0).is_memory())
+		{
+			void *const base(inst.param(0).memory());
+			auto const found(std::find_if(
+					pending.begin(),
+					pending.end(),
+					[base] (pending_store const &store) { return store.base == base; }));
+			if (found != pending.end())
+			{
+				if ((found->size == inst.size()) && (found->opcode == inst.opcode()))
+					insts[found->instnum].nop();
+				*found = pending_store{ base, inst.size(), inst.opcode(), u32(instnum) };
+			}
+			else
+			{
+				pending.emplace_back(pending_store{ base, inst.size(), inst.opcode(), u32(instnum) });
+			}
+		}
+
+		// forget whatever the instruction overwrites
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (inst.param_is_output(pnum))
+			{
+				uml::parameter const &param(inst.param(pnum));
+				if (param.is_int_register())
+					known[param.ireg() - uml::REG_I0].kind = reg_value::UNKNOWN;
+				else if (param.is_memory())
+					forget_memory();
+			}
+		}
+
+		// finally, remember what an unconditional move leaves behind
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS))
+		{
+			uml::parameter const &dst(inst.param(0));
+			uml::parameter const &src(inst.param(1));
+			if (dst.is_int_register())
+			{
+				reg_value &reg(known[dst.ireg() - uml::REG_I0]);
+				if (src.is_immediate())
+				{
+					reg.kind = reg_value::IMMEDIATE;
+					reg.size = inst.size();
+					reg.value = (inst.size() == 4) ? u32(src.immediate()) : src.immediate();
+				}
+				else if (src.is_memory())
+				{
+					reg.kind = reg_value::MEMORY;
+					reg.size = inst.size();
+					reg.value = reinterpret_cast<uintptr_t>(src.memory());
+				}
+				else if (src.is_int_register())
+				{
+					// a 4-byte move only defines the low half, so a wider value is
+					// truncated and a narrower one leaves the upper half unknown
+					reg_value const &from(known[src.ireg() - uml::REG_I0]);
+					if (from.size == inst.size())
+						reg = from;
+					else if ((from.kind == reg_value::IMMEDIATE) && (inst.size() == 4))
+						reg = reg_value{ reg_value::IMMEDIATE, 4, u32(from.value) };
+				}
+			}
+			else if (dst.is_memory() && src.is_int_register())
+			{
+				reg_value &reg(known[src.ireg() - uml::REG_I0]);
+				if (reg.kind == reg_value::UNKNOWN)
+				{
+					reg.kind = reg_value::MEMORY;
+					reg.size = inst.size();
+					reg.value = reinterpret_cast<uintptr_t>(dst.memory());
+				}
+			}
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  disassemble - disassemble a block of
 //  instructions to the log
@@ -524,603 +882,510 @@ char const *drcuml_block::get_comment_text(uml::instruction const &inst, std::st
 
 
 
-#if 0
+#if VALIDATE_BACKEND
 
-/***************************************************************************
-    BACK-END VALIDATION
-***************************************************************************/
+//**************************************************************************
+//  BACK-END VALIDATION
+//**************************************************************************
 
-//-------------------------------------------------
-//  effective_test_psize - return the effective
-//  parameter size based on the size and fixed
-//  array of parameter values
-//-------------------------------------------------
+// marks an expected result that the test does not check
+constexpr u64 BEVALIDATE_UNDEFINED = 0xcdcdcdcdcdcdcdcdU;
 
-inline uint8_t effective_test_psize(const opcode_info &opinfo, int pnum, int instsize, const uint64_t *params)
+// type and register index chosen for one parameter of a test
+struct bevalidate_param
 {
-	switch (opinfo.param[pnum].size)
-	{
-		case PSIZE_4:   return 4;
-		case PSIZE_8:   return 8;
-		case PSIZE_OP:  return instsize;
-		case PSIZE_P1:  return 1 << (params[0] & 3);
-		case PSIZE_P2:  return 1 << (params[1] & 3);
-		case PSIZE_P3:  return 1 << (params[2] & 3);
-		case PSIZE_P4:  return 1 << (params[3] & 3);
-	}
-	return instsize;
-}
+	uml::parameter::parameter_type  type;
+	int                             index;
+};
 
-#define TEST_ENTRY_2(op, size, p1, p2, flags) { OP_##op, size, 0, flags, { u64(p1), u64(p2) } },
-#define TEST_ENTRY_2F(op, size, p1, p2, iflags, flags) { OP_##op, size, iflags, flags, { u64(p1), u64(p2) } },
-#define TEST_ENTRY_3(op, size, p1, p2, p3, flags) { OP_##op, size, 0, flags, { u64(p1), u64(p2), u64(p3) } },
-#define TEST_ENTRY_3F(op, size, p1, p2, p3, iflags, flags) { OP_##op, size, iflags, flags, { u64(p1), u64(p2), u64(p3) } },
-#define TEST_ENTRY_4(op, size, p1, p2, p3, p4, flags) { OP_##op, size, 0, flags, { u64(p1), u64(p2), u64(p3), u64(p4) } },
-#define TEST_ENTRY_4F(op, size, p1, p2, p3, p4, iflags, flags) { OP_##op, size, iflags, flags, { u64(p1), u64(p2), u64(p3), u64(p4) } },
+// shared state for a validation run
+struct bevalidate_context
+{
+	drcuml_state &                  drcuml;
+	uml::code_handle *              handles[3];
+	u32                             executed;
+	osd_ticks_t                     ticks;
+};
+
+#define TEST_ENTRY_2(op, size, p1, p2, flags) { uml::OP_##op, size, 0, flags, { u64(p1), u64(p2) } },
+#define TEST_ENTRY_2F(op, size, p1, p2, iflags, flags) { uml::OP_##op, size, iflags, flags, { u64(p1), u64(p2) } },
+#define TEST_ENTRY_3(op, size, p1, p2, p3, flags) { uml::OP_##op, size, 0, flags, { u64(p1), u64(p2), u64(p3) } },
+#define TEST_ENTRY_3F(op, size, p1, p2, p3, iflags, flags) { uml::OP_##op, size, iflags, flags, { u64(p1), u64(p2), u64(p3) } },
+#define TEST_ENTRY_4(op, size, p1, p2, p3, p4, flags) { uml::OP_##op, size, 0, flags, { u64(p1), u64(p2), u64(p3), u64(p4) } },
+#define TEST_ENTRY_4F(op, size, p1, p2, p3, p4, iflags, flags) { uml::OP_##op, size, iflags, flags, { u64(p1), u64(p2), u64(p3), u64(p4) } },
 
 static const bevalidate_test bevalidate_test_list[] =
 {
 	TEST_ENTRY_3(ADD, 4, 0x7fffffff, 0x12345678, 0x6dcba987, 0)
-	TEST_ENTRY_3(ADD, 4, 0x80000000, 0x12345678, 0x6dcba988, FLAG_V | FLAG_S)
-	TEST_ENTRY_3(ADD, 4, 0xffffffff, 0x92345678, 0x6dcba987, FLAG_S)
-	TEST_ENTRY_3(ADD, 4, 0x00000000, 0x92345678, 0x6dcba988, FLAG_C | FLAG_Z)
+	TEST_ENTRY_3(ADD, 4, 0x80000000, 0x12345678, 0x6dcba988, uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3(ADD, 4, 0xffffffff, 0x92345678, 0x6dcba987, uml::FLAG_S)
+	TEST_ENTRY_3(ADD, 4, 0x00000000, 0x92345678, 0x6dcba988, uml::FLAG_C | uml::FLAG_Z)
 
 	TEST_ENTRY_3(ADD, 8, 0x7fffffffffffffff, 0x0123456789abcdef, 0x7edcba9876543210, 0)
-	TEST_ENTRY_3(ADD, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543211, FLAG_V | FLAG_S)
-	TEST_ENTRY_3(ADD, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba9876543210, FLAG_S)
-	TEST_ENTRY_3(ADD, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543211, FLAG_C | FLAG_Z)
+	TEST_ENTRY_3(ADD, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543211, uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3(ADD, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba9876543210, uml::FLAG_S)
+	TEST_ENTRY_3(ADD, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543211, uml::FLAG_C | uml::FLAG_Z)
 
 	TEST_ENTRY_3F(ADDC, 4, 0x7fffffff, 0x12345678, 0x6dcba987, 0,       0)
-	TEST_ENTRY_3F(ADDC, 4, 0x7fffffff, 0x12345678, 0x6dcba986, FLAG_C, 0)
-	TEST_ENTRY_3F(ADDC, 4, 0x80000000, 0x12345678, 0x6dcba988, 0,             FLAG_V | FLAG_S)
-	TEST_ENTRY_3F(ADDC, 4, 0x80000000, 0x12345678, 0x6dcba987, FLAG_C, FLAG_V | FLAG_S)
-	TEST_ENTRY_3F(ADDC, 4, 0xffffffff, 0x92345678, 0x6dcba987, 0,             FLAG_S)
-	TEST_ENTRY_3F(ADDC, 4, 0xffffffff, 0x92345678, 0x6dcba986, FLAG_C, FLAG_S)
-	TEST_ENTRY_3F(ADDC, 4, 0x00000000, 0x92345678, 0x6dcba988, 0,             FLAG_C | FLAG_Z)
-	TEST_ENTRY_3F(ADDC, 4, 0x00000000, 0x92345678, 0x6dcba987, FLAG_C, FLAG_C | FLAG_Z)
-	TEST_ENTRY_3F(ADDC, 4, 0x12345678, 0x12345678, 0xffffffff, FLAG_C, FLAG_C)
+	TEST_ENTRY_3F(ADDC, 4, 0x7fffffff, 0x12345678, 0x6dcba986, uml::FLAG_C, 0)
+	TEST_ENTRY_3F(ADDC, 4, 0x80000000, 0x12345678, 0x6dcba988, 0,             uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 4, 0x80000000, 0x12345678, 0x6dcba987, uml::FLAG_C, uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 4, 0xffffffff, 0x92345678, 0x6dcba987, 0,             uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 4, 0xffffffff, 0x92345678, 0x6dcba986, uml::FLAG_C, uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 4, 0x00000000, 0x92345678, 0x6dcba988, 0,             uml::FLAG_C | uml::FLAG_Z)
+	TEST_ENTRY_3F(ADDC, 4, 0x00000000, 0x92345678, 0x6dcba987, uml::FLAG_C, uml::FLAG_C | uml::FLAG_Z)
+	TEST_ENTRY_3F(ADDC, 4, 0x12345678, 0x12345678, 0xffffffff, uml::FLAG_C, uml::FLAG_C)
 
 	TEST_ENTRY_3F(ADDC, 8, 0x7fffffffffffffff, 0x0123456789abcdef, 0x7edcba9876543210, 0,             0)
-	TEST_ENTRY_3F(ADDC, 8, 0x7fffffffffffffff, 0x0123456789abcdef, 0x7edcba987654320f, FLAG_C, 0)
-	TEST_ENTRY_3F(ADDC, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543211, 0,             FLAG_V | FLAG_S)
-	TEST_ENTRY_3F(ADDC, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543210, FLAG_C, FLAG_V | FLAG_S)
-	TEST_ENTRY_3F(ADDC, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba9876543210, 0,             FLAG_S)
-	TEST_ENTRY_3F(ADDC, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba987654320f, FLAG_C, FLAG_S)
-	TEST_ENTRY_3F(ADDC, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543211, 0,             FLAG_C | FLAG_Z)
-	TEST_ENTRY_3F(ADDC, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543210, FLAG_C, FLAG_C | FLAG_Z)
-	TEST_ENTRY_3F(ADDC, 8, 0x123456789abcdef0, 0x123456789abcdef0, 0xffffffffffffffff, FLAG_C, FLAG_C)
+	TEST_ENTRY_3F(ADDC, 8, 0x7fffffffffffffff, 0x0123456789abcdef, 0x7edcba987654320f, uml::FLAG_C, 0)
+	TEST_ENTRY_3F(ADDC, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543211, 0,             uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 8, 0x8000000000000000, 0x0123456789abcdef, 0x7edcba9876543210, uml::FLAG_C, uml::FLAG_V | uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba9876543210, 0,             uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 8, 0xffffffffffffffff, 0x8123456789abcdef, 0x7edcba987654320f, uml::FLAG_C, uml::FLAG_S)
+	TEST_ENTRY_3F(ADDC, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543211, 0,             uml::FLAG_C | uml::FLAG_Z)
+	TEST_ENTRY_3F(ADDC, 8, 0x0000000000000000, 0x8123456789abcdef, 0x7edcba9876543210, uml::FLAG_C, uml::FLAG_C | uml::FLAG_Z)
+	TEST_ENTRY_3F(ADDC, 8, 0x123456789abcdef0, 0x123456789abcdef0, 0xffffffffffffffff, uml::FLAG_C, uml::FLAG_C)
 
 	TEST_ENTRY_3(SUB, 4, 0x12345678, 0x7fffffff, 0x6dcba987, 0)
-	TEST_ENTRY_3(SUB, 4, 0x12345678, 0x80000000, 0x6dcba988, FLAG_V)
-	TEST_ENTRY_3(SUB, 4, 0x92345678, 0xffffffff, 0x6dcba987, FLAG_S)
-	TEST_ENTRY_3(SUB, 4, 0x92345678, 0x00000000, 0x6dcba988, FLAG_C | FLAG_S)
-	TEST_ENTRY_3(SUB, 4, 0x00000000, 0x12345678, 0x12345678, FLAG_Z)
+	TEST_ENTRY_3(SUB, 4, 0x12345678, 0x80000000, 0x6dcba988, uml::FLAG_V)
+	TEST_ENTRY_3(SUB, 4, 0x92345678, 0xffffffff, 0x6dcba987, uml::FLAG_S)
+	TEST_ENTRY_3(SUB, 4, 0x92345678, 0x00000000, 0x6dcba988, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3(SUB, 4, 0x00000000, 0x12345678, 0x12345678, uml::FLAG_Z)
 
 	TEST_ENTRY_3(SUB, 8, 0x0123456789abcdef, 0x7fffffffffffffff, 0x7edcba9876543210, 0)
-	TEST_ENTRY_3(SUB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543211, FLAG_V)
-	TEST_ENTRY_3(SUB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba9876543210, FLAG_S)
-	TEST_ENTRY_3(SUB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543211, FLAG_C | FLAG_S)
-	TEST_ENTRY_3(SUB, 8, 0x0000000000000000, 0x0123456789abcdef, 0x0123456789abcdef, FLAG_Z)
+	TEST_ENTRY_3(SUB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543211, uml::FLAG_V)
+	TEST_ENTRY_3(SUB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba9876543210, uml::FLAG_S)
+	TEST_ENTRY_3(SUB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543211, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3(SUB, 8, 0x0000000000000000, 0x0123456789abcdef, 0x0123456789abcdef, uml::FLAG_Z)
 
 	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x7fffffff, 0x6dcba987, 0,             0)
-	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x7fffffff, 0x6dcba986, FLAG_C, 0)
-	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x80000000, 0x6dcba988, 0,             FLAG_V)
-	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x80000000, 0x6dcba987, FLAG_C, FLAG_V)
-	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0xffffffff, 0x6dcba987, 0,             FLAG_S)
-	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0xffffffff, 0x6dcba986, FLAG_C, FLAG_S)
-	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0x00000000, 0x6dcba988, 0,             FLAG_C | FLAG_S)
-	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0x00000000, 0x6dcba987, FLAG_C, FLAG_C | FLAG_S)
-	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x12345678, 0xffffffff, FLAG_C, FLAG_C)
-	TEST_ENTRY_3F(SUBB, 4, 0x00000000, 0x12345678, 0x12345677, FLAG_C, FLAG_Z)
+	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x7fffffff, 0x6dcba986, uml::FLAG_C, 0)
+	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x80000000, 0x6dcba988, 0,             uml::FLAG_V)
+	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x80000000, 0x6dcba987, uml::FLAG_C, uml::FLAG_V)
+	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0xffffffff, 0x6dcba987, 0,             uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0xffffffff, 0x6dcba986, uml::FLAG_C, uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0x00000000, 0x6dcba988, 0,             uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 4, 0x92345678, 0x00000000, 0x6dcba987, uml::FLAG_C, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 4, 0x12345678, 0x12345678, 0xffffffff, uml::FLAG_C, uml::FLAG_C)
+	TEST_ENTRY_3F(SUBB, 4, 0x00000000, 0x12345678, 0x12345677, uml::FLAG_C, uml::FLAG_Z)
 
 	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x7fffffffffffffff, 0x7edcba9876543210, 0,             0)
-	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x7fffffffffffffff, 0x7edcba987654320f, FLAG_C, 0)
-	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543211, 0,             FLAG_V)
-	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543210, FLAG_C, FLAG_V)
-	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba9876543210, 0,             FLAG_S)
-	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba987654320f, FLAG_C, FLAG_S)
-	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543211, 0,             FLAG_C | FLAG_S)
-	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543210, FLAG_C, FLAG_C | FLAG_S)
-	TEST_ENTRY_3F(SUBB, 8, 0x123456789abcdef0, 0x123456789abcdef0, 0xffffffffffffffff, FLAG_C, FLAG_C)
-	TEST_ENTRY_3F(SUBB, 8, 0x0000000000000000, 0x123456789abcdef0, 0x123456789abcdeef, FLAG_C, FLAG_Z)
+	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x7fffffffffffffff, 0x7edcba987654320f, uml::FLAG_C, 0)
+	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543211, 0,             uml::FLAG_V)
+	TEST_ENTRY_3F(SUBB, 8, 0x0123456789abcdef, 0x8000000000000000, 0x7edcba9876543210, uml::FLAG_C, uml::FLAG_V)
+	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba9876543210, 0,             uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0xffffffffffffffff, 0x7edcba987654320f, uml::FLAG_C, uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543211, 0,             uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 8, 0x8123456789abcdef, 0x0000000000000000, 0x7edcba9876543210, uml::FLAG_C, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_3F(SUBB, 8, 0x123456789abcdef0, 0x123456789abcdef0, 0xffffffffffffffff, uml::FLAG_C, uml::FLAG_C)
+	TEST_ENTRY_3F(SUBB, 8, 0x0000000000000000, 0x123456789abcdef0, 0x123456789abcdeef, uml::FLAG_C, uml::FLAG_Z)
 
 	TEST_ENTRY_2(CMP, 4, 0x7fffffff, 0x6dcba987, 0)
-	TEST_ENTRY_2(CMP, 4, 0x80000000, 0x6dcba988, FLAG_V)
-	TEST_ENTRY_2(CMP, 4, 0xffffffff, 0x6dcba987, FLAG_S)
-	TEST_ENTRY_2(CMP, 4, 0x00000000, 0x6dcba988, FLAG_C | FLAG_S)
-	TEST_ENTRY_2(CMP, 4, 0x12345678, 0x12345678, FLAG_Z)
+	TEST_ENTRY_2(CMP, 4, 0x80000000, 0x6dcba988, uml::FLAG_V)
+	TEST_ENTRY_2(CMP, 4, 0xffffffff, 0x6dcba987, uml::FLAG_S)
+	TEST_ENTRY_2(CMP, 4, 0x00000000, 0x6dcba988, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_2(CMP, 4, 0x12345678, 0x12345678, uml::FLAG_Z)
 
 	TEST_ENTRY_2(CMP, 8, 0x7fffffffffffffff, 0x7edcba9876543210, 0)
-	TEST_ENTRY_2(CMP, 8, 0x8000000000000000, 0x7edcba9876543211, FLAG_V)
-	TEST_ENTRY_2(CMP, 8, 0xffffffffffffffff, 0x7edcba9876543210, FLAG_S)
-	TEST_ENTRY_2(CMP, 8, 0x0000000000000000, 0x7edcba9876543211, FLAG_C | FLAG_S)
-	TEST_ENTRY_2(CMP, 8, 0x0123456789abcdef, 0x0123456789abcdef, FLAG_Z)
+	TEST_ENTRY_2(CMP, 8, 0x8000000000000000, 0x7edcba9876543211, uml::FLAG_V)
+	TEST_ENTRY_2(CMP, 8, 0xffffffffffffffff, 0x7edcba9876543210, uml::FLAG_S)
+	TEST_ENTRY_2(CMP, 8, 0x0000000000000000, 0x7edcba9876543211, uml::FLAG_C | uml::FLAG_S)
+	TEST_ENTRY_2(CMP, 8, 0x0123456789abcdef, 0x0123456789abcdef, uml::FLAG_Z)
 
 	TEST_ENTRY_4(MULU, 4, 0x77777777, 0x00000000, 0x11111111, 0x00000007, 0)
 	TEST_ENTRY_4(MULU, 4, 0xffffffff, 0x00000000, 0x11111111, 0x0000000f, 0)
-	TEST_ENTRY_4(MULU, 4, 0x00000000, 0x00000000, 0x11111111, 0x00000000, FLAG_Z)
-	TEST_ENTRY_4(MULU, 4, 0xea61d951, 0x37c048d0, 0x77777777, 0x77777777, FLAG_V)
-	TEST_ENTRY_4(MULU, 4, 0x32323233, 0xcdcdcdcc, 0xcdcdcdcd, 0xffffffff, FLAG_V | FLAG_S)
+	TEST_ENTRY_4(MULU, 4, 0x00000000, 0x00000000, 0x11111111, 0x00000000, uml::FLAG_Z)
+	TEST_ENTRY_4(MULU, 4, 0xea61d951, 0x37c048d0, 0x77777777, 0x77777777, uml::FLAG_V)
+	TEST_ENTRY_4(MULU, 4, 0x32323233, 0xcdcdcdcc, 0xcdcdcdcd, 0xffffffff, uml::FLAG_V | uml::FLAG_S)
 
 	TEST_ENTRY_4(MULU, 8, 0x7777777777777777, 0x0000000000000000, 0x1111111111111111, 0x0000000000000007, 0)
 	TEST_ENTRY_4(MULU, 8, 0xffffffffffffffff, 0x0000000000000000, 0x1111111111111111, 0x000000000000000f, 0)
-	TEST_ENTRY_4(MULU, 8, 0x0000000000000000, 0x0000000000000000, 0x1111111111111111, 0x0000000000000000, FLAG_Z)
-	TEST_ENTRY_4(MULU, 8, 0x0c83fb72ea61d951, 0x37c048d159e26af3, 0x7777777777777777, 0x7777777777777777, FLAG_V)
-	TEST_ENTRY_4(MULU, 8, 0x3232323232323233, 0xcdcdcdcdcdcdcdcc, 0xcdcdcdcdcdcdcdcd, 0xffffffffffffffff, FLAG_V | FLAG_S)
+	TEST_ENTRY_4(MULU, 8, 0x0000000000000000, 0x0000000000000000, 0x1111111111111111, 0x0000000000000000, uml::FLAG_Z)
+	TEST_ENTRY_4(MULU, 8, 0x0c83fb72ea61d951, 0x37c048d159e26af3, 0x7777777777777777, 0x7777777777777777, uml::FLAG_V)
+	TEST_ENTRY_4(MULU, 8, 0x3232323232323233, 0xcdcdcdcdcdcdcdcc, 0xcdcdcdcdcdcdcdcd, 0xffffffffffffffff, uml::FLAG_V | uml::FLAG_S)
 
 	TEST_ENTRY_4(MULS, 4, 0x77777777, 0x00000000, 0x11111111, 0x00000007, 0)
-	TEST_ENTRY_4(MULS, 4, 0xffffffff, 0x00000000, 0x11111111, 0x0000000f, FLAG_V)
-	TEST_ENTRY_4(MULS, 4, 0x00000000, 0x00000000, 0x11111111, 0x00000000, FLAG_Z)
-	TEST_ENTRY_4(MULS, 4, 0x9e26af38, 0xc83fb72e, 0x77777777, 0x88888888, FLAG_V | FLAG_S)
+	TEST_ENTRY_4(MULS, 4, 0xffffffff, 0x00000000, 0x11111111, 0x0000000f, uml::FLAG_V)
+	TEST_ENTRY_4(MULS, 4, 0x00000000, 0x00000000, 0x11111111, 0x00000000, uml::FLAG_Z)
+	TEST_ENTRY_4(MULS, 4, 0x9e26af38, 0xc83fb72e, 0x77777777, 0x88888888, uml::FLAG_V | uml::FLAG_S)
 	TEST_ENTRY_4(MULS, 4, 0x32323233, 0x00000000, 0xcdcdcdcd, 0xffffffff, 0)
 
 	TEST_ENTRY_4(MULS, 8, 0x7777777777777777, 0x0000000000000000, 0x1111111111111111, 0x0000000000000007, 0)
-	TEST_ENTRY_4(MULS, 8, 0xffffffffffffffff, 0x0000000000000000, 0x1111111111111111, 0x000000000000000f, FLAG_V)
-	TEST_ENTRY_4(MULS, 8, 0x0000000000000000, 0x0000000000000000, 0x1111111111111111, 0x0000000000000000, FLAG_Z)
-	TEST_ENTRY_4(MULS, 8, 0x7c048d159e26af38, 0xc83fb72ea61d950c, 0x7777777777777777, 0x8888888888888888, FLAG_V | FLAG_S)
+	TEST_ENTRY_4(MULS, 8, 0xffffffffffffffff, 0x0000000000000000, 0x1111111111111111, 0x000000000000000f, uml::FLAG_V)
+	TEST_ENTRY_4(MULS, 8, 0x0000000000000000, 0x0000000000000000, 0x1111111111111111, 0x0000000000000000, uml::FLAG_Z)
+	TEST_ENTRY_4(MULS, 8, 0x7c048d159e26af38, 0xc83fb72ea61d950c, 0x7777777777777777, 0x8888888888888888, uml::FLAG_V | uml::FLAG_S)
 	TEST_ENTRY_4(MULS, 8, 0x3232323232323233, 0x0000000000000000, 0xcdcdcdcdcdcdcdcd, 0xffffffffffffffff, 0)
 
 	TEST_ENTRY_4(DIVU, 4, 0x02702702, 0x00000003, 0x11111111, 0x00000007, 0)
-	TEST_ENTRY_4(DIVU, 4, 0x00000000, 0x11111111, 0x11111111, 0x11111112, FLAG_Z)
+	TEST_ENTRY_4(DIVU, 4, 0x00000000, 0x11111111, 0x11111111, 0x11111112, uml::FLAG_Z)
 	TEST_ENTRY_4(DIVU, 4, 0x7fffffff, 0x00000000, 0xfffffffe, 0x00000002, 0)
-	TEST_ENTRY_4(DIVU, 4, 0xfffffffe, 0x00000000, 0xfffffffe, 0x00000001, FLAG_S)
-	TEST_ENTRY_4(DIVU, 4, UNDEFINED,  UNDEFINED,  0xffffffff, 0x00000000, FLAG_V)
+	TEST_ENTRY_4(DIVU, 4, 0xfffffffe, 0x00000000, 0xfffffffe, 0x00000001, uml::FLAG_S)
+	TEST_ENTRY_4(DIVU, 4, BEVALIDATE_UNDEFINED,  BEVALIDATE_UNDEFINED,  0xffffffff, 0x00000000, uml::FLAG_V)
 
 	TEST_ENTRY_4(DIVU, 8, 0x0270270270270270, 0x0000000000000001, 0x1111111111111111, 0x0000000000000007, 0)
-	TEST_ENTRY_4(DIVU, 8, 0x0000000000000000, 0x1111111111111111, 0x1111111111111111, 0x1111111111111112, FLAG_Z)
+	TEST_ENTRY_4(DIVU, 8, 0x0000000000000000, 0x1111111111111111, 0x1111111111111111, 0x1111111111111112, uml::FLAG_Z)
 	TEST_ENTRY_4(DIVU, 8, 0x7fffffffffffffff, 0x0000000000000000, 0xfffffffffffffffe, 0x0000000000000002, 0)
-	TEST_ENTRY_4(DIVU, 8, 0xfffffffffffffffe, 0x0000000000000000, 0xfffffffffffffffe, 0x0000000000000001, FLAG_S)
-	TEST_ENTRY_4(DIVU, 8, UNDEFINED,          UNDEFINED,          0xffffffffffffffff, 0x0000000000000000, FLAG_V)
+	TEST_ENTRY_4(DIVU, 8, 0xfffffffffffffffe, 0x0000000000000000, 0xfffffffffffffffe, 0x0000000000000001, uml::FLAG_S)
+	TEST_ENTRY_4(DIVU, 8, BEVALIDATE_UNDEFINED,          BEVALIDATE_UNDEFINED,          0xffffffffffffffff, 0x0000000000000000, uml::FLAG_V)
 
 	TEST_ENTRY_4(DIVS, 4, 0x02702702, 0x00000003, 0x11111111, 0x00000007, 0)
-	TEST_ENTRY_4(DIVS, 4, 0x00000000, 0x11111111, 0x11111111, 0x11111112, FLAG_Z)
-	TEST_ENTRY_4(DIVS, 4, 0xffffffff, 0x00000000, 0xfffffffe, 0x00000002, FLAG_S)
-	TEST_ENTRY_4(DIVS, 4, UNDEFINED,  UNDEFINED,  0xffffffff, 0x00000000, FLAG_V)
+	TEST_ENTRY_4(DIVS, 4, 0x00000000, 0x11111111, 0x11111111, 0x11111112, uml::FLAG_Z)
+	TEST_ENTRY_4(DIVS, 4, 0xffffffff, 0x00000000, 0xfffffffe, 0x00000002, uml::FLAG_S)
+	TEST_ENTRY_4(DIVS, 4, BEVALIDATE_UNDEFINED,  BEVALIDATE_UNDEFINED,  0xffffffff, 0x00000000, uml::FLAG_V)
 
 	TEST_ENTRY_4(DIVS, 8, 0x0270270270270270, 0x0000000000000001, 0x1111111111111111, 0x0000000000000007, 0)
-	TEST_ENTRY_4(DIVS, 8, 0x0000000000000000, 0x1111111111111111, 0x1111111111111111, 0x1111111111111112, FLAG_Z)
-	TEST_ENTRY_4(DIVS, 8, 0xffffffffffffffff, 0x0000000000000000, 0xfffffffffffffffe, 0x0000000000000002, FLAG_S)
-	TEST_ENTRY_4(DIVS, 8, UNDEFINED,          UNDEFINED,          0xffffffffffffffff, 0x0000000000000000, FLAG_V)
+	TEST_ENTRY_4(DIVS, 8, 0x0000000000000000, 0x1111111111111111, 0x1111111111111111, 0x1111111111111112, uml::FLAG_Z)
+	TEST_ENTRY_4(DIVS, 8, 0xffffffffffffffff, 0x0000000000000000, 0xfffffffffffffffe, 0x0000000000000002, uml::FLAG_S)
+	TEST_ENTRY_4(DIVS, 8, BEVALIDATE_UNDEFINED,          BEVALIDATE_UNDEFINED,          0xffffffffffffffff, 0x0000000000000000, uml::FLAG_V)
 };
 
 
-/*-------------------------------------------------
-    validate_backend - execute a number of
-    generic tests on the backend code generator
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_psize - return the effective size
+//  of a test parameter
+//-------------------------------------------------
 
-static void validate_backend(drcuml_state *drcuml)
+static u8 bevalidate_psize(bevalidate_test const &test, int pnum)
 {
-	uml::code_handle *handles[3];
-	int tnum;
-
-	// allocate handles for the code
-	handles[0] = drcuml->handle_alloc("test_entry");
-	handles[1] = drcuml->handle_alloc("code_start");
-	handles[2] = drcuml->handle_alloc("code_end");
-
-	// iterate over test entries
-	printf("Backend validation....\n");
-	for (tnum = 31; tnum < ARRAY_LENGTH(bevalidate_test_list); tnum++)
-	{
-		const bevalidate_test *test = &bevalidate_test_list[tnum];
-		parameter param[ARRAY_LENGTH(test->param)];
-		char mnemonic[20], *dst;
-		const char *src;
-
-		// progress
-		dst = mnemonic;
-		for (src = opcode_info_table[test->opcode()]->mnemonic; *src != 0; src++)
-		{
-			if (*src == '!')
-			{
-				if (test->size == 8)
-					*dst++ = 'd';
-			}
-			else if (*src == '#')
-				*dst++ = (test->size == 8) ? 'd' : 's';
-			else
-				*dst++ = *src;
-		}
-		*dst = 0;
-		printf("Executing test %d/%d (%s)", tnum + 1, (int)ARRAY_LENGTH(bevalidate_test_list), mnemonic);
-
-		// reset parameter list and iterate
-		memset(param, 0, sizeof(param));
-		bevalidate_iterate_over_params(drcuml, handles, test, param, 0);
-		printf("\n");
-	}
-	fatalerror("All tests passed!\n");
+	u8 const size = uml::instruction::param_size(test.opcode, test.size, pnum);
+	return size ? size : test.size;
 }
 
 
-/*-------------------------------------------------
-    bevalidate_iterate_over_params - iterate over
-    all supported types and values of a parameter
-    and recursively hand off to the next parameter,
-    or else move on to iterate over the flags
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_verify_state - verify the final
+//  state after executing a test, and report any
+//  discrepancies
+//-------------------------------------------------
 
-static void bevalidate_iterate_over_params(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, parameter *paramlist, int pnum)
+static void bevalidate_verify_state(drcuml_state &drcuml, drcuml_machine_state const &istate, drcuml_machine_state const &fstate, bevalidate_test const &test, u8 flags, uml::parameter const *params, int numparams, uml::instruction const &testinst, u8 flagmask)
 {
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	drcuml_ptype ptype;
+	bool ireg[uml::REG_I_COUNT] = { false };
+	bool freg[uml::REG_F_COUNT] = { false };
+	std::ostringstream errors;
 
-	// if no parameters, execute now
-	if (pnum >= ARRAY_LENGTH(opinfo->param) || opinfo->param[pnum].typemask == PTYPES_NONE)
+	// check flags
+	if (flags != (test.flags & flagmask))
 	{
-		bevalidate_iterate_over_flags(drcuml, handles, test, paramlist);
-		return;
+		static char const flagchars[] = "CVZSU";
+		util::stream_format(errors, "  Flags ... result:");
+		for (int bit = 4; bit >= 0; bit--)
+			util::stream_format(errors, "%c", BIT(flagmask, bit) ? (BIT(flags, bit) ? flagchars[bit] : '.') : '-');
+		util::stream_format(errors, "  expected:");
+		for (int bit = 4; bit >= 0; bit--)
+			util::stream_format(errors, "%c", BIT(flagmask, bit) ? (BIT(test.flags, bit) ? flagchars[bit] : '.') : '-');
+		util::stream_format(errors, "\n");
 	}
 
-	// iterate over valid parameter types
-	for (ptype = parameter::PTYPE_IMMEDIATE; ptype < parameter::PTYPE_MAX; ptype++)
-		if (opinfo->param[pnum].typemask & (1 << ptype))
+	// check destination parameters
+	for (int pnum = 0; pnum < numparams; pnum++)
+	{
+		if (uml::instruction::param_is_output(test.opcode, pnum))
 		{
-			int pindex, pcount;
-
-			// mapvars can only do 32-bit tests
-			if (ptype == parameter::PTYPE_MAPVAR && effective_test_psize(opinfo, pnum, test->size, test->param) == 8)
-				continue;
+			u8 const psize = bevalidate_psize(test, pnum);
+			u64 const mask = ~u64(0) >> (64 - 8 * psize);
+			u64 result = 0;
 
-			// for some parameter types, we wish to iterate over all possibilities
-			switch (ptype)
+			// fetch the result from wherever the parameter lives
+			switch (params[pnum].type())
 			{
-				case parameter::PTYPE_INT_REGISTER:     pcount = REG_I_END - REG_I0;        break;
-				case parameter::PTYPE_FLOAT_REGISTER:   pcount = REG_F_END - REG_F0;        break;
-				default:                            pcount = 1;                                     break;
-			}
-
-			// iterate over possibilities
-			for (pindex = 0; pindex < pcount; pindex++)
-			{
-				bool skip = false;
-				int pscannum;
-
-				// for param 0, print a dot
-				if (pnum == 0)
-					printf(".");
-
-				// can't duplicate multiple source parameters unless they are immediates
-				if (ptype != parameter::PTYPE_IMMEDIATE && (opinfo->param[pnum].output & PIO_IN))
+			case uml::parameter::PTYPE_INT_REGISTER:
+				ireg[params[pnum].ireg() - uml::REG_I0] = true;
+				result = fstate.r[params[pnum].ireg() - uml::REG_I0].d;
+				break;
 
-					// loop over all parameters we've done before; if the parameter is a source and matches us, skip this case
-					for (pscannum = 0; pscannum < pnum; pscannum++)
-						if ((opinfo->param[pscannum].output & PIO_IN) && ptype == paramlist[pscannum].type && pindex == paramlist[pscannum].value)
-							skip = true;
+			case uml::parameter::PTYPE_FLOAT_REGISTER:
+				freg[params[pnum].freg() - uml::REG_F0] = true;
+				std::memcpy(&result, &fstate.f[params[pnum].freg() - uml::REG_F0].d, sizeof(result));
+				break;
 
-				// can't duplicate multiple dest parameters
-				if (opinfo->param[pnum].output & PIO_OUT)
+			case uml::parameter::PTYPE_MEMORY:
+				if (psize == 4)
+					result = *reinterpret_cast<u32 const *>(params[pnum].memory());
+				else
+					result = *reinterpret_cast<u64 const *>(params[pnum].memory());
+				break;
 
-					// loop over all parameters we've done before; if the parameter is a source and matches us, skip this case
-					for (pscannum = 0; pscannum < pnum; pscannum++)
-						if ((opinfo->param[pscannum].output & PIO_OUT) && ptype == paramlist[pscannum].type && pindex == paramlist[pscannum].value)
-							skip = true;
+			default:
+				break;
+			}
 
-				// iterate over the next parameter in line
-				if (!skip)
-				{
-					paramlist[pnum].type = ptype;
-					paramlist[pnum].value = pindex;
-					bevalidate_iterate_over_params(drcuml, handles, test, paramlist, pnum + 1);
-				}
+			// check against the mask
+			if ((test.param[pnum] != BEVALIDATE_UNDEFINED) && ((result & mask) != (test.param[pnum] & mask)))
+			{
+				if (psize == 4)
+					util::stream_format(errors, "  Parameter %d ... result:%08X  expected:%08X\n", pnum, u32(result), u32(test.param[pnum]));
+				else
+					util::stream_format(errors, "  Parameter %d ... result:%016X  expected:%016X\n", pnum, result, test.param[pnum]);
 			}
 		}
-}
-
-
-/*-------------------------------------------------
-    bevalidate_iterate_over_flags - iterate over
-    all supported flag masks
--------------------------------------------------*/
+	}
 
-static void bevalidate_iterate_over_flags(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, parameter *paramlist)
-{
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	uint8_t flagmask = opinfo->outflags;
-	uint8_t curmask;
+	// check other registers for unexpected alterations
+	for (int regnum = 0; regnum < uml::REG_I_COUNT; regnum++)
+	{
+		if (!ireg[regnum] && (istate.r[regnum].d != fstate.r[regnum].d))
+			util::stream_format(errors, "  Register i%d ... result:%016X  originally:%016X\n", regnum, fstate.r[regnum].d, istate.r[regnum].d);
+	}
+	for (int regnum = 0; regnum < uml::REG_F_COUNT; regnum++)
+	{
+		if (!freg[regnum] && std::memcmp(&istate.f[regnum].d, &fstate.f[regnum].d, sizeof(fstate.f[regnum].d)))
+			util::stream_format(errors, "  Register f%d ... altered\n", regnum);
+	}
 
-	// iterate over all possible flag combinations
-	for (curmask = 0; curmask <= flagmask; curmask++)
-		if ((curmask & flagmask) == curmask)
-			bevalidate_execute(drcuml, handles, test, paramlist, curmask);
+	// output the error if we have one
+	std::string const errortext(errors.str());
+	if (!errortext.empty())
+	{
+		printf("\n");
+		printf("----------------------------------------------\n");
+		printf("Backend validation error:\n");
+		printf("   %s\n", testinst.disasm(&drcuml).c_str());
+		printf("\n");
+		printf("Errors:\n");
+		printf("%s\n", errortext.c_str());
+		fatalerror("Error during validation\n");
+	}
 }
 
 
-/*-------------------------------------------------
-    bevalidate_execute - execute a single instance
-    of a test, generating code and verifying the
-    results
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_execute - execute a single instance
+//  of a test, generating code and verifying the
+//  results
+//-------------------------------------------------
 
-static void bevalidate_execute(drcuml_state *drcuml, uml::code_handle **handles, const bevalidate_test *test, const parameter *paramlist, uint8_t flagmask)
+static void bevalidate_execute(bevalidate_context &ctx, bevalidate_test const &test, bevalidate_param const *paramlist, int numparams, u8 flagmask)
 {
-	parameter params[ARRAY_LENGTH(test->param)];
+	running_machine &machine(ctx.drcuml.device().machine());
 	drcuml_machine_state istate, fstate;
-	instruction testinst;
-	drcuml_block *block;
-	uint64_t *parammem;
-	int numparams;
+	uml::parameter params[uml::instruction::MAX_PARAMS];
 
-	// allocate memory for parameters
-	parammem = (uint64_t *)drcuml->cache->alloc_near(sizeof(uint64_t) * (ARRAY_LENGTH(test->param) + 1));
+	// allocate memory for parameters plus the flags result
+	size_t const memsize(sizeof(u64) * (uml::instruction::MAX_PARAMS + 1));
+	u64 *const parammem(reinterpret_cast<u64 *>(ctx.drcuml.cache().alloc_near(memsize)));
 
-	// flush the cache
-	drcuml->reset();
-
-	// start a new block
-	block = drcuml->block_begin(30);
-	UML_HANDLE(block, handles[0]);
+	// flush the cache and start a new block
+	ctx.drcuml.reset();
+	drcuml_block &block(ctx.drcuml.begin_block(30));
+	block.append().handle(*ctx.handles[0]);
 
 	// set up a random initial state
-	bevalidate_initialize_random_state(drcuml, block, &istate);
+	istate.fmod = machine.rand() & 0x03;
+	istate.exp = machine.rand();
+	for (drcuml_ireg &reg : istate.r)
+	{
+		reg.w.h = machine.rand();
+		reg.w.l = machine.rand();
+	}
+	for (drcuml_freg &reg : istate.f)
+	{
+		u64 const bits((u64(machine.rand()) << 32) | u32(machine.rand()));
+		std::memcpy(&reg.d, &bits, sizeof(bits));
+	}
+	for (int mvnum = 0; mvnum < uml::MAPVAR_COUNT; mvnum++)
+		block.append().mapvar(uml::mapvar(mvnum), machine.rand());
 
 	// then populate the state with the parameters
-	numparams = bevalidate_populate_state(block, &istate, test, paramlist, params, parammem);
-
-	// generate the code
-	UML_RESTORE(block, &istate);
-	UML_HANDLE(block, handles[1]);
-	switch (numparams)
+	istate.flags = test.iflags;
+	for (int pnum = 0; pnum < numparams; pnum++)
 	{
-		case 0:
-			block->append(test->opcode(), test->size);
+		int const index(paramlist[pnum].index);
+		switch (paramlist[pnum].type)
+		{
+		case uml::parameter::PTYPE_IMMEDIATE:
+			params[pnum] = test.param[pnum];
 			break;
 
-		case 1:
-			block->append(test->opcode(), test->size, params[0]);
+		case uml::parameter::PTYPE_INT_REGISTER:
+			istate.r[index].d = test.param[pnum];
+			params[pnum] = uml::ireg(index);
 			break;
 
-		case 2:
-			block->append(test->opcode(), test->size, params[0], params[1]);
+		case uml::parameter::PTYPE_FLOAT_REGISTER:
+			std::memcpy(&istate.f[index].d, &test.param[pnum], sizeof(istate.f[index].d));
+			params[pnum] = uml::freg(index);
 			break;
 
-		case 3:
-			block->append(test->opcode(), test->size, params[0], params[1], params[2]);
+		case uml::parameter::PTYPE_MEMORY:
+			if (bevalidate_psize(test, pnum) == 4)
+				*reinterpret_cast<u32 *>(&parammem[pnum]) = test.param[pnum];
+			else
+				parammem[pnum] = test.param[pnum];
+			params[pnum] = uml::mem(&parammem[pnum]);
 			break;
 
-		case 4:
-			block->append(test->opcode(), test->size, params[0], params[1], params[2], params[3]);
+		case uml::parameter::PTYPE_MAPVAR:
+			block.append().mapvar(uml::mapvar(index), test.param[pnum]);
+			params[pnum] = uml::mapvar(index);
 			break;
-	}
-	testinst = block->inst[block->nextinst - 1];
-	UML_HANDLE(block, handles[2]);
-	UML_GETFLGS(block, MEM(&parammem[ARRAY_LENGTH(test->param)]), flagmask);
-	UML_SAVE(block, &fstate);
-	UML_EXIT(block, IMM(0));
 
-	// end the block
-	block->end();
+		default:
+			assert(false);
+			break;
+		}
+	}
 
-	// execute
-	drcuml->execute(*handles[0]);
+	// generate the code
+	block.append().restore(&istate);
+	block.append().handle(*ctx.handles[1]);
+	uml::instruction &testinst(block.append());
+	testinst.build(test.opcode, test.size, params, numparams);
+	block.append().handle(*ctx.handles[2]);
+	block.append().getflgs(uml::mem(&parammem[uml::instruction::MAX_PARAMS]), flagmask);
+	block.append().save(&fstate);
+	block.append().exit(0);
+	block.end();
+
+	// execute and time it
+	osd_ticks_t const start(osd_ticks());
+	ctx.drcuml.execute(*ctx.handles[0]);
+	ctx.ticks += osd_ticks() - start;
+	ctx.executed++;
 
 	// verify the results
-	bevalidate_verify_state(drcuml, &istate, &fstate, test, *(uint32_t *)&parammem[ARRAY_LENGTH(test->param)], params, &testinst, handles[1]->code, handles[2]->code, flagmask);
+	bevalidate_verify_state(ctx.drcuml, istate, fstate, test, u8(parammem[uml::instruction::MAX_PARAMS]), params, numparams, testinst, flagmask);
 
 	// free memory
-	drcuml->cache->dealloc(parammem, sizeof(uint64_t) * (ARRAY_LENGTH(test->param) + 1));
+	ctx.drcuml.cache().dealloc(parammem, memsize);
 }
 
 
-/*-------------------------------------------------
-    bevalidate_initialize_random_state -
-    initialize the machine state to randomness
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_iterate_over_flags - iterate over
+//  all supported flag masks
+//-------------------------------------------------
 
-static void bevalidate_initialize_random_state(drcuml_state *drcuml, drcuml_block *block, drcuml_machine_state *state)
+static void bevalidate_iterate_over_flags(bevalidate_context &ctx, bevalidate_test const &test, bevalidate_param const *paramlist, int numparams)
 {
-	running_machine &machine = drcuml->device->machine();
-	int regnum;
-
-	// initialize core state to random values
-	state->fmod = machine.rand() & 0x03;
-	state->flags = machine.rand() & 0x1f;
-	state->exp = machine.rand();
-
-	// initialize integer registers to random values
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->r); regnum++)
-	{
-		state->r[regnum].w.h = machine.rand();
-		state->r[regnum].w.l = machine.rand();
-	}
-
-	// initialize float registers to random values
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->f); regnum++)
+	// build a throwaway copy of the instruction to find which flags it produces
+	static u64 dummy;
+	uml::parameter params[uml::instruction::MAX_PARAMS];
+	for (int pnum = 0; pnum < numparams; pnum++)
 	{
-		*(uint32_t *)&state->f[regnum].s.h = machine.rand();
-		*(uint32_t *)&state->f[regnum].s.l = machine.rand();
+		switch (paramlist[pnum].type)
+		{
+		case uml::parameter::PTYPE_INT_REGISTER:    params[pnum] = uml::ireg(paramlist[pnum].index);    break;
+		case uml::parameter::PTYPE_FLOAT_REGISTER:  params[pnum] = uml::freg(paramlist[pnum].index);    break;
+		case uml::parameter::PTYPE_MAPVAR:          params[pnum] = uml::mapvar(paramlist[pnum].index);  break;
+		case uml::parameter::PTYPE_MEMORY:          params[pnum] = uml::mem(&dummy);                    break;
+		default:                                    params[pnum] = test.param[pnum];                    break;
+		}
 	}
+	uml::instruction inst;
+	inst.build(test.opcode, test.size, params, numparams);
+	u8 const flagmask(inst.output_flags());
 
-	// initialize map variables to random values
-	for (regnum = 0; regnum < MAPVAR_COUNT; regnum++)
-		UML_MAPVAR(block, MVAR(regnum), machine.rand());
+	// iterate over all possible flag combinations
+	for (u8 curmask = 0; curmask <= flagmask; curmask++)
+		if ((curmask & flagmask) == curmask)
+			bevalidate_execute(ctx, test, paramlist, numparams, curmask);
 }
 
 
-/*-------------------------------------------------
-    bevalidate_populate_state - populate the
-    machine state with the proper values prior
-    to executing a test
--------------------------------------------------*/
+//-------------------------------------------------
+//  bevalidate_iterate_over_params - iterate over
+//  all supported types and values of a parameter
+//  and recursively hand off to the next parameter,
+//  or else move on to iterate over the flags
+//-------------------------------------------------
 
-static int bevalidate_populate_state(drcuml_block *block, drcuml_machine_state *state, const bevalidate_test *test, const parameter *paramlist, parameter *params, uint64_t *parammem)
+static void bevalidate_iterate_over_params(bevalidate_context &ctx, bevalidate_test const &test, bevalidate_param *paramlist, int numparams, int pnum)
 {
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	int numparams = ARRAY_LENGTH(test->param);
-	int pnum;
-
-	// copy flags as-is
-	state->flags = test->iflags;
+	// if no parameters, execute now
+	if (pnum >= numparams)
+	{
+		bevalidate_iterate_over_flags(ctx, test, paramlist, numparams);
+		return;
+	}
 
-	// iterate over parameters
-	for (pnum = 0; pnum < ARRAY_LENGTH(test->param); pnum++)
+	// iterate over valid parameter types
+	static uml::parameter::parameter_type const types[] =
 	{
-		int psize = effective_test_psize(opinfo, pnum, test->size, test->param);
-		parameter *curparam = &params[pnum];
+		uml::parameter::PTYPE_IMMEDIATE,
+		uml::parameter::PTYPE_INT_REGISTER,
+		uml::parameter::PTYPE_FLOAT_REGISTER,
+		uml::parameter::PTYPE_MAPVAR,
+		uml::parameter::PTYPE_MEMORY
+	};
+	bool const input(uml::instruction::param_is_input(test.opcode, pnum));
+	bool const output(uml::instruction::param_is_output(test.opcode, pnum));
+	for (uml::parameter::parameter_type const ptype : types)
+	{
+		if (!uml::instruction::param_allows(test.opcode, pnum, ptype))
+			continue;
 
-		// start with a copy of the parameter from the list
-		*curparam = paramlist[pnum];
+		// mapvars can only do 32-bit tests
+		if ((ptype == uml::parameter::PTYPE_MAPVAR) && (bevalidate_psize(test, pnum) == 8))
+			continue;
 
-		// switch off the type
-		switch (curparam->type)
+		// for registers, iterate over all possibilities
+		int pcount;
+		switch (ptype)
 		{
-			// immediate parameters: take the value from the test entry
-			case parameter::PTYPE_IMMEDIATE:
-				curparam->value = test->param[pnum];
-				break;
-
-			// register parameters: set the register value in the state and set the parameter value to the register index
-			case parameter::PTYPE_INT_REGISTER:
-				state->r[curparam->value].d = test->param[pnum];
-				curparam->value += REG_I0;
-				break;
-
-			// register parameters: set the register value in the state and set the parameter value to the register index
-			case parameter::PTYPE_FLOAT_REGISTER:
-				state->f[curparam->value].d = test->param[pnum];
-				curparam->value += REG_F0;
-				break;
-
-			// memory parameters: set the memory value in the parameter space and set the parameter value to point to it
-			case parameter::PTYPE_MEMORY:
-				curparam->value = (uintptr_t)&parammem[pnum];
-				if (psize == 4)
-					*(uint32_t *)(uintptr_t)curparam->value = test->param[pnum];
-				else
-					*(uint64_t *)(uintptr_t)curparam->value = test->param[pnum];
-				break;
-
-			// map variables: issue a MAPVAR instruction to set the value and set the parameter value to the mapvar index
-			case parameter::PTYPE_MAPVAR:
-				UML_MAPVAR(block, MVAR(curparam->value), test->param[pnum]);
-				curparam->value += MAPVAR_M0;
-				break;
-
-			// use anything else to count the number of parameters
-			default:
-				numparams = MIN(numparams, pnum);
-				break;
+		case uml::parameter::PTYPE_INT_REGISTER:    pcount = uml::REG_I_COUNT;  break;
+		case uml::parameter::PTYPE_FLOAT_REGISTER:  pcount = uml::REG_F_COUNT;  break;
+		default:                                    pcount = 1;                 break;
 		}
-	}
-
-	// return the total number of parameters
-	return numparams;
-}
-
-
-/*-------------------------------------------------
-    bevalidate_verify_state - verify the final
-    state after executing a test, and report any
-    discrepancies
--------------------------------------------------*/
-
-static int bevalidate_verify_state(drcuml_state *drcuml, const drcuml_machine_state *istate, drcuml_machine_state *state, const bevalidate_test *test, uint32_t flags, const parameter *params, const instruction *testinst, drccodeptr codestart, drccodeptr codeend, uint8_t flagmask)
-{
-	const opcode_info *opinfo = opcode_info_table[test->opcode()];
-	uint8_t ireg[REG_I_END - REG_I0] = { 0 };
-	uint8_t freg[REG_F_END - REG_F0] = { 0 };
-	char errorbuf[1024];
-	char *errend = errorbuf;
-	int pnum, regnum;
-
-	*errend = 0;
-
-	// check flags
-	if (flags != (test->flags & flagmask))
-	{
-		errend += sprintf(errend, "  Flags ... result:%c%c%c%c%c  expected:%c%c%c%c%c\n",
-			(flagmask & FLAG_U) ? ((flags & FLAG_U) ? 'U' : '.') : '-',
-			(flagmask & FLAG_S) ? ((flags & FLAG_S) ? 'S' : '.') : '-',
-			(flagmask & FLAG_Z) ? ((flags & FLAG_Z) ? 'Z' : '.') : '-',
-			(flagmask & FLAG_V) ? ((flags & FLAG_V) ? 'V' : '.') : '-',
-			(flagmask & FLAG_C) ? ((flags & FLAG_C) ? 'C' : '.') : '-',
-			(flagmask & FLAG_U) ? ((test->flags & FLAG_U) ? 'U' : '.') : '-',
-			(flagmask & FLAG_S) ? ((test->flags & FLAG_S) ? 'S' : '.') : '-',
-			(flagmask & FLAG_Z) ? ((test->flags & FLAG_Z) ? 'Z' : '.') : '-',
-			(flagmask & FLAG_V) ? ((test->flags & FLAG_V) ? 'V' : '.') : '-',
-			(flagmask & FLAG_C) ? ((test->flags & FLAG_C) ? 'C' : '.') : '-');
-	}
 
-	// check destination parameters
-	for (pnum = 0; pnum < ARRAY_LENGTH(test->param); pnum++)
-		if (opinfo->param[pnum].output & PIO_OUT)
+		for (int pindex = 0; pindex < pcount; pindex++)
 		{
-			int psize = effective_test_psize(opinfo, pnum, test->size, test->param);
-			uint64_t mask = u64(0xffffffffffffffff) >> (64 - 8 * psize);
-			uint64_t result = 0;
+			// for param 0, print a dot
+			if (pnum == 0)
+				printf(".");
 
-			// fetch the result from the parameters
-			switch (params[pnum].type)
+			// can't share a register or map variable between two sources or two destinations
+			bool skip(false);
+			if (ptype != uml::parameter::PTYPE_IMMEDIATE && ptype != uml::parameter::PTYPE_MEMORY)
 			{
-				// integer registers fetch from the state
-				case parameter::PTYPE_INT_REGISTER:
-					ireg[params[pnum].value - REG_I0] = 1;
-					result = state->r[params[pnum].value - REG_I0].d;
-					break;
-
-				// float registers fetch from the state
-				case parameter::PTYPE_FLOAT_REGISTER:
-					freg[params[pnum].value - REG_I0] = 1;
-					result = state->f[params[pnum].value - REG_F0].d;
-					break;
-
-				// memory registers fetch from the memory address
-				case parameter::PTYPE_MEMORY:
-					if (psize == 4)
-						result = *(uint32_t *)(uintptr_t)params[pnum].value;
-					else
-						result = *(uint64_t *)(uintptr_t)params[pnum].value;
-					break;
-
-				default:
-					break;
+				for (int pscannum = 0; pscannum < pnum; pscannum++)
+				{
+					if ((paramlist[pscannum].type == ptype) && (paramlist[pscannum].index == pindex) &&
+							((input && uml::instruction::param_is_input(test.opcode, pscannum)) || (output && uml::instruction::param_is_output(test.opcode, pscannum))))
+						skip = true;
+				}
 			}
 
-			// check against the mask
-			if (test->param[pnum] != UNDEFINED_U64 && (result & mask) != (test->param[pnum] & mask))
+			// iterate over the next parameter in line
+			if (!skip)
 			{
-				if ((uint32_t)mask == mask)
-					errend += sprintf(errend, "  Parameter %d ... result:%08X  expected:%08X\n", pnum,
-										(uint32_t)(result & mask), (uint32_t)(test->param[pnum] & mask));
-				else
-					errend += sprintf(errend, "  Parameter %d ... result:%08X%08X  expected:%08X%08X\n", pnum,
-										(uint32_t)((result & mask) >> 32), (uint32_t)(result & mask),
-										(uint32_t)((test->param[pnum] & mask) >> 32), (uint32_t)(test->param[pnum] & mask));
+				paramlist[pnum].type = ptype;
+				paramlist[pnum].index = pindex;
+				bevalidate_iterate_over_params(ctx, test, paramlist, numparams, pnum + 1);
 			}
 		}
+	}
+}
 
-	// check source integer parameters for unexpected alterations
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->r); regnum++)
-		if (ireg[regnum] == 0 && istate->r[regnum].d != state->r[regnum].d)
-			errend += sprintf(errend, "  Register i%d ... result:%08X%08X  originally:%08X%08X\n", regnum,
-								(uint32_t)(state->r[regnum].d >> 32), (uint32_t)state->r[regnum].d,
-								(uint32_t)(istate->r[regnum].d >> 32), (uint32_t)istate->r[regnum].d);
 
-	// check source float parameters for unexpected alterations
-	for (regnum = 0; regnum < ARRAY_LENGTH(state->f); regnum++)
-		if (freg[regnum] == 0 && *(uint64_t *)&istate->f[regnum].d != *(uint64_t *)&state->f[regnum].d)
-			errend += sprintf(errend, "  Register f%d ... result:%08X%08X  originally:%08X%08X\n", regnum,
-								(uint32_t)(*(uint64_t *)&state->f[regnum].d >> 32), (uint32_t)*(uint64_t *)&state->f[regnum].d,
-								(uint32_t)(*(uint64_t *)&istate->f[regnum].d >> 32), (uint32_t)*(uint64_t *)&istate->f[regnum].d);
+//-------------------------------------------------
+//  validate_backend - execute a number of
+//  generic tests on the backend code generator
+//-------------------------------------------------
 
-	// output the error if we have one
-	if (errend != errorbuf)
-	{
-		// disassemble the test instruction
-		std::string disasm = testinst->disasm(drcuml);
+static void validate_backend(drcuml_state &drcuml)
+{
+	bevalidate_context ctx{ drcuml, { nullptr, nullptr, nullptr }, 0, 0 };
 
-		// output a description of what went wrong
-		printf("\n");
-		printf("----------------------------------------------\n");
-		printf("Backend validation error:\n");
-		printf("   %s\n", disasm.c_str());
-		printf("\n");
-		printf("Errors:\n");
-		printf("%s\n", errorbuf);
-		fatalerror("Error during validation\n");
+	// allocate handles for the code
+	ctx.handles[0] = drcuml.handle_alloc("test_entry");
+	ctx.handles[1] = drcuml.handle_alloc("code_start");
+	ctx.handles[2] = drcuml.handle_alloc("code_end");
+
+	// iterate over test entries
+	printf("Backend validation....\n");
+	for (int tnum = 0; tnum < ARRAY_LENGTH(bevalidate_test_list); tnum++)
+	{
+		bevalidate_test const &test(bevalidate_test_list[tnum]);
+		bevalidate_param paramlist[uml::instruction::MAX_PARAMS];
+
+		printf("Executing test %d/%d", tnum + 1, int(ARRAY_LENGTH(bevalidate_test_list)));
+		ctx.executed = 0;
+		ctx.ticks = 0;
+		bevalidate_iterate_over_params(ctx, test, paramlist, uml::instruction::param_count(test.opcode), 0);
+		printf(" %u variants, %u ticks/variant\n", ctx.executed, u32(ctx.executed ? (ctx.ticks / ctx.executed) : 0));
 	}
-	return errend != errorbuf;
+	fatalerror("All tests passed!\n");
 }
 
 #endif
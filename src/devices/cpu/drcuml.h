@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -28,6 +29,9 @@
 // these options are passed into drcuml_alloc() and control global behaviors
 
 
+// bump this whenever UML generation changes in a way that invalidates saved block lists
+constexpr u32 DRCUML_PERSISTENT_VERSION = 1;
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -103,6 +107,9 @@ public:
 	uml::instruction &append();
 	template <typename Format, typename... Params> void append_comment(Format &&fmt, Params &&... args);
 
+	// dataflow optimization of a straight list of instructions
+	static void optimize_dataflow(uml::instruction *insts, int count);
+
 	// this class is thrown if abort() is called
 	class abort_compilation : public emu_exception
 	{
@@ -113,6 +120,7 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void optimize_dataflow();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -196,7 +204,27 @@ public:
 	void log_flush() { if (logging()) m_umllog->flush(); }
 	bool logging_native() const { return m_beintf->logging(); }
 
+	// optimization
+	bool optimize_dataflow() const { return m_optimize_dataflow; }
+
+	// persistent block list
+	struct persistent_entry
+	{
+		u32 mode;                                   // mode of the block entry point
+		u32 pc;                                     // PC of the block entry point
+		u32 crc;                                    // front-end checksum of the code
+	};
+	bool persistent() const { return m_persistent; }
+	void persistent_record(u32 mode, u32 pc, u32 crc);
+	std::vector<persistent_entry> persistent_take();
+
 private:
+	// persistent block list helpers
+	std::string persistent_filename() const;
+	u32 persistent_key() const;
+	void persistent_load();
+	void persistent_save();
+
 	// symbol class
 	class symbol
 	{
@@ -225,9 +253,14 @@ private:
 	drc_cache &                             m_cache;            // pointer to the codegen cache
 	std::unique_ptr<drcbe_interface> const  m_beintf;           // backend interface pointer
 	std::unique_ptr<std::ostream> const     m_umllog;           // handle to the UML logfile
+	bool const                              m_optimize_dataflow; // apply dataflow optimizations to blocks
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	bool const                              m_persistent;       // save and reload compiled block entry points
+	std::map<std::pair<u32, u32>, u32>      m_persistent_blocks; // blocks compiled this run, keyed by mode/PC
+	std::vector<persistent_entry>           m_persistent_pending; // blocks loaded from the previous run
+	u32                                     m_persistent_key;   // key of the ROM contents at load time
 };
 
 
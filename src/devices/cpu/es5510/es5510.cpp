@@ -163,6 +163,8 @@ es5510_device::es5510_device(const machine_config &mconfig, const char *tag, dev
 	, dol_count(0)
 	, instr(nullptr)
 	, dram(nullptr)
+	, decoded(nullptr)
+	, program_dirty(true)
 	, dol_latch(0)
 	, dil_latch(0)
 	, dadr_latch(0)
@@ -502,6 +504,7 @@ WRITE8_MEMBER(es5510_device::host_w)
 #endif
 		if (data < 0xa0) {
 			instr[data] = instr_latch&0xffffffffffffU;
+			program_dirty = true;
 		}
 		break;
 
@@ -512,6 +515,7 @@ WRITE8_MEMBER(es5510_device::host_w)
 #endif
 		if (data < 0xa0) {
 			instr[data] = instr_latch;
+			program_dirty = true;
 		}
 		write_reg(data, gpr_latch);
 		break;
@@ -552,6 +556,8 @@ void es5510_device::ser_w(int offset, int16_t data)
 void es5510_device::device_start() {
 	gpr = std::make_unique<int32_t[]>(0xc0);     // 24 bits, right justified
 	instr = std::make_unique<uint64_t[]>(160);    // 48 bits, right justified
+	decoded = std::make_unique<decoded_instr_t[]>(160);
+	program_dirty = true;
 	dram = std::make_unique<int16_t[]>(DRAM_SIZE);   // there are up to 20 address bits (at least 16 expected), left justified within the 24 bits of a gpr or dadr; we preallocate all of it.
 	set_icountptr(icount);
 	state_add(STATE_GENPC,"GENPC", pc).noshow();
@@ -630,6 +636,7 @@ void es5510_device::device_reset() {
 	pc = 0x00;
 	std::fill(&gpr[0], &gpr[0xc0], 0);
 	std::fill(&instr[0], &instr[160], 0);
+	program_dirty = true;
 	std::fill(&dram[0], &dram[DRAM_SIZE], 0);
 	state = STATE_RUNNING;
 	dil_latch = dol_latch = dadr_latch = gpr_latch = 0;
@@ -667,6 +674,36 @@ uint32_t es5510_device::execute_input_lines() const noexcept {
 	return 1;
 }
 
+void es5510_device::device_post_load() {
+	program_dirty = true;
+}
+
+void es5510_device::decode_program() {
+	for (int addr = 0; addr < 160; addr++) {
+		uint64_t inst = instr[addr];
+		decoded_instr_t &d = decoded[addr];
+		const op_select_t &opSelect = OPERAND_SELECT[(inst >> 8) & 0x0f];
+		const ram_control_t &ramControl = RAM_CONTROL[(inst >> 3) & 0x07];
+
+		d.aReg = (inst >> 16) & 0xff;
+		d.bReg = (inst >> 24) & 0xff;
+		d.cReg = (inst >> 32) & 0xff;
+		d.dReg = (inst >> 40) & 0xff;
+		d.alu_op = (inst >> 12) & 0x0f;
+		d.alu_operands = ALU_OPS[d.alu_op].operands;
+		d.alu_src = opSelect.alu_src;
+		d.alu_dst = opSelect.alu_dst;
+		d.mac_src = opSelect.mac_src;
+		d.mac_dst = opSelect.mac_dst;
+		d.ram_cycle = ramControl.cycle;
+		d.ram_access = ramControl.access;
+		d.skippable = (inst & (0x01 << 7)) != 0; // aka the 'SKIP' bit in the instruction word
+		d.accumulate = ((inst >> 6) & 0x01) != 0;
+		d.update_ccr = !d.skippable || (d.alu_op == OP_CMP);
+	}
+	program_dirty = false;
+}
+
 void es5510_device::execute_set_input(int linenum, int state) {
 	if (linenum == ES5510_HALT) {
 		halt_asserted = (state == ASSERT_LINE);
@@ -757,6 +794,9 @@ void es5510_device::list_program(void(p)(const char *, ...)) {
 }
 
 void es5510_device::execute_run() {
+	if (program_dirty)
+		decode_program();
+
 	while (icount > 0) {
 		if (state == STATE_HALTED) {
 			// Currently halted, sample the HALT line
@@ -788,7 +828,7 @@ void es5510_device::execute_run() {
 
 			// *** T0, clock low
 			// --- Read instruction N
-			uint64_t instr = this->instr[pc];
+			const decoded_instr_t &instr = decoded[pc];
 
 			// --- RAM cycle N-2 (if a Read cycle): data read from bus is stored in DIL
 			if (ram_pp.cycle != RAM_CYCLE_WRITE) {
@@ -801,13 +841,12 @@ void es5510_device::execute_run() {
 			}
 
 			// --- start of RAM cycle N
-			ram_control_t ramControl = RAM_CONTROL[((instr >> 3) & 0x07)];
-			ram.cycle = ramControl.cycle;
-			ram.io = ramControl.access == RAM_CONTROL_IO;
+			ram.cycle = instr.ram_cycle;
+			ram.io = instr.ram_access == RAM_CONTROL_IO;
 
 			// --- RAM cycle N: read offset N
 			int32_t offset = gpr[pc];
-			switch(ramControl.access) {
+			switch(instr.ram_access) {
 			case RAM_CONTROL_DELAY:
 				ram.address = (((dbase + offset) % (dlength + memincrement)) & memmask) >> memshift;
 				LOG_EXEC((". Ram Control: Delay, base=%x, offset=%x, length=%x => address=%x\n", dbase >> memshift, offset >> memshift, (dlength + memincrement) >> memshift, ram.address));
@@ -832,11 +871,8 @@ void es5510_device::execute_run() {
 
 			LOG_EXEC(("- T1.1\n"));
 
-			uint8_t operandSelect = (uint8_t)((instr >> 8) & 0x0f);
-			const op_select_t &opSelect = OPERAND_SELECT[operandSelect];
 			bool skip;
-			bool skippable = (instr & (0x01 << 7)) != 0; // aka the 'SKIP' bit in the instruction word
-			if (skippable) {
+			if (instr.skippable) {
 				bool skipConditionSatisfied = (ccr & cmr & FLAG_MASK) != 0;
 				if (isFlagSet(cmr, FLAG_NOT)) {
 					skipConditionSatisfied = !skipConditionSatisfied;
@@ -890,11 +926,11 @@ void es5510_device::execute_run() {
 
 			// --- Start of multiplier cycle N
 			LOG_EXEC((". start mulacc:\n"));
-			mulacc.cReg = (uint8_t)((instr >> 32) & 0xff);
-			mulacc.dReg = (uint8_t)((instr >> 40) & 0xff);
-			mulacc.src = opSelect.mac_src;
-			mulacc.dst = opSelect.mac_dst;
-			mulacc.accumulate = ((instr >> 6) & 0x01) != 0;
+			mulacc.cReg = instr.cReg;
+			mulacc.dReg = instr.dReg;
+			mulacc.src = instr.mac_src;
+			mulacc.dst = instr.mac_dst;
+			mulacc.accumulate = instr.accumulate;
 			mulacc.write_result = !skip;
 
 			// --- Read Multiplier Operands N
@@ -932,20 +968,19 @@ void es5510_device::execute_run() {
 
 			// --- Start of ALU cycle N
 			LOG_EXEC((". start ALU:\n"));
-			alu.aReg = (instr >> 16) & 0xff;
-			alu.bReg = (instr >> 24) & 0xff;
-			alu.op = (instr >> 12) & 0x0f;
-			alu.src = opSelect.alu_src;
-			alu.dst = opSelect.alu_dst;
+			alu.aReg = instr.aReg;
+			alu.bReg = instr.bReg;
+			alu.op = instr.alu_op;
+			alu.src = instr.alu_src;
+			alu.dst = instr.alu_dst;
 			alu.write_result = !skip;
-			alu.update_ccr = !skippable || (alu.op == OP_CMP);
+			alu.update_ccr = instr.update_ccr;
 
 			if (alu.op == 0xF) {
 				alu_operation_end();
 			} else {
 				// --- Read ALU Operands N
-				alu_op_t aluOp = ALU_OPS[alu.op];
-				if (aluOp.operands == 1) {
+				if (instr.alu_operands == 1) {
 					if (alu.src == SRC_DST_REG) {
 						alu.bValue = read_reg(alu.bReg);
 					} else { // must be SRC_DST_DELAY
@@ -117,7 +117,7 @@ public:
 	void list_program(void(p)(const char *, ...));
 
 	// for testing purposes
-	uint64_t &_instr(int pc) { return instr[pc % 160]; }
+	uint64_t &_instr(int pc) { program_dirty = true; return instr[pc % 160]; }
 	int16_t &_dram(int addr) { return dram[addr & DRAM_MASK]; }
 
 	// publicly visible for testing purposes
@@ -128,6 +128,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 	virtual space_config_vector memory_space_config() const override;
 	virtual uint64_t execute_clocks_to_cycles(uint64_t clocks) const noexcept override;
 	virtual uint64_t execute_cycles_to_clocks(uint64_t cycles) const noexcept override;
@@ -176,6 +177,29 @@ private:
 	std::unique_ptr<uint64_t[]> instr;
 	std::unique_ptr<int16_t[]> dram;
 
+	// instruction fields, decoded once whenever the program changes
+	struct decoded_instr_t {
+		uint8_t aReg;
+		uint8_t bReg;
+		uint8_t cReg;
+		uint8_t dReg;
+		uint8_t alu_op;
+		int alu_operands;
+		op_src_dst_t alu_src;
+		op_src_dst_t alu_dst;
+		op_src_dst_t mac_src;
+		op_src_dst_t mac_dst;
+		ram_cycle_t ram_cycle;
+		ram_control_access_t ram_access;
+		bool skippable;
+		bool accumulate;
+		bool update_ccr;
+	};
+	std::unique_ptr<decoded_instr_t[]> decoded;
+	bool program_dirty;
+
+	void decode_program();
+
 	// TODO : Masked address?
 	int16_t dram_r(int addr) { return dram[addr & DRAM_MASK]; }
 	void dram_w(int addr, int16_t data) { dram[addr & DRAM_MASK] = data; }
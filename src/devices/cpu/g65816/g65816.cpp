@@ -865,6 +865,8 @@ void g65816_device::device_start()
 	m_program_cache = program_space.cache<0, 0, ENDIANNESS_LITTLE>();
 	m_opcode_cache = (has_space(AS_OPCODES) ? space(AS_OPCODES) : program_space).cache<0, 0, ENDIANNESS_LITTLE>();
 
+	init_bus_timing();
+
 	m_wdm_w.resolve_safe();
 
 	save_item(NAME(m_a));
@@ -1022,21 +1024,46 @@ void g65816_device::state_string_export(const device_state_entry &entry, std::st
 SNES specific, used to handle master cycles, based off byuu's BSNES code
 */
 
-int g65816_device::bus_5A22_cycle_burst(unsigned addr)
-{
-	if(m_cpu_type == CPU_TYPE_G65816)
-		return 0;
+// Bank timing entries that defer to m_system_timing
+static constexpr uint8_t BUS_TIMING_SYSTEM = 0xff;
 
-	if(addr & 0x408000) {
-		if(addr & 0x800000)
-			return (m_fastROM & 1) ? 0 : 2;
+void g65816_device::init_bus_timing()
+{
+	// The 5A22 access time depends only on the bank, address bit 15 and,
+	// in the lower half of banks 00-3f/80-bf, address bits 9-14, so it is
+	// precomputed here rather than decoded on every access.
+	for(int fast = 0; fast < 2; fast++)
+		for(int half = 0; half < 0x200; half++)
+		{
+			unsigned addr = half << 15;
+			uint8_t cycles;
+			if(m_cpu_type == CPU_TYPE_G65816)
+				cycles = 0;
+			else if(addr & 0x408000)
+				cycles = ((addr & 0x800000) && fast) ? 0 : 2;
+			else
+				cycles = BUS_TIMING_SYSTEM;
+			m_bus_timing[fast][half] = cycles;
+		}
 
-		return 2;
+	for(int page = 0; page < 0x40; page++)
+	{
+		unsigned addr = page << 9;
+		if((addr + 0x6000) & 0x4000)
+			m_system_timing[page] = 2;
+		else if((addr - 0x4000) & 0x7e00)
+			m_system_timing[page] = 0;
+		else
+			m_system_timing[page] = 6;
 	}
-	if((addr + 0x6000) & 0x4000) return 2;
-	if((addr - 0x4000) & 0x7e00) return 0;
+}
 
-	return 6;
+int g65816_device::bus_5A22_cycle_burst(unsigned addr)
+{
+	uint8_t cycles = m_bus_timing[m_fastROM & 1][(addr >> 15) & 0x1ff];
+	if(cycles == BUS_TIMING_SYSTEM)
+		return m_system_timing[(addr >> 9) & 0x3f];
+	return cycles;
 }
 
 
@@ -137,6 +137,7 @@ protected:
 	int  g65816i_execute_E(int cycles);
 
 	void g65816i_set_execution_mode(unsigned mode);
+	void init_bus_timing();
 	int bus_5A22_cycle_burst(unsigned addr);
 	unsigned g65816_get_pc();
 	void g65816_set_pc(unsigned val);
@@ -233,6 +234,8 @@ protected:
 	unsigned m_fastROM;       /* SNES specific */
 	unsigned m_ir;            /* Instruction Register */
 	unsigned m_irq_delay;     /* delay 1 instruction before checking irq */
+	uint8_t m_bus_timing[2][0x200]; /* extra cycles per 32K half-bank, indexed by FastROM state */
+	uint8_t m_system_timing[0x40];  /* extra cycles per 512 bytes of the system area (bank offsets 0000-7fff) */
 	address_space *m_data_space;
 	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_program_cache;
 	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_opcode_cache;
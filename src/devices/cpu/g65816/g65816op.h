@@ -1934,6 +1934,13 @@ TABLE_FUNCTION(void, set_reg, (int regnum, unsigned val))
 
 
 
+#define DISPATCH(CODE) case 0x##CODE: (this->*O(CODE))(); break;
+#define DISPATCH_ROW(H) \
+	DISPATCH(H##0) DISPATCH(H##1) DISPATCH(H##2) DISPATCH(H##3) \
+	DISPATCH(H##4) DISPATCH(H##5) DISPATCH(H##6) DISPATCH(H##7) \
+	DISPATCH(H##8) DISPATCH(H##9) DISPATCH(H##a) DISPATCH(H##b) \
+	DISPATCH(H##c) DISPATCH(H##d) DISPATCH(H##e) DISPATCH(H##f)
+
 TABLE_FUNCTION(int, execute, (int clocks))
 {
 	// do a check here also in case we're in STOP_WAI mode - this'll clear it when the IRQ happens
@@ -1955,9 +1962,23 @@ TABLE_FUNCTION(int, execute, (int clocks))
 
 			REGISTER_PC++;
 			REGISTER_IR = read_8_OP(REGISTER_PB | REGISTER_PPC);
-			(this->*FTABLE_OPCODES[REGISTER_IR])();
+
+			/* Dispatch through a switch on this mode's handlers rather
+			 * than the function pointer table, so the compiler can
+			 * call (or inline) each handler directly.
+			 */
+			switch(REGISTER_IR)
+			{
+				DISPATCH_ROW(0) DISPATCH_ROW(1) DISPATCH_ROW(2) DISPATCH_ROW(3)
+				DISPATCH_ROW(4) DISPATCH_ROW(5) DISPATCH_ROW(6) DISPATCH_ROW(7)
+				DISPATCH_ROW(8) DISPATCH_ROW(9) DISPATCH_ROW(a) DISPATCH_ROW(b)
+				DISPATCH_ROW(c) DISPATCH_ROW(d) DISPATCH_ROW(e) DISPATCH_ROW(f)
+			}
 		} while((CLOCKS > 0) && g65816i_correct_mode());
 		return clocks - CLOCKS;
 	}
 	return clocks;
 }
+
+#undef DISPATCH
+#undef DISPATCH_ROW
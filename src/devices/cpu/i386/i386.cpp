@@ -346,14 +346,19 @@ uint16_t i386_device::FETCH16()
 	uint16_t value;
 	uint32_t address = m_pc, error;
 
-	if( !WORD_ALIGNED(address) ) {       /* Unaligned read */
+	if( (address & 0xfff) == 0xfff ) {   /* Unaligned read crossing a page */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
 		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
 			PF_THROW(error);
 		address &= m_a20_mask;
-		value = mem_pr16(address);
+		if( !WORD_ALIGNED(address) ) {   /* Unaligned read within a page, translate once */
+			value = (mem_pr8(address) << 0);
+			value |= (mem_pr8(address + 1) << 8);
+		} else {
+			value = mem_pr16(address);
+		}
 		m_eip += 2;
 		m_pc += 2;
 	}
@@ -364,7 +369,7 @@ uint32_t i386_device::FETCH32()
 	uint32_t value;
 	uint32_t address = m_pc, error;
 
-	if( !DWORD_ALIGNED(m_pc) ) {      /* Unaligned read */
+	if( (address & 0xfff) > 0xffc ) {   /* Unaligned read crossing a page */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 		value |= (FETCH() << 16);
@@ -374,7 +379,17 @@ uint32_t i386_device::FETCH32()
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = mem_pr32(address);
+		if( DWORD_ALIGNED(address) ) {
+			value = mem_pr32(address);
+		} else if( WORD_ALIGNED(address) ) {   /* Unaligned read within a page, translate once */
+			value = (mem_pr16(address) << 0);
+			value |= (mem_pr16(address + 2) << 16);
+		} else {
+			value = (mem_pr8(address) << 0);
+			value |= (mem_pr8(address + 1) << 8);
+			value |= (mem_pr8(address + 2) << 16);
+			value |= (mem_pr8(address + 3) << 24);
+		}
 		m_eip += 4;
 		m_pc += 4;
 	}
@@ -389,7 +404,7 @@ uint8_t i386_device::READ8PL(uint32_t ea, uint8_t privilege)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	return m_program->read_byte(address);
+	return mem_prd8(address);
 }
 
 uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
@@ -406,7 +421,7 @@ uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_word(address);
+		value = mem_prd16(address);
 		break;
 
 	case 1:
@@ -439,7 +454,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address);
+		value = mem_prd32(address);
 		break;
 
 	case 1:
@@ -527,7 +542,7 @@ uint16_t i386sx_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		return m_program->read_word(address);
+		return mem_prd16(address);
 	}
 	else
 	{
@@ -594,7 +609,7 @@ void i386_device::WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	m_program->write_byte(address, value);
+	mem_pwd8(address, value);
 }
 
 void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
@@ -609,7 +624,7 @@ void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_word(address, value);
+		mem_pwd16(address, value);
 		break;
 
 	case 1:
@@ -638,7 +653,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, value);
+		mem_pwd32(address, value);
 		break;
 
 	case 1:
@@ -719,7 +734,7 @@ void i386sx_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_word(address, value);
+		mem_pwd16(address, value);
 	}
 	else
 	{
@@ -94,6 +94,14 @@ protected:
 	virtual u16 mem_pr16(offs_t address) { return macache32->read_word(address); }
 	virtual u32 mem_pr32(offs_t address) { return macache32->read_dword(address); }
 
+	// aligned data accesses go through the cache too, which reads RAM directly
+	virtual u8 mem_prd8(offs_t address) { return macache32->read_byte(address); }
+	virtual u16 mem_prd16(offs_t address) { return macache32->read_word(address); }
+	virtual u32 mem_prd32(offs_t address) { return macache32->read_dword(address); }
+	virtual void mem_pwd8(offs_t address, u8 data) { macache32->write_byte(address, data); }
+	virtual void mem_pwd16(offs_t address, u16 data) { macache32->write_word(address, data); }
+	virtual void mem_pwd32(offs_t address, u32 data) { macache32->write_dword(address, data); }
+
 	address_space_config m_program_config;
 	address_space_config m_io_config;
 
@@ -1532,6 +1540,12 @@ protected:
 	virtual u8 mem_pr8(offs_t address) override { return macache16->read_byte(address); };
 	virtual u16 mem_pr16(offs_t address) override { return macache16->read_word(address); };
 	virtual u32 mem_pr32(offs_t address) override { return macache16->read_dword(address); };
+	virtual u8 mem_prd8(offs_t address) override { return macache16->read_byte(address); };
+	virtual u16 mem_prd16(offs_t address) override { return macache16->read_word(address); };
+	virtual u32 mem_prd32(offs_t address) override { return macache16->read_dword(address); };
+	virtual void mem_pwd8(offs_t address, u8 data) override { macache16->write_byte(address, data); };
+	virtual void mem_pwd16(offs_t address, u16 data) override { macache16->write_word(address, data); };
+	virtual void mem_pwd32(offs_t address, u32 data) override { macache16->write_dword(address, data); };
 
 	virtual uint16_t READ16PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint32_t READ32PL(uint32_t ea, uint8_t privilege) override;
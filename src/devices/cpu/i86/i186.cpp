@@ -166,7 +166,7 @@ device_memory_interface::space_config_vector i80186_cpu_device::memory_space_con
 
 uint8_t i80186_cpu_device::fetch()
 {
-	uint8_t data = m_or8(update_pc());
+	uint8_t data = opcode_read_byte(update_pc());
 	m_ip++;
 	return data;
 }
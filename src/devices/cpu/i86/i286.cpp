@@ -1025,7 +1025,7 @@ uint8_t i80286_cpu_device::fetch()
 	if(m_ip > m_limit[CS])
 		throw TRAP(FAULT_GP, 0);
 
-	data = m_or8(update_pc() & m_amask);
+	data = opcode_read_byte(update_pc() & m_amask);
 	m_ip++;
 	return data;
 }
@@ -137,7 +137,7 @@ device_memory_interface::space_config_vector i8086_cpu_device::memory_space_conf
 uint8_t i8086_cpu_device::fetch()
 {
 	uint8_t data;
-	data = m_or8(update_pc());
+	data = opcode_read_byte(update_pc());
 	m_ip++;
 	return data;
 }
@@ -469,13 +469,12 @@ void i8086_common_cpu_device::device_start()
 	m_program = &space(AS_PROGRAM);
 	m_opcodes = has_space(AS_OPCODES) ? &space(AS_OPCODES) : m_program;
 
-	if(m_opcodes->data_width() == 8) {
-		auto cache = m_opcodes->cache<0, 0, ENDIANNESS_LITTLE>();
-		m_or8 = [cache](offs_t address) -> u8 { return cache->read_byte(address); };
-	} else {
-		auto cache = m_opcodes->cache<1, 0, ENDIANNESS_LITTLE>();
-		m_or8 = [cache](offs_t address) -> u8 { return cache->read_byte(address); };
-	}
+	m_cache8 = nullptr;
+	m_cache16 = nullptr;
+	if(m_opcodes->data_width() == 8)
+		m_cache8 = m_opcodes->cache<0, 0, ENDIANNESS_LITTLE>();
+	else
+		m_cache16 = m_opcodes->cache<1, 0, ENDIANNESS_LITTLE>();
 	m_io = &space(AS_IO);
 
 	save_item(NAME(m_regs.w));
@@ -294,7 +294,9 @@ protected:
 	uint8_t   m_test_state;
 
 	address_space *m_program, *m_opcodes;
-	std::function<u8 (offs_t)> m_or8;
+	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_cache8;   // 8-bit bus (8088, 80188)
+	memory_access_cache<1, 0, ENDIANNESS_LITTLE> *m_cache16;  // 16-bit bus
+	u8 opcode_read_byte(offs_t address) { return m_cache8 ? m_cache8->read_byte(address) : m_cache16->read_byte(address); }
 	address_space *m_io;
 	int m_icount;
 
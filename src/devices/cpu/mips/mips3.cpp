@@ -5064,6 +5064,10 @@ void mips3_device::execute_run()
 			code_flush_cache();
 		m_drc_cache_dirty = false;
 
+		/* recompile anything left over from a previous run */
+		if (m_drcuml->persistent())
+			code_compile_persistent();
+
 		/* execute */
 		do
 		{
@@ -592,6 +592,8 @@ private:
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_compile_persistent();
+	uint32_t code_block_crc(const opcode_desc *desclist);
 public:
 	void func_get_cycles();
 	void func_printf_exception();
@@ -381,6 +381,10 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 			block.end();
 			g_profiler.stop();
 			succeeded = true;
+
+			/* remember it for next time */
+			if (m_drcuml->persistent())
+				m_drcuml->persistent_record(mode, pc, code_block_crc(desclist));
 		}
 		catch (drcuml_block::abort_compilation &)
 		{
@@ -391,6 +395,41 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 
 
+/*-------------------------------------------------
+    code_compile_persistent - compile blocks
+    recorded on a previous run whose code is
+    unchanged
+-------------------------------------------------*/
+
+void mips3_device::code_compile_persistent()
+{
+	for (const drcuml_state::persistent_entry &entry : m_drcuml->persistent_take())
+	{
+		if (!m_drcuml->hash_exists(entry.mode, entry.pc) && code_block_crc(m_drcfe->describe_code(entry.pc)) == entry.crc)
+			code_compile_block(entry.mode, entry.pc);
+	}
+}
+
+
+/*-------------------------------------------------
+    code_block_crc - compute a checksum of the
+    opcodes making up a described block
+-------------------------------------------------*/
+
+uint32_t mips3_device::code_block_crc(const opcode_desc *desclist)
+{
+	util::crc32_creator crc;
+	for (const opcode_desc *curdesc = desclist; curdesc != nullptr; curdesc = curdesc->next())
+	{
+		crc.append(&curdesc->physpc, sizeof(curdesc->physpc));
+		crc.append(&curdesc->flags, sizeof(curdesc->flags));
+		crc.append(curdesc->opptr.b, curdesc->length);
+	}
+	return crc.finish();
+}
+
+
+
 /***************************************************************************
     C FUNCTION CALLBACKS
 ***************************************************************************/
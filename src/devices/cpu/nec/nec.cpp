@@ -250,10 +250,17 @@ void nec_common_device::do_prefetch(int previous_ICount)
 
 }
 
+inline u8 nec_common_device::opcode_read_byte(offs_t address)
+{
+	if (m_cache8)
+		return m_cache8->read_byte(address);
+	return m_cache16->read_byte(m_chip_type == V33_TYPE ? v33_translate(address) : address);
+}
+
 uint8_t nec_common_device::fetch()
 {
 	prefetch();
-	return m_dr8((Sreg(PS)<<4)+m_ip++);
+	return opcode_read_byte((Sreg(PS)<<4)+m_ip++);
 }
 
 uint16_t nec_common_device::fetchword()
@@ -273,7 +280,7 @@ static uint8_t parity_table[256];
 uint8_t nec_common_device::fetchop()
 {
 	prefetch();
-	return m_dr8((Sreg(PS)<<4)+m_ip++);
+	return opcode_read_byte((Sreg(PS)<<4)+m_ip++);
 }
 
 
@@ -480,21 +487,17 @@ void nec_common_device::device_start()
 	save_item(NAME(m_prefetch_reset));
 
 	m_program = &space(AS_PROGRAM);
+	m_cache8 = nullptr;
+	m_cache16 = nullptr;
 	if (m_program->data_width() == 8)
 	{
-		auto cache = m_program->cache<0, 0, ENDIANNESS_LITTLE>();
-		m_dr8 = [cache](offs_t address) -> u8 { return cache->read_byte(address); };
-	}
-	else if (m_chip_type == V33_TYPE)
-	{
-		save_item(NAME(m_xa));
-		auto cache = m_program->cache<1, 0, ENDIANNESS_LITTLE>();
-		m_dr8 = [cache, this](offs_t address) -> u8 { return cache->read_byte(v33_translate(address)); };
+		m_cache8 = m_program->cache<0, 0, ENDIANNESS_LITTLE>();
 	}
 	else
 	{
-		auto cache = m_program->cache<1, 0, ENDIANNESS_LITTLE>();
-		m_dr8 = [cache](offs_t address) -> u8 { return cache->read_byte(address); };
+		if (m_chip_type == V33_TYPE)
+			save_item(NAME(m_xa));
+		m_cache16 = m_program->cache<1, 0, ENDIANNESS_LITTLE>();
 	}
 
 	m_io = &space(AS_IO);
@@ -97,7 +97,9 @@ private:
 	uint8_t   m_halted;
 
 	address_space *m_program;
-	std::function<u8 (offs_t address)> m_dr8;
+	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_cache8;   // 8-bit bus
+	memory_access_cache<1, 0, ENDIANNESS_LITTLE> *m_cache16;  // 16-bit bus
+	inline u8 opcode_read_byte(offs_t address);
 	address_space *m_io;
 	int     m_icount;
 
@@ -117,7 +117,9 @@ private:
 	uint32_t  m_IDB;
 
 	address_space *m_program;
-	std::function<u8 (offs_t address)> m_dr8;
+	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_cache8;   // 8-bit bus
+	memory_access_cache<1, 0, ENDIANNESS_LITTLE> *m_cache16;  // 16-bit bus
+	u8 opcode_read_byte(offs_t address) { return m_cache8 ? m_cache8->read_byte(address) : m_cache16->read_byte(address); }
 	address_space *m_data;
 	address_space *m_io;
 	int     m_icount;
@@ -1897,6 +1897,10 @@ void ppc_device::generate_shift_flags(drcuml_block &block, const opcode_desc *de
 
 void ppc_device::generate_fp_flags(drcuml_block &block, const opcode_desc *desc, int updatefprf)
 {
+	/* skip the FPRF update if it is overwritten before anything reads it */
+	if (!DISABLE_FLAG_OPTIMIZATIONS && !(desc->regreq[3] & frontend::REGFLAG_FPSCR(4)))
+		updatefprf = 0;
+
 	/* for now, only handle the FPRF field */
 	if (updatefprf)
 	{
@@ -266,7 +266,10 @@ void sh_common_execution::BF(uint32_t d)
 	if ((m_sh2_state->sr & SH_T) == 0)
 	{
 		int32_t disp = ((int32_t)d << 24) >> 24;
+		const uint32_t branch = m_sh2_state->pc - 2;
 		m_sh2_state->pc = m_sh2_state->ea = m_sh2_state->pc + disp * 2 + 2;
+		if (m_idle_skip && disp <= -2)
+			idle_loop_check(m_sh2_state->pc, branch);
 		m_sh2_state->icount -= 2;
 	}
 }
@@ -351,7 +354,10 @@ void sh_common_execution::BT(uint32_t d)
 	if ((m_sh2_state->sr & SH_T) != 0)
 	{
 		int32_t disp = ((int32_t)d << 24) >> 24;
+		const uint32_t branch = m_sh2_state->pc - 2;
 		m_sh2_state->pc = m_sh2_state->ea = m_sh2_state->pc + disp * 2 + 2;
+		if (m_idle_skip && disp <= -2)
+			idle_loop_check(m_sh2_state->pc, branch);
 		m_sh2_state->icount -= 2;
 	}
 }
@@ -1993,6 +1999,209 @@ void sh_common_execution::execute_one(const uint16_t opcode)
 	}
 }
 
+/*-------------------------------------------------
+    idle_loop_opcode - return true if an opcode
+    only reads memory or updates registers and
+    the T bit, so a loop made of such opcodes
+    repeats exactly while memory is unchanged;
+    records its loads and the registers it writes
+-------------------------------------------------*/
+
+bool sh_common_execution::idle_loop_opcode(uint16_t opcode, uint32_t pc, uint32_t &written, std::vector<idle_load> &loads)
+{
+	const uint8_t n = (opcode >> 8) & 0x0f;
+	const uint8_t m = (opcode >> 4) & 0x0f;
+	auto load = [&loads] (uint8_t base, uint8_t index, uint32_t offset, uint8_t width) { loads.push_back(idle_load{ base, index, offset, width }); };
+
+	switch (opcode >> 12)
+	{
+		case 0x0:
+			switch (opcode & 0x0f)
+			{
+				case 0x0c: case 0x0d: case 0x0e:    // MOV.x @(R0,Rm),Rn
+					load(m, 0, 0, 1 << ((opcode & 0x0f) - 0x0c));
+					written |= 1 << n;
+					return true;
+			}
+			if ((opcode & 0xf0ff) == 0x0029)        // MOVT
+			{
+				written |= 1 << n;
+				return true;
+			}
+			return (opcode == 0x0008) || (opcode == 0x0009) || (opcode == 0x0018); // CLRT, NOP, SETT
+
+		case 0x2:
+			switch (opcode & 0x0f)
+			{
+				case 0x08: case 0x0c:               // TST, CMP/STR
+					return true;
+				case 0x09: case 0x0a: case 0x0b:    // AND, XOR, OR
+					written |= 1 << n;
+					return true;
+			}
+			return false;
+
+		case 0x3:
+			switch (opcode & 0x0f)
+			{
+				case 0x00: case 0x02: case 0x03: case 0x06: case 0x07:  // CMP/EQ, CMP/HS, CMP/GE, CMP/HI, CMP/GT
+					return true;
+				case 0x08: case 0x0c:                                   // SUB, ADD
+					written |= 1 << n;
+					return true;
+			}
+			return false;
+
+		case 0x4:
+			switch (opcode & 0xff)
+			{
+				case 0x11: case 0x15:                                   // CMP/PZ, CMP/PL
+					return true;
+				case 0x00: case 0x01: case 0x08: case 0x09:             // SHLL, SHLR, SHLL2, SHLR2
+				case 0x18: case 0x19: case 0x28: case 0x29:             // SHLL8, SHLR8, SHLL16, SHLR16
+					written |= 1 << n;
+					return true;
+			}
+			return false;
+
+		case 0x5:   // MOV.L @(disp,Rm),Rn
+			load(m, IDLE_LOAD_NONE, (opcode & 0x0f) * 4, 4);
+			written |= 1 << n;
+			return true;
+
+		case 0x6:   // loads, MOV, NOT, SWAP, NEG, EXTU, EXTS
+			if ((opcode & 0x0f) <= 0x02 || ((opcode & 0x0f) >= 0x04 && (opcode & 0x0f) <= 0x06))
+				load(m, IDLE_LOAD_NONE, 0, 1 << (opcode & 0x03));
+			if ((opcode & 0x0f) >= 0x04 && (opcode & 0x0f) <= 0x06)
+				written |= 1 << m;              // post-increment
+			written |= 1 << n;
+			return true;
+
+		case 0x7:   // ADD #imm,Rn
+		case 0xe:   // MOV #imm,Rn
+			written |= 1 << n;
+			return true;
+
+		case 0x9:   // MOV.W @(disp,PC),Rn
+			load(IDLE_LOAD_ABSOLUTE, IDLE_LOAD_NONE, pc + 4 + (opcode & 0xff) * 2, 2);
+			written |= 1 << n;
+			return true;
+
+		case 0xd:   // MOV.L @(disp,PC),Rn
+			load(IDLE_LOAD_ABSOLUTE, IDLE_LOAD_NONE, (pc & ~3) + 4 + (opcode & 0xff) * 4, 4);
+			written |= 1 << n;
+			return true;
+
+		case 0x8:
+			switch (n)
+			{
+				case 0x04: case 0x05:               // MOV.B/W @(disp,Rm),R0
+					load(m, IDLE_LOAD_NONE, (opcode & 0x0f) << (n - 4), 1 << (n - 4));
+					written |= 1;
+					return true;
+				case 0x08:                          // CMP/EQ #imm,R0
+					return true;
+			}
+			return false;
+
+		case 0xc:
+			switch (n)
+			{
+				case 0x04: case 0x05: case 0x06:    // MOV.x @(disp,GBR),R0
+					load(IDLE_LOAD_GBR, IDLE_LOAD_NONE, (opcode & 0xff) << (n - 4), 1 << (n - 4));
+					written |= 1;
+					return true;
+				case 0x07:                          // MOVA
+				case 0x09: case 0x0a: case 0x0b:    // AND, XOR, OR #imm,R0
+					written |= 1;
+					return true;
+				case 0x08:                          // TST #imm,R0
+					return true;
+			}
+			return false;
+	}
+	return false;
+}
+
+/*-------------------------------------------------
+    idle_loop_body - return true if the loop from
+    head up to the conditional branch at branch
+    is made only of side-effect free opcodes whose
+    load addresses the body does not change
+-------------------------------------------------*/
+
+bool sh_common_execution::idle_loop_body(uint32_t head, uint32_t branch, std::vector<idle_load> &loads)
+{
+	loads.clear();
+	if (head > branch || branch - head > IDLE_LOOP_MAX_BYTES || head >= 0x40000000)
+		return false;
+
+	uint32_t written = 0;
+	for (uint32_t pc = head; pc < branch; pc += 2)
+		if (!idle_loop_opcode(m_pr16(pc & m_am), pc, written, loads))
+			return false;
+
+	for (const idle_load &l : loads)
+		if ((l.base < 16 && BIT(written, l.base)) || (l.index != IDLE_LOAD_NONE && BIT(written, l.index)))
+			return false;
+	return true;
+}
+
+/*-------------------------------------------------
+    idle_loop_loads_memory - return true if every
+    load of the current loop is from memory rather
+    than internal peripherals or device handlers,
+    whose values can change with time
+-------------------------------------------------*/
+
+bool sh_common_execution::idle_loop_loads_memory() const
+{
+	for (const idle_load &l : m_idle_loads)
+	{
+		uint32_t address = l.offset;
+		if (l.base < 16)
+			address += m_sh2_state->r[l.base];
+		else if (l.base == IDLE_LOAD_GBR)
+			address += m_sh2_state->gbr;
+		if (l.index != IDLE_LOAD_NONE)
+			address += m_sh2_state->r[l.index];
+
+		if (address >= 0x40000000 || !m_program->get_read_ptr(address & m_am) || !m_program->get_read_ptr((address + l.width - 1) & m_am))
+			return false;
+	}
+	return true;
+}
+
+/*-------------------------------------------------
+    idle_loop_check - called on arrival back at a
+    loop head; hands the registers and SR of loops
+    without side effects to the generic idle loop
+    skipping
+-------------------------------------------------*/
+
+void sh_common_execution::idle_loop_check(uint32_t head, uint32_t branch)
+{
+	if (head != m_idle_head || branch != m_idle_branch)
+	{
+		m_idle_head = head;
+		m_idle_branch = branch;
+		m_idle_candidate = idle_loop_body(head, branch, m_idle_loads);
+	}
+
+	if (m_idle_candidate && idle_loop_loads_memory())
+	{
+		uint32_t state[17];
+		memcpy(state, m_sh2_state->r, sizeof(m_sh2_state->r));
+		state[16] = m_sh2_state->sr;
+		idle_loop_pass(head, state, sizeof(state));
+	}
+}
+
+void sh_common_execution::func_idle_loop_check()
+{
+	idle_loop_check(m_sh2_state->arg0, m_sh2_state->arg1);
+}
+
 // DRC / UML related
 void cfunc_unimplemented(void *param) { ((sh_common_execution *)param)->func_unimplemented(); }
 void cfunc_MAC_W(void *param) { ((sh_common_execution *)param)->func_MAC_W(); }
@@ -2001,6 +2210,7 @@ void cfunc_DIV1(void *param) { ((sh_common_execution *)param)->func_DIV1(); }
 void cfunc_ADDV(void *param) { ((sh_common_execution *)param)->func_ADDV(); }
 void cfunc_SUBV(void *param) { ((sh_common_execution *)param)->func_SUBV(); }
 void cfunc_printf_probe(void *param) { ((sh_common_execution *)param)->func_printf_probe(); }
+void cfunc_idle_loop_check(void *param) { ((sh_common_execution *)param)->func_idle_loop_check(); }
 
 /*-------------------------------------------------
     sh2drc_add_fastram - add a new fastram
@@ -2308,6 +2518,9 @@ void sh_common_execution::execute_run_drc()
 	if (m_cache_dirty)
 		code_flush_cache();
 
+	/* code may have changed since the last timeslice */
+	idle_loop_reset();
+
 	/* execute */
 	do
 	{
@@ -3330,6 +3543,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 	int32_t disp;
 	uint32_t udisp;
 	uml::code_label templabel;
+	std::vector<idle_load> compile_loads;    // classification only, the runtime check redoes it
 
 	switch ( opcode  & (15<<8) )
 	{
@@ -3404,6 +3618,14 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = ((int32_t)opcode << 24) >> 24;
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;    // m_sh2_state->ea = destination
 
+		if (m_idle_skip && disp <= -2 && idle_loop_body(m_sh2_state->ea, desc->pc, compile_loads))
+		{
+			save_fast_iregs(block);
+			UML_MOV(block, mem(&m_sh2_state->arg0), m_sh2_state->ea);  // mov arg0, loop head
+			UML_MOV(block, mem(&m_sh2_state->arg1), desc->pc);         // mov arg1, branch
+			UML_CALLC(block, cfunc_idle_loop_check, this);
+		}
+
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3417,6 +3639,14 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = ((int32_t)opcode << 24) >> 24;
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;        // m_sh2_state->ea = destination
 
+		if (m_idle_skip && disp <= -2 && idle_loop_body(m_sh2_state->ea, desc->pc, compile_loads))
+		{
+			save_fast_iregs(block);
+			UML_MOV(block, mem(&m_sh2_state->arg0), m_sh2_state->ea);  // mov arg0, loop head
+			UML_MOV(block, mem(&m_sh2_state->arg1), desc->pc);         // mov arg1, branch
+			UML_CALLC(block, cfunc_idle_loop_check, this);
+		}
+
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -117,6 +117,10 @@ public:
 		, m_interrupt(nullptr)
 		, m_nocode(nullptr)
 		, m_out_of_cycles(nullptr)
+		, m_idle_skip(false)
+		, m_idle_head(~0U)
+		, m_idle_branch(~0U)
+		, m_idle_candidate(false)
 	{ }
 
 	// Data that needs to be stored close to the generated DRC code
@@ -188,6 +192,12 @@ protected:
 		COMPILE_MAX_SEQUENCE        = 64
 	};
 
+	// longest polling loop body considered for idle skipping
+	enum : u32
+	{
+		IDLE_LOOP_MAX_BYTES         = 32
+	};
+
 	// size of the execution code cache
 	enum : size_t
 	{
@@ -444,6 +454,33 @@ public:
 	void func_DIV1();
 	void func_ADDV();
 	void func_SUBV();
+	void func_idle_loop_check();
+
+	/* idle loop detection */
+	struct idle_load
+	{
+		uint8_t         base;       /* Rm, IDLE_LOAD_GBR or IDLE_LOAD_ABSOLUTE */
+		uint8_t         index;      /* R0 for @(R0,Rm), otherwise IDLE_LOAD_NONE */
+		uint32_t        offset;
+		uint8_t         width;
+	};
+	enum : uint8_t
+	{
+		IDLE_LOAD_GBR = 16,
+		IDLE_LOAD_ABSOLUTE = 17,
+		IDLE_LOAD_NONE = 0xff
+	};
+	static bool idle_loop_opcode(uint16_t opcode, uint32_t pc, uint32_t &written, std::vector<idle_load> &loads);
+	bool idle_loop_body(uint32_t head, uint32_t branch, std::vector<idle_load> &loads);
+	bool idle_loop_loads_memory() const;
+	void idle_loop_check(uint32_t head, uint32_t branch);
+	void idle_loop_reset() { m_idle_head = ~0U; }
+
+	bool                m_idle_skip;                  /* fast-forward polling loops that provably repeat */
+	uint32_t            m_idle_head;                  /* head of the last loop classified */
+	uint32_t            m_idle_branch;                /* branch closing that loop */
+	bool                m_idle_candidate;             /* that loop body has no side effects */
+	std::vector<idle_load> m_idle_loads;              /* loads made by that loop body */
 
 	int m_cpu_type;
 	uint32_t m_am;
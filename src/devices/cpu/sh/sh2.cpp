@@ -480,6 +480,8 @@ void sh2_device::execute_run()
 		return;
 	}
 
+	idle_loop_reset();
+
 	do
 	{
 		debugger_instruction_hook(m_sh2_state->pc);
@@ -515,6 +517,9 @@ void sh2_device::device_start()
 {
 	sh_common_execution::device_start();
 
+	/* idle loop skipping is opt-in through the machine options */
+	m_idle_skip = idle_skip_enabled();
+
 	m_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(sh2_device::sh2_timer_callback), this));
 	m_timer->adjust(attotime::never);
 	m_wdtimer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(sh2_device::sh2_wdtimer_callback), this));
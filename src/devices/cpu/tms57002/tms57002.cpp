@@ -24,7 +24,7 @@ void tms57002_device::internal_pgm(address_map &map)
 tms57002_device::tms57002_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
 	: cpu_device(mconfig, TMS57002, tag, owner, clock)
 	, device_sound_interface(mconfig, *this)
-	, macc(0), macc_read(0), macc_write(0), st0(0), st1(0), sti(0), txrd(0)
+	, macc(0), macc_read(0), macc_write(0), st0(0), st1(0), sti(0), txrd(0), pc0_level(0)
 	, m_dready_callback(*this)
 	, m_pc0_callback(*this)
 	, m_empty_callback(*this)
@@ -200,7 +200,8 @@ READ_LINE_MEMBER(tms57002_device::pc0_r)
 
 void tms57002_device::update_pc0()
 {
-	m_pc0_callback(pc == 0 ? 0 : 1);
+	pc0_level = pc == 0 ? 0 : 1;
+	m_pc0_callback(pc0_level);
 }
 
 READ_LINE_MEMBER(tms57002_device::empty_r)
@@ -904,7 +905,8 @@ void tms57002_device::execute_run()
 		else
 		{
 			pc++; // Wraps if it reaches 256, next wraps too
-			update_pc0();
+			if ((pc != 0) != pc0_level) // only signal when leaving or returning to 0
+				update_pc0();
 		}
 
 		if (rptc_next)
@@ -1024,6 +1026,7 @@ void tms57002_device::device_start()
 	save_item(NAME(update_counter_head));
 	save_item(NAME(update_counter_tail));
 	save_item(NAME(allow_update));
+	save_item(NAME(pc0_level));
 }
 
 u32 tms57002_device::execute_min_cycles() const noexcept
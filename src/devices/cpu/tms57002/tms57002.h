@@ -141,7 +141,7 @@ private:
 
 	u32 xm_adr;
 
-	u8 host[4], hidx, allow_update;
+	u8 host[4], hidx, allow_update, pc0_level;
 
 	u32 update[16];
 	u8 update_counter_head, update_counter_tail;
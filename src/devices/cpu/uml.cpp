@@ -388,6 +388,29 @@ void uml::instruction::configure(opcode_t op, u8 size, parameter p0, parameter p
 }
 
 
+//-------------------------------------------------
+//  build - configure an opcode from an array of
+//  parameters
+//-------------------------------------------------
+
+void uml::instruction::build(opcode_t op, u8 size, parameter const *params, int numparams)
+{
+	assert(numparams <= MAX_PARAMS);
+
+	// fill in the instruction
+	m_opcode = opcode_t(u8(op));
+	m_size = size;
+	m_condition = COND_ALWAYS;
+	m_flags = 0;
+	m_numparams = numparams;
+	for (int pnum = 0; pnum < numparams; pnum++)
+		m_param[pnum] = params[pnum];
+
+	// validate
+	validate();
+}
+
+
 //-------------------------------------------------
 //  simplify - simplify instructions that have
 //  immediate values we can evaluate at compile
@@ -836,6 +859,72 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_count - return the number of parameters
+//  taken by the given opcode
+//-------------------------------------------------
+
+int uml::instruction::param_count(opcode_t op)
+{
+	opcode_info const &opinfo = s_opcode_info_table[op];
+	int count = 0;
+	while (count < MAX_PARAMS && opinfo.param[count].typemask != PTYPES_NONE)
+		count++;
+	return count;
+}
+
+
+//-------------------------------------------------
+//  param_is_input - return true if the given
+//  parameter is read by the opcode
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(opcode_t op, int paramnum)
+{
+	return (s_opcode_info_table[op].param[paramnum].output & PIO_IN) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if the given
+//  parameter is written by the opcode
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(opcode_t op, int paramnum)
+{
+	return (s_opcode_info_table[op].param[paramnum].output & PIO_OUT) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_allows - return true if the given
+//  parameter may be of the specified type
+//-------------------------------------------------
+
+bool uml::instruction::param_allows(opcode_t op, int paramnum, parameter::parameter_type type)
+{
+	return BIT(s_opcode_info_table[op].param[paramnum].typemask, type);
+}
+
+
+//-------------------------------------------------
+//  param_size - return the effective size in
+//  bytes of the given parameter, or 0 if it
+//  depends on the value of another parameter
+//-------------------------------------------------
+
+u8 uml::instruction::param_size(opcode_t op, u8 size, int paramnum)
+{
+	u8 const psize = s_opcode_info_table[op].param[paramnum].size;
+	if (psize == PSIZE_OP)
+		return size;
+	else if (psize & 0x80)
+		return 0;
+	else
+		return 1 << psize;
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
@@ -405,6 +405,20 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_immediate(int paramnum, u64 value) { assert(paramnum < m_numparams); assert(param_allows(paramnum, parameter::PTYPE_IMMEDIATE)); m_param[paramnum] = value; }
+
+		// parameter queries
+		bool param_is_input(int paramnum) const { assert(paramnum < m_numparams); return param_is_input(m_opcode, paramnum); }
+		bool param_is_output(int paramnum) const { assert(paramnum < m_numparams); return param_is_output(m_opcode, paramnum); }
+		bool param_allows(int paramnum, parameter::parameter_type type) const { assert(paramnum < m_numparams); return param_allows(m_opcode, paramnum, type); }
+		u8 param_size(int paramnum) const { assert(paramnum < m_numparams); return param_size(m_opcode, m_size, paramnum); }
+
+		// static opcode queries
+		static int param_count(opcode_t op);
+		static bool param_is_input(opcode_t op, int paramnum);
+		static bool param_is_output(opcode_t op, int paramnum);
+		static bool param_allows(opcode_t op, int paramnum, parameter::parameter_type type);
+		static u8 param_size(opcode_t op, u8 size, int paramnum);
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
@@ -413,6 +427,9 @@ namespace uml
 		u8 modified_flags() const;
 		void simplify();
 
+		// generic construction from a parameter list
+		void build(opcode_t op, u8 size, parameter const *params, int numparams);
+
 		// compile-time opcodes
 		void handle(code_handle &hand) { configure(OP_HANDLE, 4, hand); }
 		void hash(u32 mode, u32 pc) { configure(OP_HASH, 4, mode, pc); }
@@ -122,9 +122,11 @@ std::unique_ptr<util::disasm_interface> v60_device::create_disassembler()
 
 
 // memory accessors
-#define OpRead8(a)   m_pr8(a)
-#define OpRead16(a)  m_pr16(a)
-#define OpRead32(a)  m_pr32(a)
+// Instruction and addressing mode fetches go straight to the cache for
+// the bus width in use; only one of the two caches is ever set.
+#define OpRead8(a)   (m_cache32 ? m_cache32->read_byte(a) : m_cache16->read_byte(a))
+#define OpRead16(a)  (m_cache32 ? m_cache32->read_word_unaligned(a) : m_cache16->read_word_unaligned(a))
+#define OpRead32(a)  (m_cache32 ? m_cache32->read_dword_unaligned(a) : m_cache16->read_dword_unaligned(a))
 
 
 // macros stolen from MAME for flags calc
@@ -410,20 +412,12 @@ void v60_device::device_start()
 	m_moddim = 0;
 
 	m_program = &space(AS_PROGRAM);
+	m_cache16 = nullptr;
+	m_cache32 = nullptr;
 	if (m_program->data_width() == 16)
-	{
-		auto cache = m_program->cache<1, 0, ENDIANNESS_LITTLE>();
-		m_pr8  = [cache](offs_t address) -> u8  { return cache->read_byte(address); };
-		m_pr16 = [cache](offs_t address) -> u16 { return cache->read_word_unaligned(address); };
-		m_pr32 = [cache](offs_t address) -> u32 { return cache->read_dword_unaligned(address); };
-	}
+		m_cache16 = m_program->cache<1, 0, ENDIANNESS_LITTLE>();
 	else
-	{
-		auto cache = m_program->cache<2, 0, ENDIANNESS_LITTLE>();
-		m_pr8  = [cache](offs_t address) -> u8  { return cache->read_byte(address); };
-		m_pr16 = [cache](offs_t address) -> u16 { return cache->read_word_unaligned(address); };
-		m_pr32 = [cache](offs_t address) -> u32 { return cache->read_dword_unaligned(address); };
-	}
+		m_cache32 = m_program->cache<2, 0, ENDIANNESS_LITTLE>();
 
 	m_io = &space(AS_IO);
 
@@ -163,9 +163,8 @@ private:
 	uint8_t               m_irq_line;
 	uint8_t               m_nmi_line;
 	address_space *m_program;
-	std::function<u8  (offs_t)> m_pr8;
-	std::function<u16 (offs_t)> m_pr16;
-	std::function<u32 (offs_t)> m_pr32;
+	memory_access_cache<1, 0, ENDIANNESS_LITTLE> *m_cache16;  // V60 (16-bit bus)
+	memory_access_cache<2, 0, ENDIANNESS_LITTLE> *m_cache32;  // V70 (32-bit bus)
 	address_space *m_io;
 	uint32_t              m_PPC;
 	int                 m_icount;
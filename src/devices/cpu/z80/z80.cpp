@@ -481,9 +481,12 @@ inline uint8_t z80_device::rop()
 	unsigned pc = PCD;
 	PC++;
 	uint8_t res = m_opcodes_cache->read_byte(pc);
-	m_icount -= 2;
-	m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | ((m_r-1) & 0x7f), 0x00, 0xff);
-	m_icount += 2;
+	if (m_refresh_bound)
+	{
+		m_icount -= 2;
+		m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | ((m_r-1) & 0x7f), 0x00, 0xff);
+		m_icount += 2;
+	}
 	return res;
 }
 
@@ -546,8 +549,11 @@ inline void z80_device::push(PAIR &r)
  ***************************************************************/
 inline void z80_device::jp(void)
 {
+	const uint16_t branch = PC - 1;
 	PCD = arg16();
 	WZ = PCD;
+	if (m_idle_skip && PC <= branch)
+		idle_loop_check(PC, branch);
 }
 
 /***************************************************************
@@ -557,8 +563,11 @@ inline void z80_device::jp_cond(bool cond)
 {
 	if (cond)
 	{
+		const uint16_t branch = PC - 1;
 		PCD = arg16();
 		WZ = PCD;
+		if (m_idle_skip && PC <= branch)
+			idle_loop_check(PC, branch);
 	}
 	else
 	{
@@ -574,6 +583,8 @@ inline void z80_device::jr()
 	int8_t a = (int8_t)arg(); /* arg() also increments PC */
 	PC += a;                  /* so don't do PC += arg() */
 	WZ = PC;
+	if (m_idle_skip && a <= -2)
+		idle_loop_check(PC, PC - a - 2);
 }
 
 /***************************************************************
@@ -3458,7 +3469,11 @@ void z80_device::device_start()
 	m_cc_ex = cc_ex;
 
 	m_irqack_cb.resolve_safe();
+	/* most systems leave refresh unconnected; skip the per-opcode call for them */
+	m_refresh_bound = !m_refresh_cb.isnull();
 	m_refresh_cb.resolve_safe();
+
+	m_idle_skip = idle_skip_enabled();
 	m_halt_cb.resolve_safe();
 }
 
@@ -3494,11 +3509,225 @@ void nsc800_device::device_reset()
 	memset(m_nsc800_irq_state, 0, sizeof(m_nsc800_irq_state));
 }
 
+/****************************************************************************
+ * Idle loop detection: idle_loop_body() returns true if the code from head
+ * up to the branch at branch only reads memory and updates registers and
+ * flags, so each pass repeats the last while memory is unchanged.  Every
+ * load is recorded so idle_loop_check() can refuse loops that read from
+ * anything other than plain memory (status ports, latches, counters).
+ ****************************************************************************/
+bool z80_device::idle_loop_body(uint16_t head, uint16_t branch)
+{
+	if (uint16_t(branch - head) > 64)
+		return false;
+
+	// register pairs written by the body, so loads through them can be refused
+	enum { W_BC = 1, W_DE = 2, W_HL = 4, W_SP = 8, W_IX = 16, W_IY = 32 };
+	static const uint8_t reg8_pair[8] = { W_BC, W_BC, W_DE, W_DE, W_HL, W_HL, 0, 0 };
+	static const uint8_t reg16_pair[4] = { W_BC, W_DE, W_HL, W_SP };
+	uint8_t written = 0;
+
+	m_idle_loads.clear();
+	auto load = [this] (uint8_t base, uint16_t offset, uint8_t width) { m_idle_loads.push_back(idle_load{ base, offset, width }); };
+	auto absolute = [this] (uint16_t pc) -> uint16_t { return m_cache->read_byte(pc) | (m_cache->read_byte(uint16_t(pc + 1)) << 8); };
+
+	unsigned m1 = 1; // the branch itself
+	for (uint16_t pc = head; pc != branch; )
+	{
+		// an instruction running past the branch ends up here too
+		if (uint16_t(branch - pc) > 64)
+			return false;
+
+		const uint8_t op = m_opcodes_cache->read_byte(pc);
+		unsigned length = 0;
+		switch (op)
+		{
+			case 0x00: case 0x07: case 0x0f: case 0x17: case 0x1f: case 0x2f: case 0x37: case 0x3f: // NOP, rotates, CPL, SCF, CCF
+				length = 1;
+				break;
+
+			case 0x0a: case 0x1a:                                                                   // LD A,(BC), LD A,(DE)
+				load(op == 0x0a ? IDLE_LOAD_BC : IDLE_LOAD_DE, 0, 1);
+				length = 1;
+				break;
+
+			case 0x03: case 0x13: case 0x23: case 0x33: case 0x0b: case 0x1b: case 0x2b: case 0x3b: // INC rr, DEC rr
+				written |= reg16_pair[(op >> 4) & 3];
+				length = 1;
+				break;
+
+			case 0x09: case 0x19: case 0x29: case 0x39:                                             // ADD HL,rr
+			case 0x04: case 0x0c: case 0x14: case 0x1c: case 0x24: case 0x2c: case 0x3c:            // INC r
+			case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x3d:            // DEC r
+				written |= ((op & 0x0f) == 0x09) ? W_HL : reg8_pair[(op >> 3) & 7];
+				length = 1;
+				break;
+
+			case 0x06: case 0x0e: case 0x16: case 0x1e: case 0x26: case 0x2e: case 0x3e:            // LD r,n
+				written |= reg8_pair[(op >> 3) & 7];
+				length = 2;
+				break;
+
+			case 0xc6: case 0xce: case 0xd6: case 0xde: case 0xe6: case 0xee: case 0xf6: case 0xfe: // ALU n
+				length = 2;
+				break;
+
+			case 0x01: case 0x11: case 0x21: case 0x31:                                             // LD rr,nn
+				written |= reg16_pair[(op >> 4) & 3];
+				length = 3;
+				break;
+
+			case 0x2a: case 0x3a:                                                                   // LD HL,(nn), LD A,(nn)
+				if (op == 0x2a)
+					written |= W_HL;
+				load(IDLE_LOAD_ABSOLUTE, absolute(uint16_t(pc + 1)), op == 0x2a ? 2 : 1);
+				length = 3;
+				break;
+
+			case 0xcb:
+			{
+				// BIT b,r/(HL), and rotates and shifts of registers
+				const uint8_t op2 = m_opcodes_cache->read_byte(uint16_t(pc + 1));
+				if (op2 >= 0x40 && op2 < 0x80)
+				{
+					if ((op2 & 7) == 6)
+						load(IDLE_LOAD_HL, 0, 1);
+					length = 2;
+				}
+				else if (op2 < 0x40 && (op2 & 7) != 6)
+				{
+					written |= reg8_pair[op2 & 7];
+					length = 2;
+				}
+				m1++;
+				break;
+			}
+
+			case 0xdd: case 0xfd:
+			{
+				const uint8_t op2 = m_opcodes_cache->read_byte(uint16_t(pc + 1));
+				const uint8_t base = (op == 0xdd) ? IDLE_LOAD_IX : IDLE_LOAD_IY;
+				const uint16_t disp = int8_t(m_cache->read_byte(uint16_t(pc + 2)));
+				switch (op2)
+				{
+					case 0x46: case 0x4e: case 0x56: case 0x5e: case 0x66: case 0x6e: case 0x7e:    // LD r,(IX+d)
+						written |= reg8_pair[(op2 >> 3) & 7];
+						load(base, disp, 1);
+						length = 3;
+						break;
+					case 0x86: case 0x8e: case 0x96: case 0x9e: case 0xa6: case 0xae: case 0xb6: case 0xbe: // ALU (IX+d)
+						load(base, disp, 1);
+						length = 3;
+						break;
+					case 0x21:                                                                      // LD IX,nn
+						written |= (op == 0xdd) ? W_IX : W_IY;
+						length = 4;
+						break;
+					case 0x2a:                                                                      // LD IX,(nn)
+						written |= (op == 0xdd) ? W_IX : W_IY;
+						load(IDLE_LOAD_ABSOLUTE, absolute(uint16_t(pc + 2)), 2);
+						length = 4;
+						break;
+					case 0xcb:                                                                      // BIT b,(IX+d)
+						if ((m_cache->read_byte(uint16_t(pc + 3)) & 0xc0) == 0x40)
+						{
+							load(base, disp, 1);
+							length = 4;
+						}
+						break;
+				}
+				m1++;
+				break;
+			}
+
+			case 0xed:
+			{
+				const uint8_t op2 = m_opcodes_cache->read_byte(uint16_t(pc + 1));
+				if (op2 == 0x4b || op2 == 0x5b || op2 == 0x6b || op2 == 0x7b)                     // LD rr,(nn)
+				{
+					written |= reg16_pair[(op2 >> 4) & 3];
+					load(IDLE_LOAD_ABSOLUTE, absolute(uint16_t(pc + 2)), 2);
+					length = 4;
+				}
+				m1++;
+				break;
+			}
+
+			default:
+				// LD r,r' and LD r,(HL) but not stores or HALT, then ADD/ADC/SUB/SBC/AND/XOR/OR/CP
+				if ((op >= 0x40 && op < 0x70) || (op >= 0x78 && op < 0xc0))
+				{
+					if (op < 0x80)
+						written |= reg8_pair[(op >> 3) & 7];
+					if ((op & 7) == 6)
+						load(IDLE_LOAD_HL, 0, 1);
+					length = 1;
+				}
+				break;
+		}
+
+		if (length == 0)
+			return false;
+		pc += length;
+		m1++;
+	}
+
+	// a load through a pair the body changes has no fixed address
+	static const uint8_t load_pair[] = { 0, W_BC, W_DE, W_HL, W_IX, W_IY };
+	for (const idle_load &l : m_idle_loads)
+		if (written & load_pair[l.base])
+			return false;
+
+	m_idle_m1 = m1;
+	return true;
+}
+
+bool z80_device::idle_loop_loads_memory() const
+{
+	// only memory-backed addresses are known not to change within a timeslice
+	for (const idle_load &l : m_idle_loads)
+	{
+		uint16_t address = l.offset;
+		switch (l.base)
+		{
+			case IDLE_LOAD_BC: address += BC; break;
+			case IDLE_LOAD_DE: address += DE; break;
+			case IDLE_LOAD_HL: address += HL; break;
+			case IDLE_LOAD_IX: address += IX; break;
+			case IDLE_LOAD_IY: address += IY; break;
+		}
+		for (int i = 0; i < l.width; i++)
+			if (!m_program->get_read_ptr(uint16_t(address + i)))
+				return false;
+	}
+	return true;
+}
+
+void z80_device::idle_loop_check(uint16_t head, uint16_t branch)
+{
+	const uint32_t loop = (uint32_t(branch) << 16) | head;
+	if (loop != m_idle_loop)
+	{
+		m_idle_loop = loop;
+		m_idle_candidate = idle_loop_body(head, branch);
+	}
+
+	if (m_idle_candidate && idle_loop_loads_memory())
+	{
+		// skipped passes still fetched opcodes
+		const uint16_t state[] = { AF, BC, DE, HL, IX, IY, SP, WZ };
+		m_r += idle_loop_pass(head, state, sizeof(state)) * m_idle_m1;
+	}
+}
+
 /****************************************************************************
  * Execute 'cycles' T-states.
  ****************************************************************************/
 void z80_device::execute_run()
 {
+	// code may have changed since the last timeslice
+	m_idle_loop = ~0U;
+
 	do
 	{
 		if (m_wait_state)
@@ -3707,7 +3936,12 @@ z80_device::z80_device(const machine_config &mconfig, device_type type, const ch
 	m_io_config("io", ENDIANNESS_LITTLE, 8, 16, 0),
 	m_irqack_cb(*this),
 	m_refresh_cb(*this),
-	m_halt_cb(*this)
+	m_halt_cb(*this),
+	m_refresh_bound(false),
+	m_idle_skip(false),
+	m_idle_loop(~0U),
+	m_idle_candidate(false),
+	m_idle_m1(0)
 {
 }
 
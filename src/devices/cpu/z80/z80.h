@@ -231,6 +231,18 @@ protected:
 
 	void take_interrupt();
 	void take_nmi();
+	bool idle_loop_body(uint16_t head, uint16_t branch);
+	bool idle_loop_loads_memory() const;
+	void idle_loop_check(uint16_t head, uint16_t branch);
+
+	// a load made by an idle loop candidate, from an absolute address or through a register
+	enum : uint8_t { IDLE_LOAD_ABSOLUTE, IDLE_LOAD_BC, IDLE_LOAD_DE, IDLE_LOAD_HL, IDLE_LOAD_IX, IDLE_LOAD_IY };
+	struct idle_load
+	{
+		uint8_t     base;
+		uint16_t    offset;
+		uint8_t     width;
+	};
 
 	// address spaces
 	const address_space_config m_program_config;
@@ -244,6 +256,12 @@ protected:
 	devcb_write_line m_irqack_cb;
 	devcb_write8 m_refresh_cb;
 	devcb_write_line m_halt_cb;
+	bool            m_refresh_bound;      // refresh callback has a real handler
+	bool            m_idle_skip;          // fast-forward polling loops that provably repeat
+	uint32_t        m_idle_loop;          // branch and head of the last loop classified
+	bool            m_idle_candidate;     // that loop body has no side effects
+	uint8_t         m_idle_m1;            // opcode fetches per pass, for the R register
+	std::vector<idle_load> m_idle_loads;  // loads made by that loop body
 
 	PAIR            m_prvpc;
 	PAIR            m_pc;
@@ -104,6 +104,15 @@ void harddisk_image_device::device_start()
 	{
 		m_hard_disk_handle = nullptr;
 	}
+
+	// cached writes must reach the disk before a save state is taken
+	machine().save().register_presave(save_prepost_delegate(FUNC(harddisk_image_device::presave), this));
+}
+
+void harddisk_image_device::presave()
+{
+	if (m_hard_disk_handle != nullptr)
+		hard_disk_flush(m_hard_disk_handle);
 }
 
 void harddisk_image_device::device_stop()
@@ -69,6 +69,7 @@ protected:
 	virtual const software_list_loader &get_software_list_loader() const override { return rom_software_list_loader::instance(); }
 
 	image_init_result internal_load_hd();
+	void presave();
 
 	chd_file        *m_chd;
 	chd_file        m_origchd;              /* handle to the original CHD */
@@ -431,16 +431,16 @@ image_init_result mfm_harddisk_device::call_load()
 	if (loaded==image_init_result::PASS)
 	{
 		std::string metadata;
-		chd_file* chdfile = get_chd_file();
+		hard_disk_file* hdfile = get_hard_disk_file();
 
-		if (chdfile==nullptr)
+		if (hdfile==nullptr || m_chd==nullptr)
 		{
 			LOG("chdfile is null\n");
 			return image_init_result::FAIL;
 		}
 
 		// Read the hard disk metadata
-		chd_error state = chdfile->read_metadata(HARD_DISK_METADATA_TAG, 0, metadata);
+		chd_error state = hard_disk_read_metadata(hdfile, HARD_DISK_METADATA_TAG, 0, metadata);
 		if (state != CHDERR_NONE)
 		{
 			LOG("Failed to read CHD metadata\n");
@@ -474,7 +474,7 @@ image_init_result mfm_harddisk_device::call_load()
 		param.write_precomp_cylinder = -1;
 		param.reduced_wcurr_cylinder = -1;
 
-		state = chdfile->read_metadata(MFM_HARD_DISK_METADATA_TAG, 0, metadata);
+		state = hard_disk_read_metadata(hdfile, MFM_HARD_DISK_METADATA_TAG, 0, metadata);
 		if (state != CHDERR_NONE)
 		{
 			LOGMASKED(LOG_WARN, "Failed to read CHD sector arrangement/recording specs, applying defaults\n");
@@ -493,7 +493,7 @@ image_init_result mfm_harddisk_device::call_load()
 			LOGMASKED(LOG_CONFIG, "MFM HD rec specs: interleave=%d, cylskew=%d, headskew=%d, wpcom=%d, rwc=%d\n",
 				param.interleave, param.cylskew, param.headskew, param.write_precomp_cylinder, param.reduced_wcurr_cylinder);
 
-		state = chdfile->read_metadata(MFM_HARD_DISK_METADATA_TAG, 1, metadata);
+		state = hard_disk_read_metadata(hdfile, MFM_HARD_DISK_METADATA_TAG, 1, metadata);
 		if (state != CHDERR_NONE)
 		{
 			LOGMASKED(LOG_WARN, "Failed to read CHD track gap specs, applying defaults\n");
@@ -559,9 +559,7 @@ void mfm_harddisk_device::call_unload()
 		if (m_format->save_param(MFMHD_IL) && !params->equals_rec(oldparams))
 		{
 			LOGMASKED(LOG_WARN, "MFM HD sector arrangement and recording specs have changed; updating CHD metadata\n");
-			chd_file* chdfile = get_chd_file();
-
-			chd_error err = chdfile->write_metadata(MFM_HARD_DISK_METADATA_TAG, 0, string_format(MFMHD_REC_METADATA_FORMAT, params->interleave, params->cylskew, params->headskew, params->write_precomp_cylinder, params->reduced_wcurr_cylinder), 0);
+			chd_error err = hard_disk_write_metadata(get_hard_disk_file(), MFM_HARD_DISK_METADATA_TAG, 0, string_format(MFMHD_REC_METADATA_FORMAT, params->interleave, params->cylskew, params->headskew, params->write_precomp_cylinder, params->reduced_wcurr_cylinder), 0);
 			if (err != CHDERR_NONE)
 			{
 				LOGMASKED(LOG_WARN, "Failed to save MFM HD sector arrangement/recording specs to CHD\n");
@@ -571,9 +569,7 @@ void mfm_harddisk_device::call_unload()
 		if (m_format->save_param(MFMHD_GAP1) && !params->equals_gap(oldparams))
 		{
 			LOGMASKED(LOG_WARN, "MFM HD track gap specs have changed; updating CHD metadata\n");
-			chd_file* chdfile = get_chd_file();
-
-			chd_error err = chdfile->write_metadata(MFM_HARD_DISK_METADATA_TAG, 1, string_format(MFMHD_GAP_METADATA_FORMAT, params->gap1, params->gap2, params->gap3, params->sync, params->headerlen, params->ecctype), 0);
+			chd_error err = hard_disk_write_metadata(get_hard_disk_file(), MFM_HARD_DISK_METADATA_TAG, 1, string_format(MFMHD_GAP_METADATA_FORMAT, params->gap1, params->gap2, params->gap3, params->sync, params->headerlen, params->ecctype), 0);
 			if (err != CHDERR_NONE)
 			{
 				LOGMASKED(LOG_WARN, "Failed to save MFM HD track gap specs to CHD\n");
@@ -12,6 +12,10 @@
     discrete sound circuits where proper low-level simulation isn't
     available.  Also used for tape loops and similar.
 
+    Samples are decoded on a work queue after the files have been
+    opened, so long sample sets don't hold up machine startup. Playing
+    a sample that has not been decoded yet waits for it.
+
     Current limitations
       - Only supports single channel samples!
 
@@ -58,7 +62,20 @@ samples_device::samples_device(const machine_config &mconfig, device_type type,
 	, m_channels(0)
 	, m_names(nullptr)
 	, m_samples_start_cb(*this)
+	, m_samples_loaded(0)
+	, m_work_queue(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~samples_device - destructor
+//-------------------------------------------------
+
+samples_device::~samples_device()
 {
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 
@@ -79,6 +96,9 @@ void samples_device::start(uint8_t channel, uint32_t samplenum, bool loop)
 	assert(samplenum < m_sample.size());
 	assert(channel < m_channels);
 
+	// make sure the sample has been decoded
+	wait_for_samples(samplenum + 1);
+
 	// force an update before we start
 	channel_t &chan = m_channel[channel];
 	chan.stream->update();
@@ -236,8 +256,14 @@ bool samples_device::playing(uint8_t channel) const
 
 void samples_device::device_start()
 {
-	// read audio samples
-	load_samples();
+	// open audio samples and decode them in the background
+	open_samples();
+	m_samples_loaded = 0;
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_work_queue != nullptr)
+		osd_work_item_queue(m_work_queue, load_samples_async, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+	else
+		load_samples_async(this, 0);
 
 	// allocate channels
 	m_channel.resize(m_channels);
@@ -280,6 +306,17 @@ void samples_device::device_reset()
 }
 
 
+//-------------------------------------------------
+//  device_stop - handle device shutdown
+//-------------------------------------------------
+
+void samples_device::device_stop()
+{
+	// make sure the decoder is done with our samples
+	wait_for_samples(m_sample.size());
+}
+
+
 //-------------------------------------------------
 //  device_post_load - handle updating after a
 //  restore
@@ -287,6 +324,9 @@ void samples_device::device_reset()
 
 void samples_device::device_post_load()
 {
+	// samples may be attached below
+	wait_for_samples(m_sample.size());
+
 	// loop over channels
 	for (int channel = 0; channel < m_channels; channel++)
 	{
@@ -592,14 +632,17 @@ bool samples_device::read_flac_sample(emu_file &file, sample_t &sample)
 
 
 //-------------------------------------------------
-//  load_samples - load all the samples in our
-//  attached interface
-//  Returns true when all samples were successfully read, else false
+//  open_samples - open the files for all the
+//  samples in our attached interface
+//  Returns true when all samples were found, else false
 //-------------------------------------------------
 
-bool samples_device::load_samples()
+bool samples_device::open_samples()
 {
 	bool ok = true;
+	m_sample.clear();
+	m_sample_file.clear();
+
 	// if the user doesn't want to use samples, bail
 	if (!machine().options().samples())
 		return false;
@@ -609,28 +652,29 @@ bool samples_device::load_samples()
 	samples_iterator iter(*this);
 	const char *altbasename = iter.altbasename();
 
-	// pre-size the array
+	// pre-size the arrays
 	m_sample.resize(iter.count());
+	m_sample_file.resize(m_sample.size());
 
-	// load the samples
+	// open the samples
 	int index = 0;
 	for (const char *samplename = iter.first(); samplename != nullptr; index++, samplename = iter.next())
 	{
 		// attempt to open as FLAC first
-		emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
-		osd_file::error filerr = file.open(basename, PATH_SEPARATOR, samplename, ".flac");
+		auto file = std::make_unique<emu_file>(machine().options().sample_path(), OPEN_FLAG_READ);
+		osd_file::error filerr = file->open(basename, PATH_SEPARATOR, samplename, ".flac");
 		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".flac");
+			filerr = file->open(altbasename, PATH_SEPARATOR, samplename, ".flac");
 
 		// if not, try as WAV
 		if (filerr != osd_file::error::NONE)
-			filerr = file.open(basename, PATH_SEPARATOR, samplename, ".wav");
+			filerr = file->open(basename, PATH_SEPARATOR, samplename, ".wav");
 		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".wav");
+			filerr = file->open(altbasename, PATH_SEPARATOR, samplename, ".wav");
 
-		// if opened, read it
+		// if opened, keep it for reading
 		if (filerr == osd_file::error::NONE)
-			read_sample(file, m_sample[index]);
+			m_sample_file[index] = std::move(file);
 		else if (filerr == osd_file::error::NOT_FOUND)
 		{
 			logerror("%s: Sample '%s' NOT FOUND\n", tag(), samplename);
@@ -639,3 +683,50 @@ bool samples_device::load_samples()
 	}
 	return ok;
 }
+
+
+//-------------------------------------------------
+//  load_samples - load all the samples in our
+//  attached interface
+//  Returns true when all samples were successfully read, else false
+//-------------------------------------------------
+
+bool samples_device::load_samples()
+{
+	bool const ok = open_samples();
+	load_samples_async(this, 0);
+	return ok;
+}
+
+
+//-------------------------------------------------
+//  load_samples_async - decode all opened
+//  samples, called on the work queue
+//-------------------------------------------------
+
+void *samples_device::load_samples_async(void *param, int threadid)
+{
+	samples_device &dev = *reinterpret_cast<samples_device *>(param);
+	for (uint32_t index = 0; index < dev.m_sample.size(); index++)
+	{
+		if (dev.m_sample_file[index])
+		{
+			read_sample(*dev.m_sample_file[index], dev.m_sample[index]);
+			dev.m_sample_file[index].reset();
+		}
+		dev.m_samples_loaded.store(index + 1, std::memory_order_release);
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  wait_for_samples - wait until the first count
+//  samples have been decoded
+//-------------------------------------------------
+
+void samples_device::wait_for_samples(uint32_t count)
+{
+	while (m_samples_loaded.load(std::memory_order_acquire) < count)
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+}
@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <atomic>
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -37,6 +39,7 @@ public:
 
 	// construction/destruction
 	samples_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock = 0);
+	virtual ~samples_device();
 
 	// configuration helpers
 	void set_channels(uint8_t channels) { m_channels = channels; }
@@ -82,6 +85,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 	virtual void device_post_load() override;
 
 	// device_sound_interface overrides
@@ -105,13 +109,19 @@ protected:
 	// internal helpers
 	static bool read_wav_sample(emu_file &file, sample_t &sample);
 	static bool read_flac_sample(emu_file &file, sample_t &sample);
+	bool open_samples();
 	bool load_samples();
+	static void *load_samples_async(void *param, int threadid);
+	void wait_for_samples(uint32_t count);
 
 	start_cb_delegate m_samples_start_cb; // optional callback
 
 	// internal state
 	std::vector<channel_t>    m_channel;
 	std::vector<sample_t>     m_sample;
+	std::vector<std::unique_ptr<emu_file>> m_sample_file; // opened files still to be decoded
+	std::atomic<uint32_t>     m_samples_loaded;         // number of samples decoded so far
+	osd_work_queue *          m_work_queue;             // work queue for decoding
 
 	// internal constants
 	static constexpr uint8_t FRAC_BITS = 24;
@@ -216,6 +216,7 @@ sega315_5313_device::sega315_5313_device(const machine_config &mconfig, const ch
 	, m_video_renderline(nullptr)
 	, m_palette_lookup(nullptr)
 	, m_space68k(nullptr)
+	, m_cache68k(nullptr)
 	, m_cpu68k(*this, finder_base::DUMMY_TAG)
 	, m_ext_palette(*this, finder_base::DUMMY_TAG)
 	, m_gfx_palette(*this, "gfx_palette")
@@ -365,6 +366,7 @@ void sega315_5313_device::device_start()
 	m_render_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(sega315_5313_device::render_scanline), this));
 
 	m_space68k = &m_cpu68k->space();
+	m_cache68k = m_space68k->cache<1, 0, ENDIANNESS_BIG>();
 
 	sega315_5313_mode4_device::device_start();
 
@@ -634,9 +636,9 @@ inline u16 sega315_5313_device::vdp_get_word_from_68k_mem(u32 source)
 	//printf("vdp_get_word_from_68k_mem_default %08x\n", source);
 
 	if (source <= 0x3fffff)
-		return m_space68k->read_word(source - m_dma_delay);    // compensate DMA lag
+		return m_cache68k->read_word(source - m_dma_delay);    // compensate DMA lag
 	else if ((source >= 0xe00000) && (source <= 0xffffff))
-		return m_space68k->read_word(source);
+		return m_cache68k->read_word(source);
 	else
 	{
 		printf("DMA Read unmapped %06x\n", source);
@@ -229,6 +229,7 @@ private:
 	std::unique_ptr<u16[]> m_palette_lookup;
 
 	address_space *m_space68k;
+	memory_access_cache<1, 0, ENDIANNESS_BIG> *m_cache68k;
 	required_device<m68000_base_device> m_cpu68k;
 	optional_device<palette_device> m_ext_palette;
 
@@ -449,6 +449,7 @@ uint32_t vga_device::start_addr()
 
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	uint8_t ch, attr;
 	uint8_t bits;
 	uint32_t font_base;
@@ -490,7 +491,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 
@@ -503,7 +504,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 				}
@@ -514,7 +515,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 						(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
 						h++)
 				{
-					if(!screen().visible_area().contains(column*width, line+h))
+					if(!visarea.contains(column*width, line+h))
 						continue;
 					bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
 				}
@@ -525,6 +526,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	int pos, line, column, c, addr, i, yi;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	uint32_t *bitmapline;
@@ -559,7 +561,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 					data[2]>>=1;
 					data[3]>>=1;
 
-					if(!screen().visible_area().contains(c+i-pel_shift, line + yi))
+					if(!visarea.contains(c+i-pel_shift, line + yi))
 						continue;
 					bitmapline[c+i-pel_shift] = pen;
 				}
@@ -571,6 +573,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 /* TODO: I'm guessing that in 256 colors mode every pixel actually outputs two pixels. Is it right? */
 void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	int pos, line, column, c, addr, curr_addr;
 	uint32_t *bitmapline;
 	uint16_t mask_comp;
@@ -607,7 +610,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<8;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-(pel_shift)] = pen(vga.memory[(pos & addrmask)+((xi >> 1)*0x10000)]);
 					}
@@ -634,7 +637,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<0x10;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-pel_shift] = pen(vga.memory[(pos+(xi >> 1)) & addrmask]);
 					}
@@ -646,6 +649,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	uint32_t *bitmapline;
 	int height = (vga.crtc.scan_doubling + 1);
 	int x,xi,y,yi;
@@ -668,7 +672,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(xi=0;xi<4;xi++)
 				{
 					pen = vga.pens[(vga.memory[addr] >> (6-xi*2)) & 3];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -681,6 +685,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	uint32_t *bitmapline;
 	int height = (vga.crtc.scan_doubling + 1);
 	int x,xi,y,yi;
@@ -703,7 +708,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(xi=0;xi<8;xi++)
 				{
 					pen = vga.pens[(vga.memory[addr] >> (7-xi)) & 1];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -716,6 +721,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	int pos, line, column, c, addr, curr_addr;
 	uint32_t *bitmapline;
 	uint16_t mask_comp;
@@ -754,7 +760,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<8;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi, line + yi))
+						if(!visarea.contains(c+xi, line + yi))
 							continue;
 						bitmapline[c+xi] = pen(vga.memory[(pos+(xi))]);
 					}
@@ -766,6 +772,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	#define IV 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -793,7 +800,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				r = (MV(pos+xm)&0x7c00)>>10;
@@ -810,6 +817,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	#define IV 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -837,7 +845,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				r = (MV(pos+xm)&0xf800)>>11;
@@ -854,6 +862,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	#define ID 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -881,7 +890,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				r = (MD(pos+xm)&0xff0000)>>16;
@@ -895,6 +904,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	#define ID 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -922,7 +932,7 @@ void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				r = (MD(pos+xm)&0xff0000)>>16;
@@ -64,6 +64,7 @@ public:
 	static constexpr uint8_t FLAG_INCLUDE_BOTTOM_EDGE = 0x01;
 	static constexpr uint8_t FLAG_INCLUDE_RIGHT_EDGE  = 0x02;
 	static constexpr uint8_t FLAG_NO_WORK_QUEUE       = 0x04;
+	static constexpr uint8_t FLAG_BINNED              = 0x08;   // queue nothing until wait(), then hand each scanline bucket to one worker
 
 	// each vertex has an X/Y coordinate and a set of parameters
 	struct vertex_t
@@ -251,6 +252,27 @@ private:
 		return polygon;
 	}
 
+	// link a new unit into its bucket; normally each unit waits on the one
+	// before it, but binned units are chained first to last and each chain
+	// is queued as a single work item when we wait
+	void bucket_unit(uint32_t bucketnum, uint32_t unit_index, work_unit &unit)
+	{
+		if (!m_binned)
+			unit.previtem = m_unit_bucket[bucketnum];
+		else
+		{
+			unit.previtem = 0xffff;
+			if (m_unit_bucket[bucketnum] == 0xffff)
+				m_bin_head[bucketnum] = unit_index;
+			else
+			{
+				work_unit &prevunit = m_unit[m_unit_bucket[bucketnum]];
+				prevunit.count_next = (prevunit.count_next & 0xffff) | (unit_index << 16);
+			}
+		}
+		m_unit_bucket[bucketnum] = unit_index;
+	}
+
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
@@ -266,9 +288,11 @@ private:
 
 	// misc data
 	uint8_t const         m_flags;                    // flags
+	bool const            m_binned;                   // defer work until wait() and run it by bucket
 
 	// buckets
 	uint16_t              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	uint16_t              m_bin_head[TOTAL_BUCKETS];  // first unit in each bucket, when binned
 
 	// statistics
 	uint32_t              m_tiles;                    // number of tiles queued
@@ -309,6 +333,7 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 	, m_object(machine, *this)
 	, m_unit(machine, *this)
 	, m_flags(flags)
+	, m_binned((flags & FLAG_BINNED) && !(flags & FLAG_NO_WORK_QUEUE))
 	, m_tiles(0)
 	, m_triangles(0)
 	, m_quads(0)
@@ -443,6 +468,14 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	if (POLY_LOG_WAITS)
 		time = get_profile_ticks();
 
+	// binned work goes out now, one item per bucket, so no two workers share scanlines
+	if (m_binned)
+	{
+		for (int bucketnum = 0; bucketnum < TOTAL_BUCKETS; bucketnum++)
+			if (m_unit_bucket[bucketnum] != 0xffff)
+				osd_work_item_queue(m_queue, work_item_callback, &m_unit[m_bin_head[bucketnum]], WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+
 	// wait for all pending work items to complete
 	if (m_queue != nullptr)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
@@ -584,8 +617,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_til
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v2yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(bucketnum, unit_index, unit);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -611,7 +643,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_til
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !m_binned)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
@@ -742,8 +774,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(bucketnum, unit_index, unit);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -799,7 +830,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !m_binned)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
@@ -875,8 +906,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 		unit.polygon = &polygon;
 		unit.count_next = std::min(v3yclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(bucketnum, unit_index, unit);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -915,7 +945,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !m_binned)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the object
@@ -1050,8 +1080,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_pol
 		unit.polygon = &polygon;
 		unit.count_next = std::min(maxyclip - curscan, scaninc);
 		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		bucket_unit(bucketnum, unit_index, unit);
 
 		// iterate over extents
 		for (int extnum = 0; extnum < unit.count_next; extnum++)
@@ -1114,7 +1143,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_pol
 	}
 
 	// enqueue the work items
-	if (m_queue != nullptr)
+	if (m_queue != nullptr && !m_binned)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	// return the total number of pixels in the triangle
@@ -982,8 +982,6 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	} \
 	TRANSPARENCYSETUP
 
-#define FLATPOLYGONUPDATE
-#define FLATRECTANGEUPDATE
 #define GOURAUDPOLYGONUPDATE \
 	n_r.d += n_dr; \
 	n_g.d += n_dg; \
@@ -1026,6 +1024,51 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		break; \
 	}
 
+/* as SOLIDFILL, for spans where the colour doesn't change across the span; */
+/* the vram stores may alias the shade tables, so the lookups are done once */
+#define FLATFILL \
+	if( n_distance > ( (int32_t)n_drawarea_x2 - drawx ) + 1 ) \
+	{ \
+		n_distance = ( n_drawarea_x2 - drawx ) + 1; \
+	} \
+	uint16_t *p_vram = p_p_vram[ drawy ] + drawx; \
+	\
+	switch( n_cmd & 0x02 ) \
+	{ \
+	case 0x00: \
+		{ \
+			/* transparency off */ \
+			const uint16_t n_bgr = \
+				p_n_redshade[ MID_LEVEL | n_r.w.h ] | \
+				p_n_greenshade[ MID_LEVEL | n_g.w.h ] | \
+				p_n_blueshade[ MID_LEVEL | n_b.w.h ]; \
+			while( n_distance > 0 ) \
+			{ \
+				WRITE_PIXEL( n_bgr ) \
+				p_vram++; \
+				n_distance--; \
+			} \
+		} \
+		break; \
+	case 0x02: \
+		{ \
+			/* transparency on */ \
+			const uint16_t n_redf = p_n_f[ MID_LEVEL | n_r.w.h ]; \
+			const uint16_t n_greenf = p_n_f[ MID_LEVEL | n_g.w.h ]; \
+			const uint16_t n_bluef = p_n_f[ MID_LEVEL | n_b.w.h ]; \
+			while( n_distance > 0 ) \
+			{ \
+				WRITE_PIXEL( \
+					p_n_redtrans[ n_redf | p_n_redb[ *( p_vram ) ] ] | \
+					p_n_greentrans[ n_greenf | p_n_greenb[ *( p_vram ) ] ] | \
+					p_n_bluetrans[ n_bluef | p_n_blueb[ *( p_vram ) ] ] ) \
+				p_vram++; \
+				n_distance--; \
+			} \
+		} \
+		break; \
+	}
+
 #define FLATTEXTUREDPOLYGONUPDATE \
 	n_u.d += n_du; \
 	n_v.d += n_dv;
@@ -1526,7 +1569,7 @@ void psxgpu_device::FlatPolygon( int n_points )
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATPOLYGONUPDATE )
+			FLATFILL
 		}
 
 		n_cx1.d += n_dx1;
@@ -2352,7 +2395,7 @@ void psxgpu_device::FlatRectangle()
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 
 		n_y++;
@@ -2401,7 +2444,7 @@ void psxgpu_device::FlatRectangle8x8()
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 
 		n_y++;
@@ -2450,7 +2493,7 @@ void psxgpu_device::FlatRectangle16x16()
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 
 		n_y++;
@@ -616,6 +616,9 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 	uint32_t palette_base = m_mode == 0 ? layer_idx << 5 : 0;
 	uint32_t palette_shift = 2 << layer.tile_mode;
 
+	/* bitplanes 0-1, 2-3 and 4-7 sit in bits 0-15, 16-31 and 32-63 of the row data */
+	uint64_t plane_mask = layer.tile_mode >= SNES_COLOR_DEPTH_8BPP ? ~uint64_t(0) : layer.tile_mode >= SNES_COLOR_DEPTH_4BPP ? 0xffffffffU : 0xffffU;
+
 	uint32_t hscroll = layer.hoffs;
 	uint32_t vscroll = layer.voffs;
 	uint32_t hmask = (width << layer.tile_size << (layer.tilemap_size & 1)) - 1;
@@ -701,6 +704,14 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 		data |= (uint64_t)m_vram[address +  48] << 48;
 		data |= (uint64_t)m_vram[address +  49] << 56;
 
+		/* a tile row with no set bits in the planes it uses is wholly transparent; */
+		/* without mosaic nothing carries over between pixels, so skip it outright */
+		if (!layer.mosaic_enabled && !(data & plane_mask))
+		{
+			x += 8;
+			continue;
+		}
+
 		for (uint32_t tilex = 0; tilex < 8; tilex++, x++)
 		{
 			if (x & width) continue;
@@ -1257,15 +1268,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		uint8_t window_above[256];
 		uint8_t window_below[256];
 
-		/* Clear priority */
-		memset(m_scanlines[SNES_MAINSCREEN].priority, 0, SNES_SCR_WIDTH);
-		memset(m_scanlines[SNES_SUBSCREEN].priority, 0, SNES_SCR_WIDTH);
-
-		/* Clear layers */
-		memset(m_scanlines[SNES_MAINSCREEN].layer, SNES_COLOR, SNES_SCR_WIDTH);
-		memset(m_scanlines[SNES_SUBSCREEN].layer, SNES_COLOR, SNES_SCR_WIDTH);
-
-		/* Clear blend_exception (only used for OAM) */
+		/* Clear blend_exception (only used for OAM); priority and layer are reset with the backdrop below */
 		memset(m_scanlines[SNES_MAINSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
 		memset(m_scanlines[SNES_SUBSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
 
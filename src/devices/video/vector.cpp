@@ -156,25 +156,30 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 	int lastx = 0;
 	int lasty = 0;
 
-	curpoint = m_vector_list.get();
-
-	screen.container().empty();
-	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
-
-	for (int i = 0; i < m_vector_index; i++)
+	// the beam width only depends on the intensity, so compute it once per level
+	float beam_width[256];
+	for (int level = 0; level < 256; level++)
 	{
-		render_bounds coords;
-
-		float intensity = (float)curpoint->intensity / 255.0f;
+		float intensity = (float)level / 255.0f;
 		float intensity_weight = normalized_sigmoid(intensity, vector_options::s_beam_intensity_weight);
 
 		// check for static intensity
-		float beam_width = m_min_intensity == m_max_intensity
+		float width = m_min_intensity == m_max_intensity
 			? vector_options::s_beam_width_min
 			: vector_options::s_beam_width_min + intensity_weight * (vector_options::s_beam_width_max - vector_options::s_beam_width_min);
 
 		// normalize width
-		beam_width *= 1.0f / (float)VECTOR_WIDTH_DENOM;
+		beam_width[level] = width * (1.0f / (float)VECTOR_WIDTH_DENOM);
+	}
+
+	curpoint = m_vector_list.get();
+
+	screen.container().empty();
+	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
+
+	for (int i = 0; i < m_vector_index; i++)
+	{
+		render_bounds coords;
 
 		coords.x0 = ((float)lastx - xoffs) * xscale;
 		coords.y0 = ((float)lasty - yoffs) * yscale;
@@ -185,7 +190,7 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 		{
 			screen.container().add_line(
 				coords.x0, coords.y0, coords.x1, coords.y1,
-				beam_width,
+				beam_width[curpoint->intensity],
 				(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
 				flags);
 		}
@@ -2629,12 +2629,21 @@ inline bool ATTR_FORCE_INLINE voodoo_device::combineColor(voodoo_device *vd, sta
  *
  *************************************/
 
-#define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
+#define RASTERIZER(name, TMUS, FBZCOLORPATH_, FBZMODE_, ALPHAMODE_, FOGMODE_, TEXMODE0_, TEXMODE1_) \
 																				\
 void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *extent, const void *extradata, int threadid) \
 {                                                                               \
 	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
 	voodoo_device *vd = extra->device; \
+	/* latch the mode registers once per span; these are constants for the */  \
+	/* precompiled rasterizers, and the generic ones stop re-reading them */    \
+	/* through vd for every test in the pixel pipeline */                       \
+	const uint32_t FBZCOLORPATH = (FBZCOLORPATH_);                              \
+	const uint32_t FBZMODE = (FBZMODE_);                                        \
+	const uint32_t ALPHAMODE = (ALPHAMODE_);                                    \
+	const uint32_t FOGMODE = (FOGMODE_);                                        \
+	const uint32_t TEXMODE0 = (TEXMODE0_);                                      \
+	const uint32_t TEXMODE1 = (TEXMODE1_);                                      \
 	stats_block *stats = &vd->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
 	int32_t startx = extent->startx;                                              \
@@ -2728,6 +2737,16 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		deltastw1.set(extra->ds1dx, extra->dt1dx, extra->dw1dx);       \
 	}                                                                           \
 	extra->info->hits++;                                                        \
+																				\
+	/* hoist the per-span invariants out of the pixel loop; the compiler */     \
+	/* cannot prove they survive the stores to dest/depth/stats */              \
+	const bool tmu1_active = (TMUS >= 2 && vd->tmu[1].lodmin < (8 << 8));       \
+	const bool tmu0_active = (TMUS >= 1 && vd->tmu[0].lodmin < (8 << 8));       \
+	const bool send_config = vd->send_config;                                   \
+	const uint16_t zacolor = (uint16_t) vd->reg[zaColor].u;                     \
+	const int32_t dzdx = extra->dzdx;                                           \
+	const int64_t dwdx = extra->dwdx;                                           \
+																				\
 	/* loop in X */                                                             \
 	for (x = startx; x < stopx; x++)                                            \
 	{                                                                           \
@@ -2738,12 +2757,12 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		PIXEL_PIPELINE_BEGIN(vd, stats, x, y, FBZCOLORPATH, FBZMODE, iterz, iterw); \
 		/* depth testing */         \
 		if (FBZMODE_ENABLE_DEPTHBUF(FBZMODE))                                                  \
-			if (!depthTest((uint16_t) vd->reg[zaColor].u, stats, depth[x], FBZMODE, biasdepth)) \
+			if (!depthTest(zacolor, stats, depth[x], FBZMODE, biasdepth)) \
 				goto skipdrawdepth; \
 																				\
 		/* run the texture pipeline on TMU1 to produce a value in texel */      \
 		/* note that they set LOD min to 8 to "disable" a TMU */                \
-		if (TMUS >= 2 && vd->tmu[1].lodmin < (8 << 8))                    {       \
+		if (tmu1_active)                                                    {       \
 			int32_t tmp; \
 			const rgbaint_t texelZero(0);  \
 			texel = vd->tmu[1].genTexture(x, dither4, TEXMODE1, vd->tmu[1].lookup, extra->lodbase1, \
@@ -2753,9 +2772,9 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 		/* run the texture pipeline on TMU0 to produce a final */               \
 		/* result in texel */                                                   \
 		/* note that they set LOD min to 8 to "disable" a TMU */                \
-		if (TMUS >= 1 && vd->tmu[0].lodmin < (8 << 8))                           \
+		if (tmu0_active)                                                         \
 		{                                                                   \
-			if (!vd->send_config)                                                \
+			if (!send_config)                                                    \
 			{                                                                   \
 				int32_t lod0; \
 				rgbaint_t texelT0;                                                \
@@ -2792,8 +2811,8 @@ void voodoo_device::raster_##name(void *destbase, int32_t y, const poly_extent *
 																				\
 		/* update the iterated parameters */                                    \
 		iterargb += iterargbDelta;                                              \
-		iterz += extra->dzdx;                                                   \
-		iterw += extra->dwdx;                                                   \
+		iterz += dzdx;                                                          \
+		iterw += dwdx;                                                          \
 		if (TMUS >= 1)                                                          \
 		{                                                                       \
 			iterstw0.add(deltastw0);                                            \
@@ -38,19 +38,20 @@ attotime &attotime::operator*=(u32 factor)
 	if (factor == 0)
 		return *this = zero;
 
-	// split attoseconds into upper and lower halves which fit into 32 bits
-	u32 attolo;
-	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, &attolo);
+	// split attoseconds into upper and lower halves which fit into 32 bits; dividing
+	// by the constant lets the compiler use a reciprocal multiply instead of a divide
+	u32 const attohi = u64(m_attoseconds) / ATTOSECONDS_PER_SECOND_SQRT;
+	u32 const attolo = u64(m_attoseconds) % ATTOSECONDS_PER_SECOND_SQRT;
 
 	// scale the lower half, then split into high/low parts
 	u64 temp = mulu_32x32(attolo, factor);
-	u32 reslo;
-	temp = divu_64x32_rem(temp, ATTOSECONDS_PER_SECOND_SQRT, &reslo);
+	u32 const reslo = temp % ATTOSECONDS_PER_SECOND_SQRT;
+	temp /= ATTOSECONDS_PER_SECOND_SQRT;
 
 	// scale the upper half, then split into high/low parts
 	temp += mulu_32x32(attohi, factor);
-	u32 reshi;
-	temp = divu_64x32_rem(temp, ATTOSECONDS_PER_SECOND_SQRT, &reshi);
+	u32 const reshi = temp % ATTOSECONDS_PER_SECOND_SQRT;
+	temp /= ATTOSECONDS_PER_SECOND_SQRT;
 
 	// scale the seconds
 	temp += mulu_32x32(m_seconds, factor);
@@ -79,8 +80,8 @@ attotime &attotime::operator/=(u32 factor)
 		return *this;
 
 	// split attoseconds into upper and lower halves which fit into 32 bits
-	u32 attolo;
-	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, &attolo);
+	u32 const attohi = u64(m_attoseconds) / ATTOSECONDS_PER_SECOND_SQRT;
+	u32 const attolo = u64(m_attoseconds) % ATTOSECONDS_PER_SECOND_SQRT;
 
 	// divide the seconds and get the remainder
 	u32 remainder;
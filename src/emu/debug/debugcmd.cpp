@@ -281,6 +281,10 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("mapi",      CMDFLAG_NONE, AS_IO, 1, 1, std::bind(&debugger_commands::execute_map, this, _1, _2));
 	m_console.register_command("mapo",      CMDFLAG_NONE, AS_OPCODES, 1, 1, std::bind(&debugger_commands::execute_map, this, _1, _2));
 	m_console.register_command("memdump",   CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_memdump, this, _1, _2));
+	m_console.register_command("memstat",   CMDFLAG_NONE, AS_PROGRAM, 1, 3, std::bind(&debugger_commands::execute_memstat, this, _1, _2));
+	m_console.register_command("memstatd",  CMDFLAG_NONE, AS_DATA, 1, 3, std::bind(&debugger_commands::execute_memstat, this, _1, _2));
+	m_console.register_command("memstati",  CMDFLAG_NONE, AS_IO, 1, 3, std::bind(&debugger_commands::execute_memstat, this, _1, _2));
+	m_console.register_command("memstato",  CMDFLAG_NONE, AS_OPCODES, 1, 3, std::bind(&debugger_commands::execute_memstat, this, _1, _2));
 
 	m_console.register_command("symlist",   CMDFLAG_NONE, 0, 0, 1, std::bind(&debugger_commands::execute_symlist, this, _1, _2));
 
@@ -3183,6 +3187,83 @@ void debugger_commands::execute_map(int ref, const std::vector<std::string> &par
 }
 
 
+/*-------------------------------------------------
+    execute_memstat - execute the memory access
+    statistics commands
+-------------------------------------------------*/
+
+void debugger_commands::execute_memstat(int ref, const std::vector<std::string> &params)
+{
+	/* validate parameters */
+	address_space *space;
+	if (!validate_cpu_space_parameter((params.size() > 1) ? params[1].c_str() : nullptr, ref, space))
+		return;
+
+	u64 count = 16;
+	if (params.size() > 2 && !validate_number_parameter(params[2], count))
+		return;
+
+	if (params[0] == "on")
+	{
+		space->enable_access_statistics();
+		m_console.printf("Counting accesses to %s space\n", space->name());
+		return;
+	}
+	else if (params[0] == "off")
+	{
+		space->disable_access_statistics();
+		m_console.printf("Stopped counting accesses to %s space\n", space->name());
+		return;
+	}
+
+	memory_access_statistics *stats = space->access_statistics();
+	if (!stats)
+	{
+		m_console.printf("Access statistics are not enabled for %s space\n", space->name());
+		return;
+	}
+
+	if (params[0] == "clear")
+	{
+		stats->reset();
+		m_console.printf("Cleared access statistics for %s space\n", space->name());
+		return;
+	}
+	else if (params[0] != "show")
+	{
+		m_console.printf("Invalid action '%s', expected on, off, clear or show\n", params[0]);
+		return;
+	}
+
+	/* sort handlers and pages by total traffic */
+	using entry = std::pair<offs_t, memory_access_statistics::counts>;
+	auto const by_total = [] (const auto &a, const auto &b) { return a.second.m_reads + a.second.m_writes > b.second.m_reads + b.second.m_writes; };
+
+	std::map<std::string, memory_access_statistics::counts> const handlers = stats->handlers();
+	std::vector<std::pair<std::string, memory_access_statistics::counts> > handler_list(handlers.begin(), handlers.end());
+	std::sort(handler_list.begin(), handler_list.end(), by_total);
+	std::vector<entry> page_list(stats->pages().begin(), stats->pages().end());
+	std::sort(page_list.begin(), page_list.end(), by_total);
+
+	m_console.printf("%12s %12s  Handler\n", "Reads", "Writes");
+	for (size_t index = 0; index < handler_list.size() && index < count; index++)
+	{
+		auto const &item = handler_list[index];
+		if (item.second.m_reads || item.second.m_writes)
+			m_console.printf("%12u %12u  %s\n", item.second.m_reads, item.second.m_writes, item.first);
+	}
+
+	m_console.printf("%12s %12s  Page\n", "Reads", "Writes");
+	for (size_t index = 0; index < page_list.size() && index < count; index++)
+	{
+		auto const &item = page_list[index];
+		offs_t const start = item.first << stats->page_shift();
+		offs_t const end = (start | ((offs_t(1) << stats->page_shift()) - 1)) & space->addrmask();
+		m_console.printf("%12u %12u  %0*X-%0*X\n", item.second.m_reads, item.second.m_writes, space->addrchars(), start, space->addrchars(), end);
+	}
+}
+
+
 /*-------------------------------------------------
     execute_memdump - execute the memdump command
 -------------------------------------------------*/
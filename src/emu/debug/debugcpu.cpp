@@ -1645,6 +1645,9 @@ void device_debug::instruction_hook(offs_t curpc)
 		// load comments if we haven't yet
 		debugcpu.ensure_comments_loaded();
 
+		// make sure trace output is visible while we're stopped
+		debugcpu.flush_traces();
+
 		// reset any transient state
 		debugcpu.reset_transient_flags();
 		debugcpu.set_break_cpu(nullptr);
@@ -3146,8 +3149,12 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_buffer(std::make_unique<char []>(TRACE_BUFFER_SIZE))
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	// use a large buffer; the file is flushed when execution stops
+	setvbuf(&m_file, m_buffer.get(), _IOFBF, TRACE_BUFFER_SIZE);
 }
 
 
@@ -3227,7 +3234,6 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	fflush(&m_file);
 }
 
 
@@ -3239,7 +3245,6 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 {
 	// pass through to the file
 	vfprintf(&m_file, format, va);
-	fflush(&m_file);
 }
 
 
@@ -358,6 +358,7 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static const size_t TRACE_BUFFER_SIZE = 1 << 20;
 
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
@@ -371,6 +372,7 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		std::unique_ptr<char []> m_buffer;              // stdio buffer for the trace file
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -126,6 +126,7 @@ static const help_item static_help_list[] =
 		"  mapd <address> -- map logical data address to physical address and bank\n"
 		"  mapi <address> -- map logical I/O address to physical address and bank\n"
 		"  memdump [<filename>] -- dump the current memory map to <filename>\n"
+		"  memstat[{d|i|o}] <action>[,<cpu>[,<count>]] -- count accesses per handler and page\n"
 	},
 	{
 		"execution",
@@ -1283,6 +1284,26 @@ static const help_item static_help_list[] =
 		"memdump\n"
 		"  Dumps memory to memdump.log.\n"
 	},
+	{
+		"memstat",
+		"\n"
+		"  memstat[{d|i|o}] <action>[,<cpu>[,<count>]]\n"
+		"\n"
+		"The memstat/memstatd/memstati/memstato commands count the accesses made to an address space, "
+		"broken down by the handler that served them and by 4K-address page. This shows which device "
+		"handlers are hot enough to be worth turning into direct memory. <action> is one of 'on' to start "
+		"counting, 'off' to stop and discard the counts, 'clear' to reset the counts, or 'show' to list the "
+		"<count> busiest handlers and pages (16 by default). If <cpu> is omitted, the currently visible "
+		"CPU is used.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memstat on\n"
+		"  Starts counting accesses to program space of the currently visible CPU.\n"
+		"\n"
+		"memstatd show,1,32\n"
+		"  Lists the 32 busiest handlers and pages in data space of CPU #1.\n"
+	},
 	{
 		"comlist",
 		"\n"
@@ -566,6 +566,9 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// collapse expressions that don't depend on machine state
+	fold_constants();
 }
 
 
@@ -1321,6 +1324,47 @@ void parsed_expression::infix_to_postfix()
 }
 
 
+//-------------------------------------------------
+//  fold_constants - reduce an expression made up
+//  solely of numbers and pure operators to a
+//  single number token
+//-------------------------------------------------
+
+void parsed_expression::fold_constants()
+{
+	// nothing to do for empty or already trivial expressions
+	if (m_tokenlist.count() < 2)
+		return;
+
+	// only numbers and side-effect-free operators can be folded
+	for (parse_token &token : m_tokenlist)
+	{
+		if (token.is_operator())
+		{
+			if (token.optype() < TVL_COMPLEMENT || token.optype() > TVL_LOR)
+				return;
+		}
+		else if (!token.is_number())
+			return;
+	}
+
+	// evaluate once; errors are left to be reported at execution time
+	u64 value;
+	try
+	{
+		value = execute_tokens();
+	}
+	catch (expression_error &)
+	{
+		return;
+	}
+
+	int offset = m_tokenlist.first()->offset();
+	m_tokenlist.reset();
+	m_tokenlist.append(*global_alloc(parse_token(offset))).configure_number(value);
+}
+
+
 //-------------------------------------------------
 //  push_token - push a token onto the stack
 //-------------------------------------------------
@@ -1395,6 +1439,11 @@ inline void parsed_expression::pop_token_rval(parse_token &token)
 
 u64 parsed_expression::execute_tokens()
 {
+	// constant expressions are folded to a single number at parse time
+	parse_token *first = m_tokenlist.first();
+	if (first != nullptr && first->next() == nullptr && first->is_number())
+		return first->value();
+
 	// reset the token stack
 	m_token_stack.clear();
 
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 #include "screen.h"
 
 
@@ -46,6 +47,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
 	, m_disabled(false)
+	, m_execution_group(0)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
@@ -57,6 +59,11 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_icountptr(nullptr)
 	, m_cycles_running(0)
 	, m_cycles_stolen(0)
+	, m_pc_sample_next(0)
+	, m_idle_mode(idle_mode::OFF)
+	, m_idle_loop_head(~offs_t(0))
+	, m_idle_loop_icount(0)
+	, m_idle_loop_cycles(0)
 	, m_suspend(0)
 	, m_nextsuspend(0)
 	, m_eatcycles(0)
@@ -98,6 +105,9 @@ void device_execute_interface::abort_timeslice() noexcept
 	if (!executing())
 		return;
 
+	if (UNEXPECTED(m_scheduler->statistics_enabled()))
+		m_stats.m_aborts++;
+
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr)
 	{
@@ -357,6 +367,9 @@ void device_execute_interface::interface_validity_check(validity_checker &valid)
 			osd_printf_error("VBLANK interrupt references a nonexistent screen tag '%s'\n", m_vblank_interrupt_screen);
 	}
 
+	if (m_execution_group < 0)
+		osd_printf_error("Negative execution group %d specified\n", m_execution_group);
+
 	if (!m_timed_interrupt.isnull() && m_timed_interrupt_period == attotime::zero)
 		osd_printf_error("Timed interrupt handler specified with 0 period\n");
 	else if (m_timed_interrupt.isnull() && m_timed_interrupt_period != attotime::zero)
@@ -387,6 +400,18 @@ void device_execute_interface::interface_pre_start()
 	// allocate timers if we need them
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = m_scheduler->timer_alloc(timer_expired_delegate(FUNC(device_execute_interface::trigger_periodic_interrupt), this));
+
+	// pick up the idle loop skipping mode
+	emu_options &options = device().machine().options();
+	if (options.idle_skip_audit())
+	{
+		m_idle_mode = idle_mode::AUDIT;
+		device().machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_execute_interface::idle_loop_audit_report, this));
+	}
+	else if (options.idle_skip())
+	{
+		m_idle_mode = idle_mode::ON;
+	}
 }
 
 
@@ -533,10 +558,71 @@ int device_execute_interface::standard_irq_callback(int irqline)
 	if (device().machine().debug_flags & DEBUG_FLAG_ENABLED)
 		device().debug()->interrupt_hook(irqline);
 
+	// the interrupt handler may change what an idle loop is waiting for
+	m_idle_loop_head = ~offs_t(0);
+
 	return vector;
 }
 
 
+//-------------------------------------------------
+//  idle_loop_pass - note a return to the head of
+//  a side effect free loop, and skip whole passes
+//  once one is known to repeat the last exactly
+//-------------------------------------------------
+
+u32 device_execute_interface::idle_loop_pass(offs_t head, const void *state, size_t length)
+{
+	int &icount = *m_icountptr;
+	u32 skipped = 0;
+
+	if ((head == m_idle_loop_head) && (length == m_idle_loop_state.size()))
+	{
+		// nothing else runs until the timeslice ends, so an identical pass
+		// that read unchanged memory will keep repeating until then
+		const int cycles = m_idle_loop_icount - icount;
+		if ((cycles > 0) && (cycles == m_idle_loop_cycles) && !memcmp(state, &m_idle_loop_state[0], length))
+		{
+			if (m_idle_mode == idle_mode::AUDIT)
+			{
+				std::pair<u64, u64> &audit = m_idle_loop_audit[head];
+				audit.first++;
+				audit.second += cycles;
+			}
+			else if (icount > cycles)
+			{
+				skipped = (icount - 1) / cycles;
+				icount -= skipped * cycles;
+			}
+		}
+		m_idle_loop_cycles = cycles;
+	}
+	else
+	{
+		m_idle_loop_head = head;
+		m_idle_loop_cycles = 0;
+		m_idle_loop_state.resize(length);
+	}
+
+	m_idle_loop_icount = icount;
+	memcpy(&m_idle_loop_state[0], state, length);
+	return skipped;
+}
+
+
+//-------------------------------------------------
+//  idle_loop_audit_report - list the loops idle
+//  skipping would have shortened
+//-------------------------------------------------
+
+void device_execute_interface::idle_loop_audit_report()
+{
+	for (const auto &loop : m_idle_loop_audit)
+		osd_printf_info("Idle loop audit: '%s' loop at %X ran %u redundant passes (%u cycles)\n",
+				device().tag(), loop.first, unsigned(loop.second.first), unsigned(loop.second.second));
+}
+
+
 //-------------------------------------------------
 //  minimum_quantum - return the minimum quantum
 //  required for this device
@@ -96,12 +96,24 @@ class device_execute_interface : public device_interface
 	friend class testcpu_state;
 
 public:
+	// execution statistics, gathered while the scheduler has them enabled
+	struct statistics
+	{
+		osd_ticks_t         m_host_ticks = 0;           // host time spent executing, in osd_ticks()
+		u64                 m_timeslices = 0;           // number of times the device was run
+		u64                 m_cycles_requested = 0;     // cycles the scheduler asked for
+		u64                 m_cycles_executed = 0;      // cycles actually executed
+		u64                 m_aborts = 0;               // abort_timeslice() calls while executing
+		u64                 m_boosts = 0;               // boost_interleave() requests while executing
+	};
+
 	// construction/destruction
 	device_execute_interface(const machine_config &mconfig, device_t &device);
 	virtual ~device_execute_interface();
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	int execution_group() const { return m_execution_group; }
 	u64 clocks_to_cycles(u64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	u64 cycles_to_clocks(u64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	u32 min_cycles() const { return execute_min_cycles(); }
@@ -115,6 +127,13 @@ public:
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
 
+	// devices in a non-zero execution group may run on a worker thread
+	// concurrently with devices in other groups; they must only interact
+	// with the rest of the machine at timeslice boundaries, and must not
+	// allocate, set, adjust or enable timers or boost the interleave while
+	// executing (debug builds assert this)
+	void set_execution_group(int group) { m_execution_group = group; }
+
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
 		m_vblank_interrupt.set(std::forward<T>(args)...);
@@ -185,6 +204,8 @@ public:
 	// time and cycle accounting
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
+	const statistics &stats() const noexcept { return m_stats; }
+	void reset_stats() noexcept { m_stats = statistics(); }
 
 	// required operation overrides
 	void run() { execute_run(); }
@@ -224,6 +245,14 @@ protected:
 	IRQ_CALLBACK_MEMBER(standard_irq_callback_member);
 	int standard_irq_callback(int irqline);
 
+	// idle loop skipping: a core that has proved a loop body free of side
+	// effects calls idle_loop_pass() each time the loop is back at its head,
+	// passing the state the body can change; once two passes match in state
+	// and cost, the rest of the timeslice is spent in whole passes and the
+	// number skipped is returned so the core can account for them
+	bool idle_skip_enabled() const { return m_idle_mode != idle_mode::OFF; }
+	u32 idle_loop_pass(offs_t head, const void *state, size_t length);
+
 	// debugger hooks
 	bool debugger_enabled() const { return bool(device().machine().debug_flags & DEBUG_FLAG_ENABLED); }
 	void debugger_instruction_hook(offs_t curpc)
@@ -289,6 +318,7 @@ private:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	int                     m_execution_group;          // group for concurrent execution (0 = main thread)
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -307,6 +337,18 @@ private:
 	int *                   m_icountptr;                // pointer to the icount
 	int                     m_cycles_running;           // number of cycles we are executing
 	int                     m_cycles_stolen;            // number of cycles we artificially stole
+	statistics              m_stats;                    // execution statistics
+	std::unordered_map<offs_t, u32> m_pc_samples;       // sampled program counters and their hit counts
+	osd_ticks_t             m_pc_sample_next;           // host time of the next program counter sample
+
+	// idle loop skipping
+	enum class idle_mode : u8 { OFF, ON, AUDIT };
+	idle_mode               m_idle_mode;                // skipping, auditing or neither
+	offs_t                  m_idle_loop_head;           // head of the loop being watched
+	int                     m_idle_loop_icount;         // icount on the previous arrival at the head
+	int                     m_idle_loop_cycles;         // cycles taken by the previous pass
+	std::vector<u8>         m_idle_loop_state;          // core state on the previous arrival
+	std::map<offs_t, std::pair<u64, u64> > m_idle_loop_audit; // redundant passes and their cycles, by loop head
 
 	// suspend states
 	u32                     m_suspend;                  // suspend reason mask (0 = not suspended)
@@ -334,6 +376,7 @@ private:
 	TIMER_CALLBACK_MEMBER(trigger_periodic_interrupt);
 	TIMER_CALLBACK_MEMBER(irq_pulse_clear) { set_input_line(int(param), CLEAR_LINE); }
 	void suspend_resume_changed();
+	void idle_loop_audit_report();
 
 	attoseconds_t minimum_quantum() const;
 
@@ -8,6 +8,7 @@ device_rom_interface::device_rom_interface(const machine_config &mconfig, device
 	device_memory_interface(mconfig, device),
 	m_rom_tag(device.basetag()),
 	m_rom_config("rom", endian, datawidth, addrwidth),
+	m_cache8(nullptr),
 	m_bank(nullptr),
 	m_cur_bank(-1)
 {
@@ -90,6 +91,7 @@ void device_rom_interface::interface_pre_start()
 	case  8:
 		if(space().endianness() == ENDIANNESS_LITTLE) {
 			auto cache = space().cache<0, 0, ENDIANNESS_LITTLE>();
+			m_cache8 = cache;
 			m_r8  = [cache] (offs_t byteaddress) -> u8  { return cache->read_byte(byteaddress); };
 			m_r16 = [cache] (offs_t byteaddress) -> u16 { return cache->read_word(byteaddress); };
 			m_r32 = [cache] (offs_t byteaddress) -> u32 { return cache->read_dword(byteaddress); };
@@ -25,7 +25,7 @@ public:
 
 	void set_device_rom_tag(const char *tag) { m_rom_tag = tag; }
 
-	inline u8 read_byte(offs_t byteaddress) { return m_r8(byteaddress); }
+	inline u8 read_byte(offs_t byteaddress) { return m_cache8 ? m_cache8->read_byte(byteaddress) : m_r8(byteaddress); }
 	inline u16 read_word(offs_t byteaddress) { return m_r16(byteaddress); }
 	inline u32 read_dword(offs_t byteaddress) { return m_r32(byteaddress); }
 	inline u64 read_qword(offs_t byteaddress) { return m_r64(byteaddress); }
@@ -48,6 +48,7 @@ private:
 	std::function<u16 (offs_t)> m_r16;
 	std::function<u32 (offs_t)> m_r32;
 	std::function<u64 (offs_t)> m_r64;
+	memory_access_cache<0, 0, ENDIANNESS_LITTLE> *m_cache8;  // direct byte access for little-endian 8-bit roms
 
 	memory_bank *m_bank;
 	int m_cur_bank, m_bank_count;
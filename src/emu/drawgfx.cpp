@@ -26,6 +26,32 @@ static inline int readbit(const u8 *src, unsigned int bitnum)
 }
 
 
+/*-------------------------------------------------
+    expandbits - expand the bits of a byte into
+    eight bytes of 0 or 1, most significant bit
+    first in memory order
+-------------------------------------------------*/
+
+static inline u64 expandbits(u8 bits)
+{
+	static const struct expand_table
+	{
+		expand_table()
+		{
+			for (int value = 0; value < 256; value++)
+			{
+				u8 bytes[8];
+				for (int b = 0; b < 8; b++)
+					bytes[b] = (value >> (7 - b)) & 1;
+				memcpy(&entry[value], bytes, 8);
+			}
+		}
+		u64 entry[256];
+	} s_table;
+	return s_table.entry[bits];
+}
+
+
 /*-------------------------------------------------
     normalize_xscroll - normalize an X scroll
     value for a bitmap to be positive and less
@@ -95,6 +121,7 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 		m_gfxdata(base),
 		m_layout_is_raw(true),
 		m_layout_planes(0),
+		m_layout_xlinear(false),
 		m_layout_xormask(0),
 		m_layout_charincrement(0)
 {
@@ -120,6 +147,7 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 		m_gfxdata(nullptr),
 		m_layout_is_raw(false),
 		m_layout_planes(0),
+		m_layout_xlinear(false),
 		m_layout_xormask(xormask),
 		m_layout_charincrement(0)
 {
@@ -181,6 +209,11 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		for (int x = 0; x < m_width; x++)
 			m_layout_xoffset[x] = gl.xoffs(x);
 
+		// most layouts store each row of a plane as consecutive bits, which lets us decode a byte at a time
+		m_layout_xlinear = (m_origwidth % 8) == 0;
+		for (int x = 1; x < m_width && m_layout_xlinear; x++)
+			m_layout_xlinear = (m_layout_xoffset[x] == m_layout_xoffset[0] + x);
+
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
@@ -308,6 +341,24 @@ void gfx_element::decode(u32 code)
 				int yoffs = planeoffs + m_layout_yoffset[y];
 				u8 *dp = decode_base + y * m_line_modulo;
 
+				// fast path for byte-aligned rows of consecutive bits
+				if (m_layout_xlinear && m_layout_xormask == 0 && ((yoffs + m_layout_xoffset[0]) % 8) == 0)
+				{
+					const u8 *sp = m_srcdata + (yoffs + m_layout_xoffset[0]) / 8;
+					for (int x = 0; x < m_origwidth; x += 8)
+					{
+						u8 const bits = *sp++;
+						if (bits != 0)
+						{
+							u64 pixels;
+							memcpy(&pixels, &dp[x], 8);
+							pixels |= expandbits(bits) * planebit;
+							memcpy(&dp[x], &pixels, 8);
+						}
+					}
+					continue;
+				}
+
 				// iterate over columns
 				for (int x = 0; x < m_origwidth; x++)
 					if (readbit(m_srcdata, (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask))
@@ -353,7 +404,7 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_rebase_opaque_op{ color });
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -394,7 +445,7 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_rebase_transpen_op{ color, trans_pen });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -421,7 +472,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawgfx_remap_transpen_op{ paldata, trans_pen });
 }
 
 
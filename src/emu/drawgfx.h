@@ -169,6 +169,7 @@ public:
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
+	size_t memory_usage() const { return m_gfxdata_allocated.size() + m_dirty.size() + m_pen_usage.size() * sizeof(m_pen_usage[0]); }
 
 	// setters
 	void set_layout(const gfx_layout &gl, const u8 *srcdata);
@@ -311,6 +312,7 @@ private:
 
 	bool            m_layout_is_raw;        // raw layout?
 	u8              m_layout_planes;        // bit planes in the layout
+	bool            m_layout_xlinear;       // X offsets are consecutive bits, whole bytes wide?
 	u32             m_layout_xormask;       // xor mask applied to each bit offset
 	u32             m_layout_charincrement; // per-character increment in source data
 	std::vector<u32>  m_layout_planeoffset;// plane offsets
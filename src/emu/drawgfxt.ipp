@@ -15,6 +15,11 @@
 
 #pragma once
 
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define MAME_DRAWGFX_SSE2 1
+#include <emmintrin.h>
+#endif
+
 
 /***************************************************************************
     PIXEL OPERATIONS
@@ -399,6 +404,136 @@ do
 while (0)
 
 
+/***************************************************************************
+    ROW OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    Functor forms of the hottest pixel operations;
+    drawgfx_row below has vectorized overloads
+    for these, while lambdas take the generic path
+-------------------------------------------------*/
+
+struct drawgfx_rebase_opaque_op
+{
+	u32 color;
+	void operator()(u16 &destp, const u8 &srcp) const { PIXEL_OP_REBASE_OPAQUE(destp, srcp); }
+};
+
+struct drawgfx_rebase_transpen_op
+{
+	u32 color, trans_pen;
+	void operator()(u16 &destp, const u8 &srcp) const { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); }
+};
+
+struct drawgfx_remap_transpen_op
+{
+	const pen_t *paldata;
+	u32 trans_pen;
+	void operator()(u32 &destp, const u8 &srcp) const { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); }
+};
+
+
+/*-------------------------------------------------
+    drawgfx_row - render one unflipped row of
+    8bpp source pixels
+-------------------------------------------------*/
+
+template <typename PixelType, typename FunctionClass>
+inline void drawgfx_row(PixelType *destptr, const u8 *srcptr, u32 numblocks, u32 leftovers, const FunctionClass &pixel_op)
+{
+	// iterate over unrolled blocks of 4
+	for (s32 curx = 0; curx < numblocks; curx++)
+	{
+		pixel_op(destptr[0], srcptr[0]);
+		pixel_op(destptr[1], srcptr[1]);
+		pixel_op(destptr[2], srcptr[2]);
+		pixel_op(destptr[3], srcptr[3]);
+
+		srcptr += 4;
+		destptr += 4;
+	}
+
+	// iterate over leftover pixels
+	for (s32 curx = 0; curx < leftovers; curx++)
+	{
+		pixel_op(destptr[0], srcptr[0]);
+		srcptr++;
+		destptr++;
+	}
+}
+
+#ifdef MAME_DRAWGFX_SSE2
+
+// 8 pixels at a time: widen the pens to 16 bits and add the color base
+inline void drawgfx_row(u16 *destptr, const u8 *srcptr, u32 numblocks, u32 leftovers, const drawgfx_rebase_opaque_op &pixel_op)
+{
+	u32 count = numblocks * 4 + leftovers;
+	__m128i const color = _mm_set1_epi16(s16(pixel_op.color));
+	for ( ; count >= 8; count -= 8, srcptr += 8, destptr += 8)
+	{
+		__m128i const pens = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(srcptr)), _mm_setzero_si128());
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(destptr), _mm_add_epi16(pens, color));
+	}
+	for ( ; count > 0; count--)
+		pixel_op(*destptr++, *srcptr++);
+}
+
+// as above, merging with the destination wherever the pen is transparent
+inline void drawgfx_row(u16 *destptr, const u8 *srcptr, u32 numblocks, u32 leftovers, const drawgfx_rebase_transpen_op &pixel_op)
+{
+	u32 count = numblocks * 4 + leftovers;
+	__m128i const color = _mm_set1_epi16(s16(pixel_op.color));
+	__m128i const trans = _mm_set1_epi16(s16(pixel_op.trans_pen));
+	for ( ; count >= 8; count -= 8, srcptr += 8, destptr += 8)
+	{
+		__m128i const pens = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(srcptr)), _mm_setzero_si128());
+		__m128i const transparent = _mm_cmpeq_epi16(pens, trans);
+		int const mask = _mm_movemask_epi8(transparent);
+		if (mask == 0xffff)
+			continue;
+		__m128i result = _mm_add_epi16(pens, color);
+		if (mask != 0)
+		{
+			__m128i const old = _mm_loadu_si128(reinterpret_cast<const __m128i *>(destptr));
+			result = _mm_or_si128(_mm_and_si128(transparent, old), _mm_andnot_si128(transparent, result));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(destptr), result);
+	}
+	for ( ; count > 0; count--)
+		pixel_op(*destptr++, *srcptr++);
+}
+
+// the pen lookup stays scalar, but runs of 8 transparent pixels are skipped
+// and runs of 8 opaque pixels are written without per-pixel tests
+inline void drawgfx_row(u32 *destptr, const u8 *srcptr, u32 numblocks, u32 leftovers, const drawgfx_remap_transpen_op &pixel_op)
+{
+	u32 count = numblocks * 4 + leftovers;
+	__m128i const trans = _mm_set1_epi8(s8(pixel_op.trans_pen));
+	const pen_t *const paldata = pixel_op.paldata;
+	for ( ; count >= 8; count -= 8, srcptr += 8, destptr += 8)
+	{
+		int const mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(srcptr)), trans)) & 0xff;
+		if (mask == 0xff)
+			continue;
+		if (mask == 0)
+		{
+			for (int i = 0; i < 8; i++)
+				destptr[i] = paldata[srcptr[i]];
+		}
+		else
+		{
+			for (int i = 0; i < 8; i++)
+				pixel_op(destptr[i], srcptr[i]);
+		}
+	}
+	for ( ; count > 0; count--)
+		pixel_op(*destptr++, *srcptr++);
+}
+
+#endif // MAME_DRAWGFX_SSE2
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
@@ -493,29 +628,8 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 			// iterate over pixels in Y
 			for (s32 cury = desty; cury <= destendy; cury++)
 			{
-				auto *destptr = &dest.pix(cury, destx);
-				const u8 *srcptr = srcdata;
+				drawgfx_row(&dest.pix(cury, destx), srcdata, numblocks, leftovers, pixel_op);
 				srcdata += dy;
-
-				// iterate over unrolled blocks of 4
-				for (s32 curx = 0; curx < numblocks; curx++)
-				{
-					pixel_op(destptr[0], srcptr[0]);
-					pixel_op(destptr[1], srcptr[1]);
-					pixel_op(destptr[2], srcptr[2]);
-					pixel_op(destptr[3], srcptr[3]);
-
-					srcptr += 4;
-					destptr += 4;
-				}
-
-				// iterate over leftover pixels
-				for (s32 curx = 0; curx < leftovers; curx++)
-				{
-					pixel_op(destptr[0], srcptr[0]);
-					srcptr++;
-					destptr++;
-				}
 			}
 		}
 
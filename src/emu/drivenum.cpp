@@ -259,9 +259,31 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 		std::vector<std::pair<double, int> > penalty;
 		penalty.reserve(count);
 		std::u32string const search(ustr_from_utf8(normalize_unicode(string, unicode_normalization_form::D, true)));
-		std::string composed;
 		std::u32string candidate;
 
+		// normalised descriptions never change, so only build them once per process
+		struct search_strings
+		{
+			std::u32string description;
+			std::u32string manufacturer_description;
+		};
+		static std::vector<search_strings> const s_search_strings(
+				[] ()
+				{
+					std::vector<search_strings> result(s_driver_count);
+					std::string composed;
+					for (int index = 0; index < s_driver_count; index++)
+					{
+						game_driver const &drv(*s_drivers_sorted[index]);
+						result[index].description = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
+						composed.assign(drv.manufacturer);
+						composed.append(1, ' ');
+						composed.append(drv.type.fullname());
+						result[index].manufacturer_description = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
+					}
+					return result;
+				}());
+
 		// scan the entire drivers array
 		for (int index = 0; index < s_driver_count; index++)
 		{
@@ -278,8 +300,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 				// if it's not a perfect match, try the description
 				if (curpenalty)
 				{
-					candidate = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, s_search_strings[index].description));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -287,11 +308,7 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 				// also check "<manufacturer> <description>"
 				if (curpenalty)
 				{
-					composed.assign(drv.manufacturer);
-					composed.append(1, ' ');
-					composed.append(drv.type.fullname());
-					candidate = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, s_search_strings[index].manufacturer_description));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -24,6 +24,7 @@
 #include "emumem_hedw.h"
 #include "emumem_hep.h"
 #include "emumem_het.h"
+#include "emumem_hes.h"
 
 
 //**************************************************************************
@@ -296,6 +297,7 @@ public:
 	void install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, void *baseptr) override;
 	void install_bank_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, std::string rtag, std::string wtag) override;
 	void install_bank_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, memory_bank *rbank, memory_bank *wbank) override;
+	memory_passthrough_handler *install_access_statistics(memory_access_statistics &stats) override;
 	void install_readwrite_port(offs_t addrstart, offs_t addrend, offs_t addrmirror, std::string rtag, std::string wtag) override;
 	void install_device_delegate(offs_t addrstart, offs_t addrend, device_t &device, address_map_constructor &map, u64 unitmask = 0, int cswidth = 0) override;
 
@@ -612,6 +614,25 @@ public:
 		g_profiler.stop();
 	}
 
+	// block access through the handlers
+	void read_block(offs_t address, void *data, u32 count) override
+	{
+		g_profiler.start(PROFILER_MEMREAD);
+
+		memory_read_block<Width, AddrShift, Endian>(m_root_read, m_addrmask, address, reinterpret_cast<uX *>(data), count);
+
+		g_profiler.stop();
+	}
+
+	void write_block(offs_t address, void const *data, u32 count) override
+	{
+		g_profiler.start(PROFILER_MEMWRITE);
+
+		memory_write_block<Width, AddrShift, Endian>(m_root_write, m_addrmask, address, reinterpret_cast<uX const *>(data), count);
+
+		g_profiler.stop();
+	}
+
 	// virtual access to these functions
 	u8 read_byte(offs_t address) override { address &= m_addrmask; return Width == 0 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 0, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xff); }
 	u16 read_word(offs_t address) override { address &= m_addrmask; return Width == 1 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffff); }
@@ -1191,6 +1212,7 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_name(memory.space_config(spacenum)->name()),
 		m_addrchars((m_config.addr_width() + 3) / 4),
 		m_logaddrchars((m_config.logaddr_width() + 3) / 4),
+		m_access_statistics_mph(nullptr),
 		m_notifier_id(0),
 		m_in_notification(0),
 		m_manager(manager)
@@ -2012,6 +2034,28 @@ template<int Width, int AddrShift, endianness_t Endian> memory_passthrough_handl
 
 
 
+//-------------------------------------------------
+//  install_access_statistics - wrap every handler
+//  in the space with a counting passthrough
+//-------------------------------------------------
+
+template<int Width, int AddrShift, endianness_t Endian> memory_passthrough_handler *address_space_specific<Width, AddrShift, Endian>::install_access_statistics(memory_access_statistics &stats)
+{
+	m_mphs.emplace_back(std::make_unique<memory_passthrough_handler>(*this));
+	memory_passthrough_handler *mph = m_mphs.back().get();
+
+	auto rhandler = new handler_entry_read_statistics <Width, AddrShift, Endian>(this, *mph, stats);
+	m_root_read ->populate_passthrough(0, m_addrmask, 0, rhandler);
+	rhandler->unref();
+
+	auto whandler = new handler_entry_write_statistics<Width, AddrShift, Endian>(this, *mph, stats);
+	m_root_write->populate_passthrough(0, m_addrmask, 0, whandler);
+	whandler->unref();
+
+	invalidate_caches(read_or_write::READWRITE);
+
+	return mph;
+}
 
 
 //-------------------------------------------------
@@ -2336,6 +2380,72 @@ void address_space::remove_change_notifier(int id)
 }
 
 
+
+//**************************************************************************
+//  ACCESS STATISTICS
+//**************************************************************************
+
+//-------------------------------------------------
+//  enable_access_statistics - start counting
+//  accesses to the space, if not already
+//-------------------------------------------------
+
+void address_space::enable_access_statistics(u8 page_shift)
+{
+	if (m_access_statistics)
+		return;
+
+	m_access_statistics = std::make_unique<memory_access_statistics>(page_shift);
+	m_access_statistics_mph = install_access_statistics(*m_access_statistics);
+}
+
+
+//-------------------------------------------------
+//  disable_access_statistics - remove the
+//  counting passthroughs and drop the counts
+//-------------------------------------------------
+
+void address_space::disable_access_statistics()
+{
+	if (!m_access_statistics)
+		return;
+
+	m_access_statistics_mph->remove();
+	m_access_statistics_mph = nullptr;
+	m_access_statistics.reset();
+}
+
+
+//-------------------------------------------------
+//  handlers - totals per handler, merging the
+//  passthroughs that sit on the same handler
+//-------------------------------------------------
+
+std::map<std::string, memory_access_statistics::counts> memory_access_statistics::handlers() const
+{
+	std::map<std::string, counts> result;
+	for (const handler_slot &slot : m_handlers)
+	{
+		counts &entry = result[slot.m_name];
+		entry.m_reads += slot.m_counts.m_reads;
+		entry.m_writes += slot.m_counts.m_writes;
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  reset - clear all the counts
+//-------------------------------------------------
+
+void memory_access_statistics::reset()
+{
+	for (handler_slot &slot : m_handlers)
+		slot.m_counts = counts();
+	m_pages.clear();
+}
+
+
 //**************************************************************************
 //  BANKING HELPERS
 //**************************************************************************
@@ -2378,26 +2488,21 @@ template<int Width, int AddrShift, int Endian> memory_access_cache<Width, AddrSh
 																												  handler_entry_write<Width, AddrShift, Endian> *root_write)
 	: m_space(space),
 	  m_addrmask(space.addrmask()),
-	  m_addrstart_r(1),
-	  m_addrend_r(0),
-	  m_addrstart_w(1),
-	  m_addrend_w(0),
-	  m_cache_r(nullptr),
-	  m_cache_w(nullptr),
 	  m_root_read(root_read),
 	  m_root_write(root_write)
 {
+	for(auto &entry : m_cache_r)
+		entry.invalidate();
+	for(auto &entry : m_cache_w)
+		entry.invalidate();
+
 	m_notifier_id = space.add_change_notifier([this](read_or_write mode) {
-												  if(u32(mode) & u32(read_or_write::READ)) {
-													  m_addrend_r = 0;
-													  m_addrstart_r = 1;
-													  m_cache_r = nullptr;
-												  }
-												  if(u32(mode) & u32(read_or_write::WRITE)) {
-													  m_addrend_w = 0;
-													  m_addrstart_w = 1;
-													  m_cache_w = nullptr;
-												  }
+												  if(u32(mode) & u32(read_or_write::READ))
+													  for(auto &entry : m_cache_r)
+														  entry.invalidate();
+												  if(u32(mode) & u32(read_or_write::WRITE))
+													  for(auto &entry : m_cache_w)
+														  entry.invalidate();
 											  });
 }
 
@@ -2412,6 +2517,68 @@ template<int Width, int AddrShift, int Endian> memory_access_cache<Width, AddrSh
 }
 
 
+//-------------------------------------------------
+//  find_r - bring the range covering an address
+//  to the front of the read cache
+//-------------------------------------------------
+
+template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::find_r(offs_t address)
+{
+	// another way may already have it
+	for(int way = 1; way < CACHE_WAYS; way++)
+		if(m_cache_r[way].contains(address)) {
+			std::rotate(&m_cache_r[0], &m_cache_r[way], &m_cache_r[way + 1]);
+			return;
+		}
+
+	// otherwise, replace the least recently used one
+	std::rotate(&m_cache_r[0], &m_cache_r[CACHE_WAYS - 1], &m_cache_r[CACHE_WAYS]);
+	cache_entry_r &entry = m_cache_r[0];
+	entry.invalidate();
+	m_root_read->lookup(address, entry.m_start, entry.m_end, entry.m_handler);
+
+	if(auto const memory = dynamic_cast<handler_entry_read_memory<Width, AddrShift, Endian> *>(entry.m_handler)) {
+		entry.m_base = memory->get_base();
+		entry.m_address_base = memory->address_base();
+		entry.m_address_mask = memory->address_mask();
+	} else if(auto const bank = dynamic_cast<handler_entry_read_memory_bank<Width, AddrShift, Endian> *>(entry.m_handler)) {
+		entry.m_bank = &bank->get_bank();
+		entry.m_address_base = bank->address_base();
+		entry.m_address_mask = bank->address_mask();
+	}
+}
+
+
+//-------------------------------------------------
+//  find_w - bring the range covering an address
+//  to the front of the write cache
+//-------------------------------------------------
+
+template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::find_w(offs_t address)
+{
+	for(int way = 1; way < CACHE_WAYS; way++)
+		if(m_cache_w[way].contains(address)) {
+			std::rotate(&m_cache_w[0], &m_cache_w[way], &m_cache_w[way + 1]);
+			return;
+		}
+
+	std::rotate(&m_cache_w[0], &m_cache_w[CACHE_WAYS - 1], &m_cache_w[CACHE_WAYS]);
+	cache_entry_w &entry = m_cache_w[0];
+	entry.invalidate();
+	m_root_write->lookup(address, entry.m_start, entry.m_end, entry.m_handler);
+
+	if(auto const memory = dynamic_cast<handler_entry_write_memory<Width, AddrShift, Endian> *>(entry.m_handler)) {
+		entry.m_base = memory->get_base();
+		entry.m_address_base = memory->address_base();
+		entry.m_address_mask = memory->address_mask();
+	} else if(auto const bank = dynamic_cast<handler_entry_write_memory_bank<Width, AddrShift, Endian> *>(entry.m_handler)) {
+		entry.m_bank = &bank->get_bank();
+		entry.m_address_base = bank->address_base();
+		entry.m_address_mask = bank->address_mask();
+	}
+}
+
+
 template class memory_access_cache<0,  1, ENDIANNESS_LITTLE>;
 template class memory_access_cache<0,  1, ENDIANNESS_BIG>;
 template class memory_access_cache<0,  0, ENDIANNESS_LITTLE>;
@@ -671,6 +671,45 @@ private:
 	void remove_handler(handler_entry *handler) { m_handlers.erase(m_handlers.find(handler)); }
 };
 
+// =====================-> Access statistics gathered by the statistics passthrough
+class memory_access_statistics
+{
+	template<int Width, int AddrShift, int Endian> friend class handler_entry_read_statistics;
+	template<int Width, int AddrShift, int Endian> friend class handler_entry_write_statistics;
+
+public:
+	struct counts
+	{
+		u64 m_reads = 0;
+		u64 m_writes = 0;
+	};
+
+	memory_access_statistics(u8 page_shift) : m_page_shift(page_shift) {}
+
+	// getters
+	u8 page_shift() const { return m_page_shift; }
+	std::map<std::string, counts> handlers() const;
+	const std::unordered_map<offs_t, counts> &pages() const { return m_pages; }
+
+	// clear all the counts, keeping the handlers being counted
+	void reset();
+
+private:
+	struct handler_slot
+	{
+		std::string m_name;
+		counts m_counts;
+	};
+
+	u8 m_page_shift;                                // address bits below the page number
+	std::vector<handler_slot> m_handlers;           // one slot per instantiated passthrough
+	std::unordered_map<offs_t, counts> m_pages;     // counts by page number
+
+	u32 add_handler(std::string &&name) { m_handlers.emplace_back(handler_slot{ std::move(name), counts() }); return m_handlers.size() - 1; }
+	void count_read(u32 slot, offs_t offset) { m_handlers[slot].m_counts.m_reads++; m_pages[offset >> m_page_shift].m_reads++; }
+	void count_write(u32 slot, offs_t offset) { m_handlers[slot].m_counts.m_writes++; m_pages[offset >> m_page_shift].m_writes++; }
+};
+
 // =====================-> Forward declaration for address_space
 
 template<int Width, int AddrShift, int Endian> class handler_entry_read_unmapped;
@@ -941,6 +980,72 @@ template<int Width, int AddrShift, int Endian, int TargetWidth, bool Aligned, ty
 }
 
 
+// ======================> generic block read/write routines
+
+// generic block read; copies straight out of memory-backed ranges and only
+// calls the handler once per unit where there is no direct pointer
+template<int Width, int AddrShift, int Endian> void memory_read_block(handler_entry_read<Width, AddrShift, Endian> *root, offs_t addrmask, offs_t address, typename emu::detail::handler_entry_size<Width>::uX *data, u32 count)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+
+	constexpr u32 NATIVE_BYTES = 1 << Width;
+	constexpr u32 NATIVE_STEP = AddrShift >= 0 ? NATIVE_BYTES << iabs(AddrShift) : NATIVE_BYTES >> iabs(AddrShift);
+	constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+
+	address &= addrmask & ~NATIVE_MASK;
+	while (count != 0)
+	{
+		// find the handler covering this address and how much of the block it serves
+		offs_t start, end;
+		handler_entry_read<Width, AddrShift, Endian> *handler;
+		root->lookup(address, start, end, handler);
+		u32 const chunk = u32(std::min<u64>(count, u64(end - address) / NATIVE_STEP + 1));
+
+		// the pointer may wrap inside the range when the handler is mirrored, so make sure it's linear
+		NativeType const *const src = reinterpret_cast<NativeType const *>(handler->get_ptr(address));
+		if (src && reinterpret_cast<NativeType const *>(handler->get_ptr(address + (chunk - 1) * NATIVE_STEP)) == src + chunk - 1)
+			std::copy_n(src, chunk, data);
+		else
+			for (u32 index = 0; index < chunk; index++)
+				data[index] = handler->read(address + index * NATIVE_STEP, ~NativeType(0));
+
+		data += chunk;
+		count -= chunk;
+		address = (address + chunk * NATIVE_STEP) & addrmask;
+	}
+}
+
+// generic block write
+template<int Width, int AddrShift, int Endian> void memory_write_block(handler_entry_write<Width, AddrShift, Endian> *root, offs_t addrmask, offs_t address, typename emu::detail::handler_entry_size<Width>::uX const *data, u32 count)
+{
+	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
+
+	constexpr u32 NATIVE_BYTES = 1 << Width;
+	constexpr u32 NATIVE_STEP = AddrShift >= 0 ? NATIVE_BYTES << iabs(AddrShift) : NATIVE_BYTES >> iabs(AddrShift);
+	constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+
+	address &= addrmask & ~NATIVE_MASK;
+	while (count != 0)
+	{
+		offs_t start, end;
+		handler_entry_write<Width, AddrShift, Endian> *handler;
+		root->lookup(address, start, end, handler);
+		u32 const chunk = u32(std::min<u64>(count, u64(end - address) / NATIVE_STEP + 1));
+
+		NativeType *const dest = reinterpret_cast<NativeType *>(handler->get_ptr(address));
+		if (dest && reinterpret_cast<NativeType *>(handler->get_ptr(address + (chunk - 1) * NATIVE_STEP)) == dest + chunk - 1)
+			std::copy_n(data, chunk, dest);
+		else
+			for (u32 index = 0; index < chunk; index++)
+				handler->write(address + index * NATIVE_STEP, data[index], ~NativeType(0));
+
+		data += chunk;
+		count -= chunk;
+		address = (address + chunk * NATIVE_STEP) & addrmask;
+	}
+}
+
+
 // ======================> memory_access_cache
 
 // memory_access_cache contains state data for cached access
@@ -949,6 +1054,27 @@ template<int Width, int AddrShift, int Endian> class memory_access_cache
 	using NativeType = typename emu::detail::handler_entry_size<Width>::uX;
 	static constexpr u32 NATIVE_BYTES = 1 << Width;
 	static constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+	static constexpr int CACHE_WAYS = 4;
+
+	// a cached handler range; plain and banked memory are accessed directly,
+	// the bank base being read on every access so that switching entries
+	// doesn't need to touch the cache
+	template<typename Handler> struct cache_entry
+	{
+		offs_t          m_start;
+		offs_t          m_end;
+		Handler *       m_handler;
+		NativeType *    m_base;
+		memory_bank *   m_bank;
+		offs_t          m_address_base;
+		offs_t          m_address_mask;
+
+		bool contains(offs_t address) const { return address >= m_start && address <= m_end; }
+		void invalidate() { m_start = 1; m_end = 0; m_handler = nullptr; m_base = nullptr; m_bank = nullptr; }
+		inline NativeType *direct(offs_t address) const;
+	};
+	using cache_entry_r = cache_entry<handler_entry_read <Width, AddrShift, Endian> >;
+	using cache_entry_w = cache_entry<handler_entry_write<Width, AddrShift, Endian> >;
 
 public:
 	// construction/destruction
@@ -961,26 +1087,30 @@ public:
 	// getters
 	address_space &space() const { return m_space; }
 
-	// see if an address is within bounds, update it if not
+	// see if an address is within the most recent range, update it if not
 	void check_address_r(offs_t address) {
-		if(address >= m_addrstart_r && address <= m_addrend_r)
+		if(m_cache_r[0].contains(address))
 			return;
-		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		find_r(address);
 	}
 
 	void check_address_w(offs_t address) {
-		if(address >= m_addrstart_w && address <= m_addrend_w)
+		if(m_cache_w[0].contains(address))
 			return;
-		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		find_w(address);
 	}
 
 	// accessor methods
 
 	void *read_ptr(offs_t address) {
 		check_address_r(address);
-		return m_cache_r->get_ptr(address);
+		return m_cache_r[0].m_handler->get_ptr(address);
 	}
 
+	// block accessors; count is in native units, data is in host order
+	void read_block(offs_t address, NativeType *data, u32 count) { memory_read_block<Width, AddrShift, Endian>(m_root_read, m_addrmask, address, data, count); }
+	void write_block(offs_t address, NativeType const *data, u32 count) { memory_write_block<Width, AddrShift, Endian>(m_root_write, m_addrmask, address, data, count); }
+
 	u8 read_byte(offs_t address) { address &= m_addrmask; return Width == 0 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 0, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xff); }
 	u16 read_word(offs_t address) { address &= m_addrmask; return Width == 1 ? read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, 0xffff); }
 	u16 read_word(offs_t address, u16 mask) { address &= m_addrmask; return memory_read_generic<Width, AddrShift, Endian, 1, true>([this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }, address, mask); }
@@ -1015,18 +1145,17 @@ private:
 	int                         m_notifier_id;             // id to remove the notifier on destruction
 
 	offs_t                      m_addrmask;                // address mask
-	offs_t                      m_addrstart_r;             // minimum valid address for reading
-	offs_t                      m_addrend_r;               // maximum valid address for reading
-	offs_t                      m_addrstart_w;             // minimum valid address for writing
-	offs_t                      m_addrend_w;               // maximum valid address for writing
-	handler_entry_read<Width, AddrShift, Endian> *m_cache_r;   // read cache
-	handler_entry_write<Width, AddrShift, Endian> *m_cache_w;  // write cache
+	cache_entry_r               m_cache_r[CACHE_WAYS];     // read cache, most recently used first
+	cache_entry_w               m_cache_w[CACHE_WAYS];     // write cache, most recently used first
 
 	handler_entry_read <Width, AddrShift, Endian> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift, Endian> *m_root_write;
 
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
+
+	void find_r(offs_t address);
+	void find_w(offs_t address);
 };
 
 
@@ -1191,6 +1320,17 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors; count is in units of the data width, and data is an
+	// array of that width in host order
+	virtual void read_block(offs_t address, void *data, u32 count) = 0;
+	virtual void write_block(offs_t address, void const *data, u32 count) = 0;
+
+	// access statistics; counts every access through the handlers present
+	// when enabled, with pages of 1 << page_shift addresses
+	memory_access_statistics *access_statistics() const { return m_access_statistics.get(); }
+	void enable_access_statistics(u8 page_shift = 12);
+	void disable_access_statistics();
+
 	// address-to-byte conversion helpers
 	offs_t address_to_byte(offs_t address) const { return m_config.addr2byte(address); }
 	offs_t address_to_byte_end(offs_t address) const { return m_config.addr2byte_end(address); }
@@ -1446,6 +1586,7 @@ protected:
 	virtual void install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, void *baseptr) = 0;
 	virtual void install_bank_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, std::string rtag, std::string wtag) = 0;
 	virtual void install_bank_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, memory_bank *rbank, memory_bank *wbank) = 0;
+	virtual memory_passthrough_handler *install_access_statistics(memory_access_statistics &stats) = 0;
 	void adjust_addresses(offs_t &start, offs_t &end, offs_t &mask, offs_t &mirror);
 	void *find_backing_memory(offs_t addrstart, offs_t addrend);
 	bool needs_backing_store(const address_map_entry &entry);
@@ -1476,6 +1617,9 @@ protected:
 
 	std::vector<std::unique_ptr<memory_passthrough_handler>> m_mphs;
 
+	std::unique_ptr<memory_access_statistics> m_access_statistics;
+	memory_passthrough_handler *m_access_statistics_mph;
+
 	std::vector<notifier_t> m_notifiers;        // notifier list for address map change
 	int                     m_notifier_id;      // next notifier id
 	u32                     m_in_notification;  // notification(s) currently being done
@@ -1795,16 +1939,28 @@ private:
 #define QWORD_ALIGNED(a)                (((a) & 7) == 0)
 
 
+// defined here rather than in the class so that memory_bank is complete
+template<int Width, int AddrShift, int Endian> template<typename Handler> typename emu::detail::handler_entry_size<Width>::uX *memory_access_cache<Width, AddrShift, Endian>::cache_entry<Handler>::direct(offs_t address) const
+{
+	NativeType *base = m_bank ? reinterpret_cast<NativeType *>(m_bank->base()) : m_base;
+	return base ? base + (((address - m_address_base) & m_address_mask) >> (Width + AddrShift)) : nullptr;
+}
+
 template<int Width, int AddrShift, int Endian> typename emu::detail::handler_entry_size<Width>::uX memory_access_cache<Width, AddrShift, Endian>::read_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX mask)
 {
 	check_address_r(address);
-	return m_cache_r->read(address, mask);
+	if(NativeType const *const ptr = m_cache_r[0].direct(address))
+		return *ptr;
+	return m_cache_r[0].m_handler->read(address, mask);
 }
 
 template<int Width, int AddrShift, int Endian> void memory_access_cache<Width, AddrShift, Endian>::write_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX data, typename emu::detail::handler_entry_size<Width>::uX mask)
 {
 	check_address_w(address);
-	m_cache_w->write(address, data, mask);
+	if(NativeType *const ptr = m_cache_w[0].direct(address))
+		*ptr = (*ptr & ~mask) | (data & mask);
+	else
+		m_cache_w[0].m_handler->write(address, data, mask);
 }
 
 void memory_passthrough_handler::remove()
@@ -18,6 +18,9 @@ public:
 		m_address_mask = mask;
 	}
 
+	offs_t address_base() const { return m_address_base; }
+	offs_t address_mask() const { return m_address_mask; }
+
 protected:
 	offs_t m_address_base, m_address_mask;
 };
@@ -35,6 +38,9 @@ public:
 		m_address_mask = mask;
 	}
 
+	offs_t address_base() const { return m_address_base; }
+	offs_t address_mask() const { return m_address_mask; }
+
 protected:
 	offs_t m_address_base, m_address_mask;
 };
@@ -18,6 +18,7 @@ public:
 	void *get_ptr(offs_t offset) const override;
 
 	inline void set_base(uX *base) { m_base = base; }
+	uX *get_base() const { return m_base; }
 
 	std::string name() const override;
 
@@ -38,6 +39,7 @@ public:
 	void *get_ptr(offs_t offset) const override;
 
 	inline void set_base(uX *base) { m_base = base; }
+	uX *get_base() const { return m_base; }
 
 	std::string name() const override;
 
@@ -64,6 +66,8 @@ public:
 
 	std::string name() const override;
 
+	memory_bank &get_bank() const { return m_bank; }
+
 private:
 	memory_bank &m_bank;
 };
@@ -82,6 +86,8 @@ public:
 
 	std::string name() const override;
 
+	memory_bank &get_bank() const { return m_bank; }
+
 private:
 	memory_bank &m_bank;
 };
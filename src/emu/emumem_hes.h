@@ -0,0 +1,50 @@
+// license:BSD-3-Clause
+// copyright-holders:Olivier Galibert
+
+// handler_entry_read_statistics/handler_entry_write_statistics
+
+// handler which counts bus accesses per handler and per page before passing them on
+
+template<int Width, int AddrShift, int Endian> class handler_entry_read_statistics : public handler_entry_read_passthrough<Width, AddrShift, Endian>
+{
+public:
+	using uX = typename emu::detail::handler_entry_size<Width>::uX;
+	using inh = handler_entry_read_passthrough<Width, AddrShift, Endian>;
+
+	handler_entry_read_statistics(address_space *space, memory_passthrough_handler &mph, memory_access_statistics &stats) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph), m_stats(stats), m_slot(0) {}
+	~handler_entry_read_statistics() = default;
+
+	uX read(offs_t offset, uX mem_mask) override;
+
+	std::string name() const override;
+
+	handler_entry_read_statistics<Width, AddrShift, Endian> *instantiate(handler_entry_read<Width, AddrShift, Endian> *next) const override;
+
+protected:
+	memory_access_statistics &m_stats;
+	u32 m_slot;
+
+	handler_entry_read_statistics(address_space *space, memory_passthrough_handler &mph, handler_entry_read<Width, AddrShift, Endian> *next, memory_access_statistics &stats) : handler_entry_read_passthrough<Width, AddrShift, Endian>(space, mph, next), m_stats(stats), m_slot(stats.add_handler(next->name())) {}
+};
+
+template<int Width, int AddrShift, int Endian> class handler_entry_write_statistics : public handler_entry_write_passthrough<Width, AddrShift, Endian>
+{
+public:
+	using uX = typename emu::detail::handler_entry_size<Width>::uX;
+	using inh = handler_entry_write_passthrough<Width, AddrShift, Endian>;
+
+	handler_entry_write_statistics(address_space *space, memory_passthrough_handler &mph, memory_access_statistics &stats) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph), m_stats(stats), m_slot(0) {}
+	~handler_entry_write_statistics() = default;
+
+	void write(offs_t offset, uX data, uX mem_mask) override;
+
+	std::string name() const override;
+
+	handler_entry_write_statistics<Width, AddrShift, Endian> *instantiate(handler_entry_write<Width, AddrShift, Endian> *next) const override;
+
+protected:
+	memory_access_statistics &m_stats;
+	u32 m_slot;
+
+	handler_entry_write_statistics(address_space *space, memory_passthrough_handler &mph, handler_entry_write<Width, AddrShift, Endian> *next, memory_access_statistics &stats) : handler_entry_write_passthrough<Width, AddrShift, Endian>(space, mph, next), m_stats(stats), m_slot(stats.add_handler(next->name())) {}
+};
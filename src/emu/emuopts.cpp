@@ -89,6 +89,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_ADAPTIVE_QUANTUM ";aq",                     "0",         OPTION_BOOLEAN,    "only use perfect interleave for timeslices following an interaction between devices" },
+	{ OPTION_ADAPTIVE_QUANTUM_AUDIT,                     "0",         OPTION_BOOLEAN,    "keep perfect interleave, but log interactions that adaptive quantum would have missed" },
+	{ OPTION_IDLESKIP,                                   "0",         OPTION_BOOLEAN,    "let CPU cores skip polling loops over plain memory that repeat until the end of the timeslice (may break timing-sensitive drivers)" },
+	{ OPTION_IDLESKIP_AUDIT,                             "0",         OPTION_BOOLEAN,    "detect polling loops that idle skipping would shorten, but run them and report them on exit" },
+	{ OPTION_ROM_CACHE "(0-4096)",                       "0",         OPTION_INTEGER,    "megabytes of loaded ROM regions to keep for hard resets and later runs in the same session (0 = disabled)" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -176,6 +181,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DEBUG ";d",                                 "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
+	{ OPTION_PC_PROFILE,                                 "0",         OPTION_INTEGER,    "sample each CPU's program counter every N microseconds of host time and write a histogram on exit (0 to disable)" },
+	{ OPTION_PROFILE_SOUND,                              "0",         OPTION_BOOLEAN,    "measure host time spent in each sound stream and the final mix, and report it on exit" },
+	{ OPTION_PROFILE_TRACE,                              "0",         OPTION_BOOLEAN,    "record a timeline of profiler scopes, timeslices, device execution and OSD updates on all threads, and write it as a Chrome trace (trace.json) on exit" },
+	{ OPTION_MEMSTATS,                                   "0",         OPTION_BOOLEAN,    "report the memory used by each device for regions, shares, save states, graphics, tilemaps and DRC caches on exit" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -191,6 +200,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_OPTIMIZE_UML,                           "0",         OPTION_BOOLEAN,    "apply dataflow optimizations to DRC UML before code generation" },
+	{ OPTION_DRC_CACHE_DIRECTORY,                        "",          OPTION_STRING,     "directory to save the list of compiled DRC blocks for recompiling on the next run (empty to disable)" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -201,6 +212,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UI_MOUSE,                                   "1",         OPTION_BOOLEAN,    "display UI mouse cursor" },
 	{ OPTION_LANGUAGE ";lang",                           "English",   OPTION_STRING,     "set UI display language" },
 	{ OPTION_NVRAM_SAVE ";nvwrite",                      "1",         OPTION_BOOLEAN,    "save NVRAM data on exit" },
+	{ OPTION_NVRAM_SAVE_INTERVAL,                        "0",         OPTION_INTEGER,    "also save NVRAM data every N seconds of emulated time (0 = only on exit)" },
+	{ OPTION_STARTUP_PROFILE,                            "0",         OPTION_BOOLEAN,    "print the time taken by each phase of machine startup" },
+	{ OPTION_TAPE_TURBO,                                 "0",         OPTION_BOOLEAN,    "fast-forward while a cassette is playing with its motor on" },
 
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "SCRIPTING OPTIONS" },
 	{ OPTION_AUTOBOOT_COMMAND ";ab",                     nullptr,     OPTION_STRING,     "command to execute after machine boot" },
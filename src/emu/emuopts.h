@@ -76,6 +76,11 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_ADAPTIVE_QUANTUM     "adaptivequantum"
+#define OPTION_ADAPTIVE_QUANTUM_AUDIT "adaptivequantumaudit"
+#define OPTION_IDLESKIP             "idleskip"
+#define OPTION_IDLESKIP_AUDIT       "idleskipaudit"
+#define OPTION_ROM_CACHE            "romcache"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -154,12 +159,18 @@
 #define OPTION_OSLOG                "oslog"
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
+#define OPTION_PC_PROFILE           "pcprofile"
+#define OPTION_PROFILE_SOUND        "profile_sound"
+#define OPTION_PROFILE_TRACE        "profile_trace"
+#define OPTION_MEMSTATS             "memstats"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_OPTIMIZE_UML     "drc_optimize_uml"
+#define OPTION_DRC_CACHE_DIRECTORY  "drc_cache_directory"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -167,6 +178,9 @@
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
 #define OPTION_NVRAM_SAVE           "nvram_save"
+#define OPTION_NVRAM_SAVE_INTERVAL  "nvram_save_interval"
+#define OPTION_STARTUP_PROFILE      "startup_profile"
+#define OPTION_TAPE_TURBO           "tape_turbo"
 
 // core comm options
 #define OPTION_COMM_LOCAL_HOST      "comm_localhost"
@@ -354,6 +368,11 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool adaptive_quantum() const { return bool_value(OPTION_ADAPTIVE_QUANTUM); }
+	bool adaptive_quantum_audit() const { return bool_value(OPTION_ADAPTIVE_QUANTUM_AUDIT); }
+	bool idle_skip() const { return bool_value(OPTION_IDLESKIP); }
+	bool idle_skip_audit() const { return bool_value(OPTION_IDLESKIP_AUDIT); }
+	int rom_cache() const { return int_value(OPTION_ROM_CACHE); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -430,12 +449,18 @@ public:
 	bool oslog() const { return bool_value(OPTION_OSLOG); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
+	int pc_profile() const { return int_value(OPTION_PC_PROFILE); }
+	bool profile_sound() const { return bool_value(OPTION_PROFILE_SOUND); }
+	bool profile_trace() const { return bool_value(OPTION_PROFILE_TRACE); }
+	bool memstats() const { return bool_value(OPTION_MEMSTATS); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_optimize_uml() const { return bool_value(OPTION_DRC_OPTIMIZE_UML); }
+	const char *drc_cache_directory() const { return value(OPTION_DRC_CACHE_DIRECTORY); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -443,6 +468,9 @@ public:
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
 	bool nvram_save() const { return bool_value(OPTION_NVRAM_SAVE); }
+	int nvram_save_interval() const { return int_value(OPTION_NVRAM_SAVE_INTERVAL); }
+	bool startup_profile() const { return bool_value(OPTION_STARTUP_PROFILE); }
+	bool tape_turbo() const { return bool_value(OPTION_TAPE_TURBO); }
 
 	// core comm options
 	const char *comm_localhost() const { return value(OPTION_COMM_LOCAL_HOST); }
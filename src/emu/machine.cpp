@@ -119,6 +119,7 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_hard_reset_pending(false),
 		m_exit_pending(false),
 		m_soft_reset_timer(nullptr),
+		m_nvram_save_timer(nullptr),
 		m_rand_seed(0x9d14abd7),
 		m_ui_active(_config.options().ui_active()),
 		m_basename(_config.gamedrv().name),
@@ -188,6 +189,18 @@ std::string running_machine::describe_context() const
 
 void running_machine::start()
 {
+	// with -startup_profile, time each phase from here on
+	osd_ticks_t phase_start = osd_ticks();
+	auto const end_phase = [this, &phase_start] (const char *name)
+	{
+		if (options().startup_profile())
+		{
+			osd_ticks_t const now = osd_ticks();
+			record_startup_time(name, now - phase_start);
+			phase_start = now;
+		}
+	};
+
 	// initialize basic can't-fail systems here
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
@@ -198,15 +211,22 @@ void running_machine::start()
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
 
+	// allocate a timer for periodic NVRAM saves
+	m_nvram_save_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::periodic_nvram_save), this));
+
 	// initialize UI input
 	m_ui_input = make_unique_clear<ui_input_manager>(*this);
 
+	end_phase("core managers");
+
 	// init the osd layer
 	m_manager.osd().init(*this);
+	end_phase("OSD init");
 
 	// create the video manager
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
+	end_phase("video and UI");
 
 	// initialize the base time (needed for doing record/playback)
 	::time(&m_base_time);
@@ -217,6 +237,7 @@ void running_machine::start()
 	time_t newbase = m_ioport.initialize();
 	if (newbase != 0)
 		m_base_time = newbase;
+	end_phase("input ports");
 
 	// initialize the streams engine before the sound devices start
 	m_sound = std::make_unique<sound_manager>(*this);
@@ -231,7 +252,9 @@ void running_machine::start()
 	// complete address spaces).  These operations must proceed in this
 	// order
 	m_rom_load = make_unique_clear<rom_load_manager>(*this);
+	end_phase("ROM loading");
 	m_memory.initialize();
+	end_phase("memory maps");
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -249,7 +272,10 @@ void running_machine::start()
 		m_debugger = std::make_unique<debugger_manager>(*this);
 	}
 
+	end_phase("image, tilemap and debugger managers");
+
 	manager().create_custom(*this);
+	end_phase("plugins");
 
 	// resolve objects that are created by memory maps
 	for (device_t &device : device_iterator(root_device()))
@@ -259,16 +285,20 @@ void running_machine::start()
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
+	end_phase("post-map object resolution");
 	start_all_devices();
+	end_phase("device start (all)");
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// save outputs created before start time
 	output().register_save();
 
 	m_render->resolve_tags();
+	end_phase("layouts");
 
 	// load cheat files
 	manager().load_cheatfiles(*this);
+	end_phase("cheats");
 
 	// start recording movie if specified
 	const char *filename = options().mng_write();
@@ -288,6 +318,14 @@ void running_machine::start()
 	else if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) != 0)
 		schedule_load("auto");
 
+	// with -profile_trace, record a timeline until the machine exits
+	if (options().profile_trace())
+		g_profiler_trace.start(*this);
+
+	// with -memstats, report memory usage once the machine has run
+	if (options().memstats())
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::report_memory_usage, this));
+
 	manager().update_machine();
 }
 
@@ -324,16 +362,28 @@ int running_machine::run(bool quiet)
 		start();
 
 		// load the configuration settings
+		osd_ticks_t const config_start = osd_ticks();
 		manager().before_load_settings(*this);
 		m_configuration->load_settings();
+		if (options().startup_profile())
+			record_startup_time("configuration", osd_ticks() - config_start);
 
 		// disallow save state registrations starting here.
 		// Don't do it earlier, config load can create network
 		// devices with timers.
 		m_save.allow_registration(false);
 
-		// load the NVRAM
+		// load the NVRAM, and save it periodically if requested
+		osd_ticks_t const nvram_start = osd_ticks();
 		nvram_load();
+		if (options().startup_profile())
+			record_startup_time("NVRAM", osd_ticks() - nvram_start);
+		report_startup_times();
+		if (options().nvram_save() && options().nvram_save_interval() > 0)
+		{
+			attotime const period = attotime::from_seconds(options().nvram_save_interval());
+			m_nvram_save_timer->adjust(period, 0, period);
+		}
 
 		// set the time on RTCs (this may overwrite parts of NVRAM)
 		set_rtc_datetime(system_time(m_base_time));
@@ -377,6 +427,8 @@ int running_machine::run(bool quiet)
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+			else
+				finish_async_save(false);
 
 			g_profiler.stop();
 		}
@@ -390,6 +442,9 @@ int running_machine::run(bool quiet)
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
+
+		// the final state file must be on disk before we go away
+		finish_async_save(true);
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -658,6 +713,9 @@ void running_machine::immediate_save(const char *filename)
 
 	// jump right into the save, anonymous timers can't hurt us!
 	handle_saveload();
+
+	// callers expect the file to be complete when we return
+	finish_async_save(true);
 }
 
 
@@ -928,52 +986,47 @@ void running_machine::handle_saveload()
 		}
 		else
 		{
+			// a state file still being written must be complete before it is replaced or read back
+			finish_async_save(true);
+
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (filerr == osd_file::error::NONE)
 			{
-				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
-
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
-
-				// handle the result
-				switch (saverr)
+				if (m_saveload_schedule == saveload_schedule::LOAD)
 				{
-				case STATERR_ILLEGAL_REGISTRATIONS:
-					popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
-					break;
-
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
-					break;
-
-				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+					// read the save state
+					report_saveload(m_save.read_file(*file), true);
+				}
+				else
+				{
+					// capture the state now, then compress and write it without holding up emulation
+					std::vector<u8> data;
+					save_error const saverr = m_save.write_snapshot(data);
+					if (saverr == STATERR_NONE)
+					{
+						m_async_save = std::async(
+								std::launch::async,
+								[file = std::move(file), data = std::move(data)] () mutable
+								{
+									save_error const result = save_manager::write_snapshot_file(*file, data);
+
+									// close and perhaps delete the file
+									if (result != STATERR_NONE)
+										file->remove_on_close();
+									file.reset();
+									return result;
+								});
+					}
 					else
-						popmessage("State successfully %s.", opnamed);
-					break;
-
-				default:
-					popmessage("Error: Unknown error during state %s.", opnamed);
-					break;
+					{
+						report_saveload(saverr, false);
+						file->remove_on_close();
+					}
 				}
-
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
 			}
 			else if (openflags == OPEN_FLAG_READ && filerr == osd_file::error::NOT_FOUND)
 				// attempt to load a non-existent savestate, report empty slot
@@ -990,6 +1043,66 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_saveload - tell the user how a save or
+//  load went
+//-------------------------------------------------
+
+void running_machine::report_saveload(save_error saverr, bool load)
+{
+	const char *const opname = load ? "load" : "save";
+	const char *const opnamed = load ? "loaded" : "saved";
+
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
+		break;
+
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+		else
+			popmessage("State successfully %s.", opnamed);
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state %s.", opnamed);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  finish_async_save - report the result of a
+//  background state file write once it is done,
+//  optionally waiting for it
+//-------------------------------------------------
+
+void running_machine::finish_async_save(bool wait)
+{
+	if (!m_async_save.valid())
+		return;
+
+	if (!wait && (m_async_save.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+		return;
+
+	report_saveload(m_async_save.get(), false);
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1034,6 +1147,7 @@ void running_machine::start_all_devices()
 	m_dummy_space.start();
 
 	// iterate through the devices
+	bool const profile = options().startup_profile();
 	int last_failed_starts = -1;
 	while (last_failed_starts != 0)
 	{
@@ -1051,7 +1165,10 @@ void running_machine::start_all_devices()
 
 					// now start the device
 					osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
+					osd_ticks_t const device_start = profile ? osd_ticks() : 0;
 					device.start();
+					if (profile)
+						record_startup_time(string_format("start %s '%s'", device.shortname(), device.tag()), osd_ticks() - device_start);
 				}
 
 				// handle missing dependencies by moving the device to the end
@@ -1205,6 +1322,165 @@ void running_machine::nvram_save()
 }
 
 
+
+//-------------------------------------------------
+//  record_startup_time - note the time taken by a
+//  startup phase; callers only do this when
+//  -startup_profile is on
+//-------------------------------------------------
+
+void running_machine::record_startup_time(std::string &&name, osd_ticks_t ticks)
+{
+	m_startup_times.emplace_back(std::move(name), ticks);
+}
+
+
+//-------------------------------------------------
+//  report_startup_times - print the recorded
+//  startup phases, slowest first
+//-------------------------------------------------
+
+void running_machine::report_startup_times()
+{
+	if (m_startup_times.empty())
+		return;
+
+	std::stable_sort(
+			m_startup_times.begin(),
+			m_startup_times.end(),
+			[] (auto const &a, auto const &b) { return a.second > b.second; });
+
+	double const ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+	osd_printf_info("Startup profile:\n");
+	for (auto const &phase : m_startup_times)
+		osd_printf_info("%10.3f ms  %s\n", double(phase.second) * ms_per_tick, phase.first);
+	m_startup_times.clear();
+}
+
+
+//-------------------------------------------------
+//  add_memory_usage - account for an allocation
+//  made on behalf of a device that no manager
+//  knows about
+//-------------------------------------------------
+
+void running_machine::add_memory_usage(device_t &device, const char *category, size_t bytes)
+{
+	m_memory_usage.emplace_back(&device, category, bytes);
+}
+
+
+//-------------------------------------------------
+//  memory_usage - return the bytes used by each
+//  device, by category
+//-------------------------------------------------
+
+std::map<std::string, std::map<std::string, u64> > running_machine::memory_usage()
+{
+	std::map<std::string, std::map<std::string, u64> > result;
+
+	// regions and shares are named by tag; charge them to the closest device
+	auto const owner = [this] (std::string tag) -> device_t &
+	{
+		for (;;)
+		{
+			device_t *const device = root_device().subdevice(tag.c_str());
+			if (device != nullptr)
+				return *device;
+			std::string::size_type const colon = tag.find_last_of(':');
+			if (colon == std::string::npos || colon == 0)
+				return root_device();
+			tag.erase(colon);
+		}
+	};
+	for (auto const &region : memory().regions())
+		result[owner(region.first).tag()]["regions"] += region.second->bytes();
+	for (auto const &share : memory().shares())
+		result[owner(share.first).tag()]["shares"] += share.second->bytes();
+
+	// save state registrations and decoded graphics belong to their devices
+	result[root_device().tag()]["save"] += save().registered_bytes(nullptr);
+	for (device_t &device : device_iterator(root_device()))
+	{
+		size_t const bytes = save().registered_bytes(&device);
+		if (bytes != 0)
+			result[device.tag()]["save"] += bytes;
+	}
+	for (device_gfx_interface &gfx : gfx_interface_iterator(root_device()))
+		for (int index = 0; index < MAX_GFX_ELEMENTS; index++)
+			if (gfx.gfx(index) != nullptr)
+				result[gfx.device().tag()]["gfx"] += gfx.gfx(index)->memory_usage();
+
+	// tilemaps belong to their own device, or else to their decoder's
+	for (int index = 0; index < tilemap().count(); index++)
+	{
+		tilemap_t &tmap = *tilemap().find(index);
+		device_t *const device = dynamic_cast<device_t *>(&tmap);
+		result[((device != nullptr) ? *device : tmap.decoder().device()).tag()]["tilemaps"] += tmap.memory_usage();
+	}
+
+	// then everything that was registered directly
+	for (auto const &usage : m_memory_usage)
+		result[std::get<0>(usage)->tag()][std::get<1>(usage)] += std::get<2>(usage);
+
+	return result;
+}
+
+
+//-------------------------------------------------
+//  report_memory_usage - print the memory used by
+//  each device, largest first
+//-------------------------------------------------
+
+void running_machine::report_memory_usage()
+{
+	std::vector<std::pair<std::string, std::map<std::string, u64> > > devices;
+	u64 total = 0;
+	for (auto &device : memory_usage())
+	{
+		for (auto const &category : device.second)
+			total += category.second;
+		devices.emplace_back(device.first, std::move(device.second));
+	}
+
+	auto const device_total = [] (std::map<std::string, u64> const &categories)
+	{
+		u64 bytes = 0;
+		for (auto const &category : categories)
+			bytes += category.second;
+		return bytes;
+	};
+	std::stable_sort(
+			devices.begin(),
+			devices.end(),
+			[&device_total] (auto const &a, auto const &b) { return device_total(a.second) > device_total(b.second); });
+
+	osd_printf_info("Memory usage: %.1f KiB total\n", double(total) / 1024.0);
+	for (auto const &device : devices)
+	{
+		std::ostringstream detail;
+		char const *separator = "";
+		for (auto const &category : device.second)
+		{
+			util::stream_format(detail, "%s%s %.1f", separator, category.first, double(category.second) / 1024.0);
+			separator = ", ";
+		}
+		osd_printf_info("%10.1f KiB  '%s' (%s)\n", double(device_total(device.second)) / 1024.0, device.first, detail.str());
+	}
+}
+
+
+//-------------------------------------------------
+//  periodic_nvram_save - save NVRAM from a timer,
+//  so it survives an unclean shutdown
+//-------------------------------------------------
+
+void running_machine::periodic_nvram_save(void *ptr, s32 param)
+{
+	nvram_save();
+}
+
+
 //**************************************************************************
 //  OUTPUT
 //**************************************************************************
@@ -1269,6 +1545,45 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		m_manager.http()->add_http_handler("/api/performance", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			rapidjson::StringBuffer s;
+			rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+			writer.StartObject();
+			writer.Key("time");
+			writer.Double(time().as_double());
+			writer.Key("paused");
+			writer.Bool(paused());
+			writer.Key("speed");
+			writer.Double(video().speed_percent());
+			writer.Key("throttled");
+			writer.Bool(video().throttled());
+			writer.Key("frameskip");
+			writer.Int(video().frameskip());
+			writer.Key("effective_frameskip");
+			writer.Int(video().effective_frameskip());
+
+			writer.Key("screens");
+			writer.StartArray();
+
+			for (screen_device &screen : screen_device_iterator(this->root_device()))
+			{
+				writer.StartObject();
+				writer.Key("tag");
+				writer.String(screen.tag());
+				writer.Key("frame");
+				writer.Uint64(screen.frame_number());
+				writer.EndObject();
+			}
+
+			writer.EndArray();
+			writer.EndObject();
+
+			response->set_status(200);
+			response->set_content_type("application/json");
+			response->set_body(s.GetString());
+		});
 	}
 }
 
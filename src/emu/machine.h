@@ -18,6 +18,9 @@
 #define MAME_EMU_MACHINE_H
 
 #include <functional>
+#include <future>
+#include <map>
+#include <tuple>
 
 #include <ctime>
 
@@ -258,6 +261,10 @@ public:
 	std::string compose_saveload_filename(std::string &&base_filename, const char **searchpath = nullptr);
 	std::string get_statename(const char *statename_opt) const;
 
+	// memory accounting
+	void add_memory_usage(device_t &device, const char *category, size_t bytes);
+	std::map<std::string, std::map<std::string, u64> > memory_usage();
+
 private:
 	// side effect disable counter
 	u32                     m_side_effects_disabled;
@@ -295,10 +302,16 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_saveload(save_error saverr, bool load);
+	void finish_async_save(bool wait);
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
 	void nvram_save();
+	void periodic_nvram_save(void *ptr = nullptr, s32 param = 0);
+	void record_startup_time(std::string &&name, osd_ticks_t ticks);
+	void report_startup_times();
+	void report_memory_usage();
 	void popup_clear() const;
 	void popup_message(util::format_argument_pack<std::ostream> const &args) const;
 
@@ -340,6 +353,7 @@ private:
 	bool                    m_hard_reset_pending;   // is a hard reset pending?
 	bool                    m_exit_pending;         // is an exit pending?
 	emu_timer *             m_soft_reset_timer;     // timer used to schedule a soft reset
+	emu_timer *             m_nvram_save_timer;     // timer used for periodic NVRAM saves
 
 	// misc state
 	u32                     m_rand_seed;            // current random number seed
@@ -348,6 +362,8 @@ private:
 	std::string             m_basename;             // basename used for game-related paths
 	int                     m_sample_rate;          // the digital audio sample rate
 	std::unique_ptr<emu_file>  m_logfile;              // pointer to the active log file
+	std::vector<std::pair<std::string, osd_ticks_t>> m_startup_times; // startup phase timings for -startup_profile
+	std::vector<std::tuple<device_t *, std::string, size_t>> m_memory_usage; // allocations not owned by any manager
 
 	// load/save management
 	enum class saveload_schedule
@@ -360,6 +376,7 @@ private:
 	attotime                m_saveload_schedule_time;
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
+	std::future<save_error> m_async_save;           // state file being compressed and written in the background
 
 	// notifier callbacks
 	struct notifier_callback_item
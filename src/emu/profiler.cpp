@@ -24,6 +24,8 @@
 #include "emu.h"
 #include "profiler.h"
 
+#include "emuopts.h"
+
 
 
 //**************************************************************************
@@ -43,6 +45,7 @@ struct profile_string
 //**************************************************************************
 
 profiler_state g_profiler;
+profiler_trace g_profiler_trace;
 
 
 
@@ -52,6 +55,41 @@ profiler_state g_profiler;
 
 #define TEXT_UPDATE_TIME        0.5
 
+// events recorded per thread before the trace stops growing (32 bytes each)
+#define TRACE_MAX_EVENTS        (1 << 22)
+
+static const profile_string s_profile_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
 
 
 //**************************************************************************
@@ -67,6 +105,20 @@ dummy_profiler_state::dummy_profiler_state()
 }
 
 
+//-------------------------------------------------
+//  text - return the execution statistics, which
+//  are available even without the profiler
+//-------------------------------------------------
+
+const char *dummy_profiler_state::text(running_machine &machine)
+{
+	std::ostringstream stream;
+	profiler_append_execute_statistics(machine, stream);
+	m_text = stream.str();
+	return m_text.c_str();
+}
+
+
 
 //**************************************************************************
 //  REAL PROFILER STATE
@@ -141,38 +193,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -214,7 +234,7 @@ void real_profiler_state::update_text(running_machine &machine)
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
 				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
 			else
-				for (auto & name : names)
+				for (auto & name : s_profile_names)
 					if (name.type == curtype)
 					{
 						stream << name.string;
@@ -226,7 +246,231 @@ void real_profiler_state::update_text(running_machine &machine)
 		}
 	}
 
+	// follow with the scheduler's breakdown
+	profiler_append_execute_statistics(machine, stream);
+
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
 	m_text = stream.str();
 }
+
+
+
+//**************************************************************************
+//  TRACE EXPORT
+//**************************************************************************
+
+//-------------------------------------------------
+//  profiler_trace - constructor
+//-------------------------------------------------
+
+profiler_trace::profiler_trace()
+	: m_enabled(false)
+	, m_full(false)
+	, m_session(0)
+	, m_machine(nullptr)
+	, m_start(0)
+{
+}
+
+
+//-------------------------------------------------
+//  start - begin recording a trace of the given
+//  machine, to be written when it exits
+//-------------------------------------------------
+
+void profiler_trace::start(running_machine &machine)
+{
+	if (enabled())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_threads.clear();
+		m_session++;
+	}
+	m_full = false;
+	m_machine = &machine;
+	m_start = osd_ticks();
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&profiler_trace::stop, this));
+
+	// the calling thread is always listed first
+	current_thread();
+	m_enabled = true;
+
+	// profiler scopes are only recorded while the profiler is running
+	g_profiler.enable(true);
+}
+
+
+//-------------------------------------------------
+//  stop - stop recording and write the trace
+//-------------------------------------------------
+
+void profiler_trace::stop()
+{
+	if (!enabled())
+		return;
+
+	m_enabled = false;
+	write();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_threads.clear();
+	m_machine = nullptr;
+}
+
+
+//-------------------------------------------------
+//  record - append an event to the calling
+//  thread's list
+//-------------------------------------------------
+
+void profiler_trace::record(const char *name, int type, bool begin)
+{
+	if (!enabled() || m_full.load(std::memory_order_relaxed))
+		return;
+
+	// stop recording everywhere once any thread hits the limit; what has
+	// been recorded so far is still written out
+	thread_events &thread = current_thread();
+	if (thread.events.size() >= TRACE_MAX_EVENTS)
+	{
+		if (!m_full.exchange(true))
+			osd_printf_warning("Profiler trace reached %u events on one thread; recording stopped\n", unsigned(TRACE_MAX_EVENTS));
+		return;
+	}
+
+	event ev;
+	ev.name = name;
+	ev.type = type;
+	ev.ticks = osd_ticks();
+	ev.begin = begin;
+	thread.events.push_back(ev);
+}
+
+
+//-------------------------------------------------
+//  current_thread - return the calling thread's
+//  event list, creating it on first use in a
+//  session
+//-------------------------------------------------
+
+profiler_trace::thread_events &profiler_trace::current_thread()
+{
+	thread_local thread_events *s_events = nullptr;
+	thread_local u32 s_session = 0;
+
+	if (s_events == nullptr || s_session != m_session)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_threads.emplace_back(std::make_unique<thread_events>());
+		s_events = m_threads.back().get();
+		s_events->id = int(m_threads.size());
+		s_session = m_session;
+	}
+	return *s_events;
+}
+
+
+//-------------------------------------------------
+//  write - write the recorded events as a Chrome
+//  trace-event JSON file
+//-------------------------------------------------
+
+void profiler_trace::write()
+{
+	running_machine &machine = *m_machine;
+	emu_file file(machine.options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	const std::string filename = util::string_format("%s" PATH_SEPARATOR "trace.json", machine.basename());
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_error("Unable to write profiler trace %s\n", filename);
+		return;
+	}
+
+	// resolve the names for profile types up front
+	std::vector<std::string> typenames(PROFILER_TOTAL + 1);
+	device_iterator iter(machine.root_device());
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype <= PROFILER_TOTAL; ++curtype)
+	{
+		if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
+		{
+			device_t *device = iter.byindex(curtype - PROFILER_DEVICE_FIRST);
+			if (device != nullptr)
+				typenames[curtype] = device->tag();
+		}
+		else
+			for (auto &name : s_profile_names)
+				if (name.type == curtype)
+					typenames[curtype] = name.string;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const double scale = 1000000.0 / double(osd_ticks_per_second());
+	const char *separator = "";
+	file.printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	for (const auto &thread : m_threads)
+	{
+		// the first thread is the one that started the trace
+		if (thread->id == 1)
+			file.printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}", separator);
+		else
+			file.printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"worker %d\"}}", separator, thread->id, thread->id - 1);
+		separator = ",\n";
+
+		for (const event &ev : thread->events)
+		{
+			const double ts = double(ev.ticks - m_start) * scale;
+			if (ev.begin)
+			{
+				const char *name = (ev.name != nullptr) ? ev.name : typenames[ev.type].c_str();
+				file.printf("%s{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}", separator, name, thread->id, ts);
+			}
+			else
+				file.printf("%s{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}", separator, thread->id, ts);
+		}
+	}
+	file.printf("\n]}\n");
+}
+
+
+
+//**************************************************************************
+//  EXECUTION STATISTICS
+//**************************************************************************
+
+//-------------------------------------------------
+//  profiler_append_execute_statistics - append
+//  per-device scheduler statistics, normalized
+//  to one emulated second
+//-------------------------------------------------
+
+void profiler_append_execute_statistics(running_machine &machine, std::ostream &stream)
+{
+	device_scheduler &scheduler = machine.scheduler();
+	if (!scheduler.statistics_enabled())
+		return;
+
+	// nothing to report until some emulated time has passed
+	const double elapsed = scheduler.statistics_elapsed().as_double();
+	if (elapsed <= 0.0)
+		return;
+
+	stream << "Per emulated second:\n";
+	for (device_execute_interface &exec : execute_interface_iterator(machine.root_device()))
+	{
+		const device_execute_interface::statistics &stats = exec.stats();
+		if (stats.m_timeslices == 0)
+			continue;
+
+		util::stream_format(stream, "'%s' %.2fms %.0f slices %.0f/%.0f cyc %.0f abort %.0f boost\n",
+				exec.device().tag(),
+				double(stats.m_host_ticks) * 1000.0 / (double(osd_ticks_per_second()) * elapsed),
+				double(stats.m_timeslices) / elapsed,
+				double(stats.m_cycles_executed) / elapsed,
+				double(stats.m_cycles_requested) / elapsed,
+				double(stats.m_aborts) / elapsed,
+				double(stats.m_boosts) / elapsed);
+	}
+}
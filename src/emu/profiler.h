@@ -19,6 +19,18 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    With -profile_trace, begin/end events are also recorded from any
+    thread and written on exit as a Chrome trace-event file, which can
+    be loaded into chrome://tracing or Perfetto. Besides the profiler
+    scopes above (in profiler builds), the scheduler, device execution
+    and OSD updates are traced through profiler_trace_scope:
+
+    {
+        profiler_trace_scope scope("my work");
+
+        your_work_here();
+    }
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -26,6 +38,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -78,6 +95,64 @@ DECLARE_ENUM_INCDEC_OPERATORS(profile_type)
 //**************************************************************************
 
 
+// ======================> profiler_trace
+
+// records a timeline of begin/end events per thread for export
+class profiler_trace
+{
+public:
+	// construction/destruction
+	profiler_trace();
+
+	// getters
+	bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+	// start/stop a trace session; the file is written when the machine exits
+	void start(running_machine &machine);
+	void stop();
+
+	// record events on the calling thread
+	void begin(const char *name) { record(name, 0, true); }
+	void begin(profile_type type) { record(nullptr, type, true); }
+	void end() { record(nullptr, 0, false); }
+
+private:
+	// a single begin or end event
+	struct event
+	{
+		const char *    name;                       // name, or nullptr to name by profile type
+		int             type;                       // profile type if there is no name
+		osd_ticks_t     ticks;                      // time of the event
+		bool            begin;                      // true for begin, false for end
+	};
+
+	// the events recorded by one thread
+	struct thread_events
+	{
+		int                 id;                     // thread ID in the trace
+		std::vector<event>  events;                 // recorded events in order
+	};
+
+	void record(const char *name, int type, bool begin);
+	thread_events &current_thread();
+	void write();
+
+	// internal state
+	std::atomic<bool>   m_enabled;                  // true while a session is active
+	std::atomic<bool>   m_full;                     // true once a thread has reached the event limit
+	std::atomic<u32>    m_session;                  // incremented for every session
+	running_machine *   m_machine;                  // machine being traced
+	osd_ticks_t         m_start;                    // ticks at the start of the session
+	std::mutex          m_mutex;                    // protects the thread list
+	std::vector<std::unique_ptr<thread_events> > m_threads; // per-thread event lists
+};
+
+
+// the trace is global so that it can be reached from every thread
+extern profiler_trace g_profiler_trace;
+
+
+
 // ======================> real_profiler_state
 
 class real_profiler_state
@@ -132,6 +207,10 @@ private:
 		// fill in this entry
 		m_filoptr->type = type;
 		m_filoptr->start = curticks;
+
+		// devices are traced by the scheduler, on whichever thread runs them
+		if (UNEXPECTED(g_profiler_trace.enabled()) && type > PROFILER_DEVICE_MAX)
+			g_profiler_trace.begin(type);
 	}
 
 	//-------------------------------------------------
@@ -148,6 +227,8 @@ private:
 
 		// account for the time taken
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
+		if (UNEXPECTED(g_profiler_trace.enabled()) && m_filoptr->type > PROFILER_DEVICE_MAX)
+			g_profiler_trace.end();
 
 		// move back an entry
 		m_filoptr--;
@@ -182,7 +263,7 @@ public:
 
 	// getters
 	bool enabled() const { return false; }
-	const char *text(running_machine &machine) { return ""; }
+	const char *text(running_machine &machine);
 
 	// enable/disable
 	void enable(bool state = true) { }
@@ -190,6 +271,24 @@ public:
 	// start/stop
 	void start(profile_type type) { }
 	void stop() { }
+
+private:
+	// internal state
+	std::string         m_text;                     // execution statistics text
+};
+
+
+// ======================> profiler_trace_scope
+
+// begins a trace event on construction and ends it on destruction
+class profiler_trace_scope
+{
+public:
+	profiler_trace_scope(const char *name) : m_active(g_profiler_trace.enabled()) { if (UNEXPECTED(m_active)) g_profiler_trace.begin(name); }
+	~profiler_trace_scope() { if (UNEXPECTED(m_active)) g_profiler_trace.end(); }
+
+private:
+	bool m_active;
 };
 
 
@@ -210,4 +309,13 @@ typedef dummy_profiler_state profiler_state;
 extern profiler_state g_profiler;
 
 
+
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+// append the scheduler's per-device execution statistics breakdown
+void profiler_append_execute_statistics(running_machine &machine, std::ostream &stream);
+
+
 #endif  /* MAME_EMU_PROFILER_H */
@@ -207,14 +207,8 @@ render_primitive_list::~render_primitive_list()
 
 inline void render_primitive_list::add_reference(void *refptr)
 {
-	// skip if we already have one
-	if (has_reference(refptr))
-		return;
-
-	// set the refptr and link us into the list
-	reference *ref = m_reference_allocator.alloc();
-	ref->m_refptr = refptr;
-	m_reflist.append(*ref);
+	// the set skips duplicates for us
+	m_references.insert(refptr);
 }
 
 
@@ -225,11 +219,7 @@ inline void render_primitive_list::add_reference(void *refptr)
 
 inline bool render_primitive_list::has_reference(void *refptr) const
 {
-	// skip if we already have one
-	for (reference &ref : m_reflist)
-		if (ref.m_refptr == refptr)
-			return true;
-	return false;
+	return m_references.find(refptr) != m_references.end();
 }
 
 
@@ -255,7 +245,7 @@ void render_primitive_list::release_all()
 {
 	// release all the live items while under the lock
 	m_primitive_allocator.reclaim_all(m_primlist);
-	m_reference_allocator.reclaim_all(m_reflist);
+	m_references.clear();
 }
 
 
@@ -292,7 +282,11 @@ render_texture::render_texture()
 		m_old_id(~0ULL),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_curseq(0),
+		m_track_changes(false),
+		m_changed(true),
+		m_srcseq(0),
+		m_lookupseq(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -325,6 +319,8 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 	}
 	m_old_id = m_id;
 	m_id = ~0L;
+	m_track_changes = false;
+	m_changed = true;
 }
 
 
@@ -349,6 +345,7 @@ void render_texture::release()
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
 	m_curseq = 0;
+	m_changed = true;
 }
 
 
@@ -372,6 +369,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
+	m_changed = true;
 
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
@@ -431,7 +429,15 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.width = swidth;
 		texinfo.height = sheight;
 		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+
+		// textures tracking changes keep their sequence ID until the bitmap
+		// or the adjusted palette changes, so the OSD can skip the upload
+		if (!m_track_changes || m_changed)
+		{
+			m_srcseq = ++m_curseq;
+			m_changed = false;
+		}
+		texinfo.seqid = m_srcseq;
 	}
 	else
 	{
@@ -472,7 +478,9 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 			}
 
 			// allocate a new bitmap
-			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
+			scaled->bitmap = global_alloc(bitmap_argb32);
+			scaled->bitmap->set_aligned_rows(true);
+			scaled->bitmap->allocate(dwidth, dheight);
 			scaled->seqid = ++m_curseq;
 
 			// let the scaler do the work
@@ -498,6 +506,13 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 
 const rgb_t *render_texture::get_adjusted_palette(render_container &container, u32 &out_length)
 {
+	// a change to the lookup tables means the OSD has to convert the texture again
+	if (container.lookup_seq() != m_lookupseq)
+	{
+		m_lookupseq = container.lookup_seq();
+		m_changed = true;
+	}
+
 	// override the palette with our adjusted palette
 	switch (m_format)
 	{
@@ -540,6 +555,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookupseq(0)
 {
 	// make sure it is empty
 	empty();
@@ -772,6 +788,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	m_lookupseq++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -824,6 +842,7 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		m_lookupseq++;
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -2252,10 +2271,9 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
-					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
-
-					// set the palette
+					// set the palette first, so palette changes are reflected in the sequence ID
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
+					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
@@ -336,21 +336,11 @@ private:
 	void append(render_primitive &prim) { append_or_return(prim, false); }
 	void append_or_return(render_primitive &prim, bool clipped);
 
-	// a reference is an abstract reference to an internal object of some sort
-	class reference
-	{
-	public:
-		reference *next() const { return m_next; }
-		reference *         m_next;             // link to the next reference
-		void *              m_refptr;           // reference pointer
-	};
-
 	// internal state
 	simple_list<render_primitive> m_primlist;               // list of primitives
-	simple_list<reference> m_reflist;                       // list of references
+	std::unordered_set<void *> m_references;                // abstract references to internal objects
 
 	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
-	fixed_allocator<reference> m_reference_allocator;       // allocator for references
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -388,6 +378,9 @@ public:
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
+	// only advance the sequence ID when the bitmap is set again (the owner must not modify it in between)
+	void set_track_changes(bool track) { m_track_changes = track; m_changed = true; }
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -419,6 +412,12 @@ private:
 	void *              m_param;                    // scaling callback parameter
 	u32                 m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+
+	// change tracking state (unscaled only)
+	bool                m_track_changes;            // sequence ID only advances when content changes
+	bool                m_changed;                  // content changed since the last sequence ID
+	u32                 m_srcseq;                   // sequence ID of the unscaled source
+	u32                 m_lookupseq;                // last seen lookup sequence of the container
 };
 
 
@@ -486,6 +485,7 @@ public:
 	u8 apply_brightness_contrast_gamma(u8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, u32 &out_length, palette_t *palette = nullptr);
+	u32 lookup_seq() const { return m_lookupseq; }
 
 private:
 	// an item describes a high level primitive that is added to a container
@@ -540,6 +540,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_lookupseq;            // bumped whenever the lookup tables change
 };
 
 
@@ -608,8 +608,28 @@ private:
 		// ensure all parameters are valid
 		assert(prim.texture.palette != nullptr);
 
+		// fastest case: no coloring, no alpha, unscaled and unrotated rows
+		if (!_BilinearFilter && setup.dudx == 0x10000 && setup.dvdx == 0 &&
+			prim.color.r >= 1.0f && prim.color.g >= 1.0f && prim.color.b >= 1.0f && is_opaque(prim.color.a))
+		{
+			const rgb_t *palbase = prim.texture.palette;
+
+			// loop over rows
+			for (s32 y = setup.starty; y < setup.endy; y++)
+			{
+				_PixelType *dest = dstdata + y * pitch + setup.startx;
+				const s32 curu = setup.startu + (y - setup.starty) * setup.dudy;
+				const s32 curv = setup.startv + (y - setup.starty) * setup.dvdy;
+				const u16 *src = reinterpret_cast<const u16 *>(prim.texture.base) + (curv >> 16) * prim.texture.rowpixels + (curu >> 16);
+
+				// loop over cols, walking the source row directly
+				for (s32 x = setup.startx; x < setup.endx; x++)
+					*dest++ = source32_to_dest(palbase[*src++]);
+			}
+		}
+
 		// fast case: no coloring, no alpha
-		if (prim.color.r >= 1.0f && prim.color.g >= 1.0f && prim.color.b >= 1.0f && is_opaque(prim.color.a))
+		else if (prim.color.r >= 1.0f && prim.color.g >= 1.0f && prim.color.b >= 1.0f && is_opaque(prim.color.a))
 		{
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
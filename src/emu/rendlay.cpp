@@ -518,6 +518,15 @@ private:
 		return expand(str, str + strlen(str));
 	}
 
+	std::istringstream &parse_stream(char const *begin, char const *end)
+	{
+		// constructing and imbuing a stream for every number is expensive, so reuse one
+		m_parse.clear();
+		m_parse.str(std::string(begin, end));
+		m_parse >> std::dec;
+		return m_parse;
+	}
+
 	std::string parameter_name(util::xml::data_node const &node)
 	{
 		char const *const attrib(node.get_attribute_string("name", nullptr));
@@ -542,13 +551,14 @@ private:
 
 	entry_vector m_entries;
 	util::ovectorstream m_buffer;
+	std::istringstream m_parse;
 	device_t &m_device;
 	layout_environment *const m_next = nullptr;
 	bool m_cached = false;
 
 public:
-	explicit layout_environment(device_t &device) : m_device(device) { }
-	explicit layout_environment(layout_environment &next) : m_device(next.m_device), m_next(&next) { }
+	explicit layout_environment(device_t &device) : m_device(device) { m_parse.imbue(f_portable_locale); }
+	explicit layout_environment(layout_environment &next) : m_device(next.m_device), m_next(&next) { m_parse.imbue(f_portable_locale); }
 	layout_environment(layout_environment const &) = delete;
 
 	device_t &device() { return m_device; }
@@ -610,8 +620,7 @@ public:
 				unsigned const hexprefix((expanded.first[0] == '$') ? 1U : ((expanded.first[0] == '0') && ((expanded.first[1] == 'x') || (expanded.first[1] == 'X'))) ? 2U : 0U);
 				unsigned const decprefix((expanded.first[0] == '#') ? 1U : 0U);
 				bool const floatchars(std::find_if(expanded.first, expanded.second, [] (char ch) { return ('.' == ch) || ('e' == ch) || ('E' == ch); }) != expanded.second);
-				std::istringstream stream(std::string(expanded.first + hexprefix + decprefix, expanded.second));
-				stream.imbue(f_portable_locale);
+				std::istringstream &stream(parse_stream(expanded.first + hexprefix + decprefix, expanded.second));
 				if (!hexprefix && !decprefix && floatchars)
 				{
 					stream >> floatincrement;
@@ -706,35 +715,31 @@ public:
 
 		// similar to what XML nodes do
 		std::pair<char const *, char const *> const expanded(expand(attrib));
-		std::istringstream stream;
-		stream.imbue(f_portable_locale);
 		int result;
 		if (expanded.first[0] == '$')
 		{
-			stream.str(std::string(expanded.first + 1, expanded.second));
+			std::istringstream &stream(parse_stream(expanded.first + 1, expanded.second));
 			unsigned uvalue;
 			stream >> std::hex >> uvalue;
 			result = int(uvalue);
 		}
 		else if ((expanded.first[0] == '0') && ((expanded.first[1] == 'x') || (expanded.first[1] == 'X')))
 		{
-			stream.str(std::string(expanded.first + 2, expanded.second));
+			std::istringstream &stream(parse_stream(expanded.first + 2, expanded.second));
 			unsigned uvalue;
 			stream >> std::hex >> uvalue;
 			result = int(uvalue);
 		}
 		else if (expanded.first[0] == '#')
 		{
-			stream.str(std::string(expanded.first + 1, expanded.second));
-			stream >> result;
+			parse_stream(expanded.first + 1, expanded.second) >> result;
 		}
 		else
 		{
-			stream.str(std::string(expanded.first, expanded.second));
-			stream >> result;
+			parse_stream(expanded.first, expanded.second) >> result;
 		}
 
-		return stream ? result : defvalue;
+		return m_parse ? result : defvalue;
 	}
 
 	float get_attribute_float(util::xml::data_node const &node, char const *name, float defvalue)
@@ -745,10 +750,8 @@ public:
 
 		// similar to what XML nodes do
 		std::pair<char const *, char const *> const expanded(expand(attrib));
-		std::istringstream stream(std::string(expanded.first, expanded.second));
-		stream.imbue(f_portable_locale);
 		float result;
-		return (stream >> result) ? result : defvalue;
+		return (parse_stream(expanded.first, expanded.second) >> result) ? result : defvalue;
 	}
 
 	void parse_bounds(util::xml::data_node const *node, render_bounds &result)
@@ -15,6 +15,10 @@
 #include "softlist_dev.h"
 #include "ui/uimain.h"
 
+#include <algorithm>
+#include <list>
+#include <set>
+
 
 #define LOG_LOAD 0
 #define LOG(...) do { if (LOG_LOAD) debugload(__VA_ARGS__); } while(0)
@@ -490,6 +494,56 @@ void rom_load_manager::region_post_process(memory_region *region, bool invert)
 }
 
 
+/*-------------------------------------------------
+    region cache - keeps the post-processed
+    contents of ROM regions across hard resets and
+    system changes within one session, so that
+    warm restarts do not read and verify the same
+    files again
+-------------------------------------------------*/
+
+namespace {
+
+struct cached_region
+{
+	std::string     key;
+	std::vector<u8> data;
+};
+
+// most recently used first
+std::list<cached_region> s_region_cache;
+u64 s_region_cache_bytes = 0;
+
+// the key describes everything that determines the loaded contents
+std::string region_cache_key(device_t &device, const std::string &regiontag, const rom_entry *region)
+{
+	std::string key = string_format("%s/%u/%x/%x", regiontag, device.system_bios(), ROMREGION_GETLENGTH(region), ROMREGION_GETFLAGS(region));
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+		key += string_format("|%s,%s,%x,%x,%x", romp->name(), romp->hashdata(), ROM_GETOFFSET(romp), ROM_GETLENGTH(romp), ROM_GETFLAGS(romp));
+	return key;
+}
+
+// copied contents depend on another region, so the key cannot describe them
+bool region_has_copies(const rom_entry *region)
+{
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+		if (ROMENTRY_ISCOPY(romp))
+			return true;
+	return false;
+}
+
+void trim_region_cache(u64 limit)
+{
+	while (s_region_cache_bytes > limit)
+	{
+		s_region_cache_bytes -= s_region_cache.back().data.size();
+		s_region_cache.pop_back();
+	}
+}
+
+} // anonymous namespace
+
+
 /*-------------------------------------------------
     open_rom_file - open a ROM file, searching
     up the parent and loading by checksum
@@ -1359,8 +1413,23 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 
 void rom_load_manager::process_region_list()
 {
+	u64 const cachelimit = u64(machine().options().rom_cache()) << 20;
+	std::set<std::string> fromcache;
+	std::vector<std::pair<std::string, std::string>> tocache;
+	trim_region_cache(cachelimit);
+
 	/* loop until we hit the end */
 	device_iterator deviter(machine().root_device());
+
+	/* regions that are copied from must be loaded unprocessed, so never take them from the cache */
+	std::set<std::string> copysources;
+	if (cachelimit != 0)
+		for (device_t &device : deviter)
+			for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
+				for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+					if (ROMENTRY_ISCOPY(romp))
+						copysources.emplace(machine().root_device().subtag(ROM_GETNAME(romp)));
+
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
 		{
@@ -1397,17 +1466,52 @@ void rom_load_manager::process_region_list()
 					fill_random(m_region->base(), m_region->bytes());
 #endif
 
+				/* reuse the contents from an earlier run if we have them */
+				std::string cachekey;
+				bool const cacheable = cachelimit != 0 && !region_has_copies(region) && copysources.find(regiontag) == copysources.end();
+				if (cacheable)
+				{
+					cachekey = region_cache_key(device, regiontag, region);
+					auto const found = std::find_if(s_region_cache.begin(), s_region_cache.end(), [&cachekey] (cached_region const &entry) { return entry.key == cachekey; });
+					if (found != s_region_cache.end() && found->data.size() == m_region->bytes())
+					{
+						LOG("Using cached contents for region \"%s\"\n", regiontag.c_str());
+						memcpy(m_region->base(), &found->data[0], m_region->bytes());
+						s_region_cache.splice(s_region_cache.begin(), s_region_cache, found);
+						fromcache.emplace(regiontag);
+						continue;
+					}
+				}
+
 				/* now process the entries in the region */
+				int const errors = m_errors, warnings = m_warnings, knownbad = m_knownbad;
 				process_rom_entries(device.shortname(), region, region + 1, &device, false);
+
+				/* only cache regions that loaded cleanly, so problems are reported every time */
+				if (cacheable && errors == m_errors && warnings == m_warnings && knownbad == m_knownbad && m_region->bytes() <= cachelimit)
+					tocache.emplace_back(regiontag, std::move(cachekey));
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 				process_disk_entries(regiontag.c_str(), region, region + 1, nullptr);
 		}
 
-	/* now go back and post-process all the regions */
+	/* now go back and post-process all the regions (cached contents already are) */
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
-			region_post_process(device.memregion(ROM_GETNAME(region)), ROMREGION_ISINVERTED(region));
+			if (fromcache.find(device.subtag(ROM_GETNAME(region))) == fromcache.end())
+				region_post_process(device.memregion(ROM_GETNAME(region)), ROMREGION_ISINVERTED(region));
+
+	/* remember the newly loaded regions for next time */
+	for (auto &entry : tocache)
+	{
+		auto const found = machine().memory().regions().find(entry.first);
+		if (found == machine().memory().regions().end())
+			continue;
+		memory_region *const rgn = found->second.get();
+		s_region_cache.emplace_front(cached_region{ std::move(entry.second), std::vector<u8>(rgn->base(), rgn->base() + rgn->bytes()) });
+		s_region_cache_bytes += rgn->bytes();
+	}
+	trim_region_cache(cachelimit);
 
 	/* and finally register all per-game parameters */
 	for (device_t &device : deviter)
@@ -64,6 +64,8 @@ save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
 	, m_illegal_regs(0)
+	, m_signature(0)
+	, m_state_size(0)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
@@ -99,7 +101,11 @@ void save_manager::allow_registration(bool allowed)
 
 		dump_registry();
 
-		// everything is registered by now, evaluate the savestate size
+		// everything is registered by now, so the layout can't change any more
+		m_signature = compute_signature();
+		m_state_size = compute_state_size();
+
+		// evaluate the savestate size
 		m_rewind->clamp_capacity();
 	}
 }
@@ -341,8 +347,47 @@ save_error save_manager::write_file(emu_file &file)
 
 
 //-------------------------------------------------
-//  save - write the current machine state to the
-//  allocated stream
+//  write_snapshot - capture the current machine
+//  state in the layout of an uncompressed state
+//  file, for writing with write_snapshot_file
+//-------------------------------------------------
+
+save_error save_manager::write_snapshot(std::vector<u8> &data)
+{
+	data.resize(state_size());
+	return write_buffer(&data[0], data.size());
+}
+
+
+//-------------------------------------------------
+//  write_snapshot_file - write a captured state
+//  to a file; this touches no machine state, so
+//  it may run on another thread
+//-------------------------------------------------
+
+save_error save_manager::write_snapshot_file(emu_file &file, const std::vector<u8> &data)
+{
+	if (data.size() < HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+
+	// write the header and turn on compression for the rest of the file
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	if (file.write(&data[0], HEADER_SIZE) != HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+	file.compress(FCOMPRESS_MEDIUM);
+
+	// then write all the data
+	const u32 remaining = data.size() - HEADER_SIZE;
+	if (file.write(&data[HEADER_SIZE], remaining) != remaining)
+		return STATERR_WRITE_ERROR;
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  write_buffer - write the current machine
+//  state to a caller-provided buffer
 //-------------------------------------------------
 
 save_error save_manager::write_buffer(u8 *data, size_t size)
@@ -373,25 +418,21 @@ save_error save_manager::write_buffer(u8 *data, size_t size)
 	// call the pre-save functions
 	dispatch_presave();
 
-	// then write all the data
+	// then write all the data; the length check above means it will fit
 	for (auto &entry : m_entry_list)
 	{
-		u32 totalsize = entry->m_typesize * entry->m_typecount;
-
-		// check bounds before writing
-		if (byte_ptr + totalsize > data + size)
-			return STATERR_WRITE_ERROR;
-
-		memcpy(byte_ptr, entry->m_data, totalsize);
-		byte_ptr += totalsize;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		const u8 *src = reinterpret_cast<const u8 *>(entry->m_data);
+		for (u32 b = 0; entry->m_blockcount > b; ++b, src += (entry->m_typesize * entry->m_stride), byte_ptr += blocksize)
+			memcpy(byte_ptr, src, blocksize);
 	}
 	return STATERR_NONE;
 }
 
 
 //-------------------------------------------------
-//  load - restore the machine state from the
-//  stream
+//  read_buffer - restore the machine state from
+//  a caller-provided buffer
 //-------------------------------------------------
 
 save_error save_manager::read_buffer(u8 *data, size_t size)
@@ -419,20 +460,16 @@ save_error save_manager::read_buffer(u8 *data, size_t size)
 	// determine whether or not to flip the data when done
 	bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
-	// read all the data, flipping if necessary
+	// read all the data, flipping if necessary; the length check above means it's all there
 	for (auto &entry : m_entry_list)
 	{
-		u32 totalsize = entry->m_typesize * entry->m_typecount;
-
-		// check bounds before reading
-		if (byte_ptr + totalsize > data + size)
-			return STATERR_READ_ERROR;
-
-		memcpy(entry->m_data, byte_ptr, totalsize);
-		byte_ptr += totalsize;
+		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		u8 *dst = reinterpret_cast<u8 *>(entry->m_data);
+		for (u32 b = 0; entry->m_blockcount > b; ++b, dst += (entry->m_typesize * entry->m_stride), byte_ptr += blocksize)
+			memcpy(dst, byte_ptr, blocksize);
 
 		// handle flipping
-		if (flip)
+		if (UNEXPECTED(flip))
 			entry->flip_data();
 	}
 
@@ -444,11 +481,34 @@ save_error save_manager::read_buffer(u8 *data, size_t size)
 
 
 //-------------------------------------------------
-//  signature - compute the signature, which
-//  is a CRC over the structure of the data
+//  signature - get the signature, which is a
+//  CRC over the structure of the data
 //-------------------------------------------------
 
 u32 save_manager::signature() const
+{
+	// the layout is fixed once registration is closed
+	return m_reg_allowed ? compute_signature() : m_signature;
+}
+
+
+//-------------------------------------------------
+//  state_size - get the uncompressed size of a
+//  state, including the header
+//-------------------------------------------------
+
+size_t save_manager::state_size() const
+{
+	return m_reg_allowed ? compute_state_size() : m_state_size;
+}
+
+
+//-------------------------------------------------
+//  compute_signature - calculate the signature
+//  from the registered entries
+//-------------------------------------------------
+
+u32 save_manager::compute_signature() const
 {
 	// iterate over entries
 	u32 crc = 0;
@@ -469,6 +529,40 @@ u32 save_manager::signature() const
 }
 
 
+//-------------------------------------------------
+//  compute_state_size - calculate the state size
+//  from the registered entries
+//-------------------------------------------------
+
+size_t save_manager::compute_state_size() const
+{
+	size_t totalsize = 0;
+
+	for (auto &entry : m_entry_list)
+		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+
+	return totalsize + HEADER_SIZE;
+}
+
+
+//-------------------------------------------------
+//  registered_bytes - return the total size of
+//  the entries registered for a device, or for
+//  no device if nullptr
+//-------------------------------------------------
+
+size_t save_manager::registered_bytes(const device_t *device) const
+{
+	size_t totalsize = 0;
+
+	for (auto &entry : m_entry_list)
+		if (entry->m_device == device)
+			totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+
+	return totalsize;
+}
+
+
 //-------------------------------------------------
 //  dump_registry - dump the registry to the
 //  logfile
@@ -544,15 +638,11 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
-	, m_data()
+	, m_size(get_size(save))
+	, m_pages((m_size + SAVE_PAGE_SIZE - 1) / SAVE_PAGE_SIZE)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
 }
 
 
@@ -563,30 +653,78 @@ ram_state::ram_state(save_manager &save)
 
 size_t ram_state::get_size(save_manager &save)
 {
-	size_t totalsize = 0;
+	return save.state_size();
+}
 
-	for (auto &entry : save.m_entry_list)
-		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
 
-	return totalsize + HEADER_SIZE;
+//-------------------------------------------------
+//  unique_size - bytes of data pages that are not
+//  shared with the given previous state
+//-------------------------------------------------
+
+size_t ram_state::unique_size(const ram_state *previous) const
+{
+	if (!previous || previous->m_pages.size() != m_pages.size())
+		return m_size;
+
+	size_t totalsize = 0;
+	for (size_t pagenum = 0; pagenum < m_pages.size(); pagenum++)
+		if (m_pages[pagenum] && m_pages[pagenum] != previous->m_pages[pagenum])
+			totalsize += m_pages[pagenum]->size();
+
+	return totalsize;
 }
 
 
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  data pages, sharing any page that is unchanged
+//  from the previous state
 //-------------------------------------------------
 
-save_error ram_state::save()
+save_error ram_state::save(const ram_state *previous)
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
 
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
+	// we can only share pages with a state of the same layout
+	if (previous && previous->m_pages.size() != m_pages.size())
+		previous = nullptr;
+
+	// data is staged one page at a time so each page only needs comparing once
+	u8 staging[SAVE_PAGE_SIZE];
+	size_t pos = 0;
+	auto const flush_page =
+		[this, previous, &staging] (size_t pagenum, size_t length)
+		{
+			std::shared_ptr<page> &current = m_pages[pagenum];
+			if (previous && previous->m_pages[pagenum] && (previous->m_pages[pagenum]->size() == length) && !memcmp(previous->m_pages[pagenum]->data(), staging, length))
+				current = previous->m_pages[pagenum];
+			else if (current && (current.use_count() == 1) && (current->size() == length))
+				memcpy(current->data(), staging, length);
+			else
+				current = std::make_shared<page>(staging, staging + length);
+		};
+	auto const write =
+		[this, &staging, &pos, &flush_page] (const u8 *data, size_t length)
+		{
+			while (length)
+			{
+				const size_t offset = pos % SAVE_PAGE_SIZE;
+				const size_t chunk = std::min(length, SAVE_PAGE_SIZE - offset);
+				memcpy(&staging[offset], data, chunk);
+				data += chunk;
+				pos += chunk;
+				length -= chunk;
+				if (!(pos % SAVE_PAGE_SIZE) || (pos == m_size))
+					flush_page((pos - 1) / SAVE_PAGE_SIZE, ((pos - 1) % SAVE_PAGE_SIZE) + 1);
+			}
+		};
+
 	// generate the header
 	u8 header[HEADER_SIZE];
 	memcpy(&header[0], STATE_MAGIC_NUM, 8);
@@ -597,11 +735,7 @@ save_error ram_state::save()
 	*(u32 *)&header[0x1c] = little_endianize_int32(sig);
 
 	// write the header
-	m_data.write((char *)header, sizeof(header));
-
-	// check for any errors
-	if (!m_data)
-		return STATERR_WRITE_ERROR;
+	write(header, sizeof(header));
 
 	// call the pre-save functions
 	m_save.dispatch_presave();
@@ -610,15 +744,15 @@ save_error ram_state::save()
 	for (auto &entry : m_save.m_entry_list)
 	{
 		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		const char *data = reinterpret_cast<const char *>(entry->m_data);
+		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
 		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
-			m_data.write(data, blocksize);
-
-		// check for any errors
-		if (!m_data)
-			return STATERR_WRITE_ERROR;
+			write(data, blocksize);
 	}
 
+	// check for any errors
+	if (pos != m_size)
+		return STATERR_WRITE_ERROR;
+
 	// final confirmation
 	m_valid = true;
 	m_time = m_save.machine().time();
@@ -629,25 +763,41 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  data pages
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
-	// read the header
-	u8 header[HEADER_SIZE];
-	m_data.read((char *)header, sizeof(header));
-
 	// check for any errors
-	if (!m_data)
+	if (get_size(m_save) != m_size)
 		return STATERR_READ_ERROR;
+	for (auto &data : m_pages)
+		if (!data)
+			return STATERR_READ_ERROR;
+
+	size_t pos = 0;
+	auto const read =
+		[this, &pos] (u8 *data, size_t length)
+		{
+			while (length)
+			{
+				const page &source = *m_pages[pos / SAVE_PAGE_SIZE];
+				const size_t offset = pos % SAVE_PAGE_SIZE;
+				const size_t chunk = std::min(length, source.size() - offset);
+				memcpy(data, &source[offset], chunk);
+				data += chunk;
+				pos += chunk;
+				length -= chunk;
+			}
+		};
+
+	// read the header
+	u8 header[HEADER_SIZE];
+	read(header, sizeof(header));
 
 	// verify the header and report an error if it doesn't match
 	u32 sig = m_save.signature();
@@ -661,13 +811,9 @@ save_error ram_state::load()
 	for (auto &entry : m_save.m_entry_list)
 	{
 		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		char *data = reinterpret_cast<char *>(entry->m_data);
+		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
 		for (u32 b = 0; entry->m_blockcount > b; ++b, data += (entry->m_typesize * entry->m_stride))
-			m_data.read(data, blocksize);
-
-		// check for any errors
-		if (!m_data)
-			return STATERR_READ_ERROR;
+			read(data, blocksize);
 
 		// handle flipping
 		if (flip)
@@ -766,7 +912,7 @@ bool rewinder::capture()
 	{
 		// we need to create a new state
 		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+		const save_error error = state->save(m_state_list.empty() ? nullptr : m_state_list.back().get());
 
 		// validate the state
 		if (error == STATERR_NONE)
@@ -786,7 +932,7 @@ bool rewinder::capture()
 
 		// update the existing state
 		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
+		const save_error error = state->save((m_current_index > REWIND_INDEX_FIRST) ? m_state_list.at(m_current_index - 1).get() : nullptr);
 
 		// validate the state
 		if (error != STATERR_NONE)
@@ -864,9 +1010,21 @@ bool rewinder::check_size()
 	if (!m_enabled)
 		return false;
 
-	// state sizes in bytes
+	// state sizes in bytes; pages shared between consecutive states are only counted once
 	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	auto const list_size =
+		[this] ()
+		{
+			size_t result = 0;
+			const ram_state *previous = nullptr;
+			for (auto &state : m_state_list)
+			{
+				result += state->unique_size(previous);
+				previous = state.get();
+			}
+			return result;
+		};
+	size_t totalsize = list_size();
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
@@ -874,15 +1032,13 @@ bool rewinder::check_size()
 	// safety check that shouldn't be allowed to trigger
 	if (totalsize > capsize)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
 		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+		while (!m_state_list.empty() && (list_size() > capsize))
+			m_state_list.erase(m_state_list.begin());
 	}
 
 	// update before new check
-	totalsize = m_state_list.size() * singlesize;
+	totalsize = list_size();
 
 	// check if capacity will be hit by the newly captured state
 	if (totalsize + singlesize >= capsize)
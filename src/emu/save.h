@@ -141,6 +141,7 @@ public:
 	running_machine &machine() const { return m_machine; }
 	rewinder *rewind() { return m_rewind.get(); }
 	int registration_count() const { return m_entry_list.size(); }
+	size_t registered_bytes(const device_t *device) const;
 	bool registration_allowed() const { return m_reg_allowed; }
 
 	// registration control
@@ -232,13 +233,19 @@ public:
 	static save_error check_file(running_machine &machine, emu_file &file, const char *gamename, void (CLIB_DECL *errormsg)(const char *fmt, ...));
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
-	
+	save_error write_snapshot(std::vector<u8> &data);
+	static save_error write_snapshot_file(emu_file &file, const std::vector<u8> &data);
+
+	// in-memory states in native byte order; buffers must be exactly state_size() bytes, nothing is allocated
+	size_t state_size() const;
 	save_error write_buffer(u8 *data, size_t size);
 	save_error read_buffer(u8 *data, size_t size);
 
 private:
 	// internal helpers
 	u32 signature() const;
+	u32 compute_signature() const;
+	size_t compute_state_size() const;
 	void dump_registry() const;
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
@@ -257,6 +264,8 @@ private:
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
 	s32                       m_illegal_regs;         // number of illegal registrations
+	u32                       m_signature;            // layout signature, valid once registration is closed
+	size_t                    m_state_size;           // state size, valid once registration is closed
 
 	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
@@ -266,8 +275,13 @@ private:
 
 class ram_state
 {
+	// state data is split into pages that can be shared with the previous state
+	static constexpr size_t SAVE_PAGE_SIZE = 4096;
+	using page = std::vector<u8>;
+
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	size_t             m_size;                        // total size of the state data
+	std::vector<std::shared_ptr<page>> m_pages;       // save data pages
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -275,7 +289,8 @@ public:
 
 	ram_state(save_manager &save);
 	static size_t get_size(save_manager &save);
-	save_error save();
+	size_t unique_size(const ram_state *previous) const;
+	save_error save(const ram_state *previous = nullptr);
 	save_error load();
 };
 
@@ -10,6 +10,8 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+#include "debug/debugbuf.h"
 
 //**************************************************************************
 //  DEBUGGING
@@ -48,6 +50,7 @@ emu_timer::emu_timer() :
 	m_machine(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heap_index(NOT_QUEUED),
 	m_param(0),
 	m_ptr(nullptr),
 	m_enabled(false),
@@ -81,6 +84,7 @@ inline emu_timer &emu_timer::init(running_machine &machine, timer_expired_delega
 	m_machine = &machine;
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heap_index = NOT_QUEUED;
 	m_callback = callback;
 	m_param = 0;
 	m_ptr = ptr;
@@ -113,6 +117,7 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 	m_machine = &device.machine();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heap_index = NOT_QUEUED;
 	m_callback = timer_expired_delegate(FUNC(emu_timer::device_timer_expired), this);
 	m_param = 0;
 	m_ptr = ptr;
@@ -160,9 +165,8 @@ bool emu_timer::enable(bool enable)
 		// set the enable flag
 		m_enabled = enable;
 
-		// remove the timer and insert back into the list
-		machine().scheduler().timer_list_remove(*this);
-		machine().scheduler().timer_list_insert(*this);
+		// add to or remove from the expiry heap
+		machine().scheduler().timer_heap_update(*this);
 	}
 	return old;
 }
@@ -194,12 +198,11 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 	m_expire = m_start + start_delay;
 	m_period = period;
 
-	// remove and re-insert the timer in its new order
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move the timer to its new position in the heap
+	scheduler.timer_heap_update(*this);
 
-	// if this was inserted as the head, abort the current timeslice and resync
-	if (this == scheduler.first_timer())
+	// if this is now the next to expire, abort the current timeslice and resync
+	if (this == &scheduler.next_timer())
 		scheduler.abort_timeslice();
 }
 
@@ -282,10 +285,8 @@ inline void emu_timer::schedule_next_period()
 	m_start = m_expire;
 	m_expire += m_period;
 
-	// remove and re-insert us
-	device_scheduler &scheduler = machine().scheduler();
-	scheduler.timer_list_remove(*this);
-	scheduler.timer_list_insert(*this);
+	// move us to our new position in the heap
+	machine().scheduler().timer_heap_update(*this);
 }
 
 
@@ -323,6 +324,9 @@ void emu_timer::device_timer_expired(emu_timer &timer, void *ptr, s32 param)
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_group_executing = nullptr;
+
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
@@ -332,16 +336,28 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
+	m_group_queue(nullptr),
+	m_groups_executing(false),
 	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_statistics_enabled(false),
+	m_statistics_start(attotime::zero),
+	m_pc_profile_interval(0),
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_adaptive_mode(adaptive_mode::OFF),
+	m_adaptive_minimum(0),
+	m_adaptive_maximum(0),
+	m_adaptive_current(0),
+	m_slice_interaction(false),
+	m_adaptive_slices(0),
+	m_adaptive_misses(0)
 {
-	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
-	m_timer_list->adjust(attotime::never);
+	// append a single never-expiring timer so there is always one in the heap
+	m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true).adjust(attotime::never);
 
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
@@ -356,6 +372,10 @@ device_scheduler::device_scheduler(running_machine &machine) :
 
 device_scheduler::~device_scheduler()
 {
+	// release any worker threads
+	if (m_group_queue != nullptr)
+		osd_work_queue_free(m_group_queue);
+
 	// remove all timers
 	while (m_timer_list != nullptr)
 		m_timer_allocator.reclaim(m_timer_list->release());
@@ -374,7 +394,8 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	device_execute_interface *const exec = currently_executing();
+	return (exec != nullptr) ? exec->local_time() : m_basetime;
 }
 
 
@@ -441,14 +462,19 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < m_timer_heap.front().m_expire)
 	{
+		profiler_trace_scope trace("timeslice");
+
 		// by default, assume our target is the end of the next quantum
-		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
+		attoseconds_t quantum = m_quantum_list.first()->m_actual;
+		if (m_adaptive_mode == adaptive_mode::ON)
+			quantum = std::min(quantum, m_adaptive_current);
+		attotime target(m_basetime + attotime(0, quantum));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_timer_heap.front().m_expire < target)
+			target = m_timer_heap.front().m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -457,91 +483,189 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		// loop over all CPUs, farming out execution groups if we have any
+		if (m_execution_groups.empty())
+		{
+			for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+				execute_device(*exec, target, m_executing_device, call_debugger, true);
+		}
+		else
+		{
+			execute_groups(target, call_debugger);
+		}
+		m_executing_device = nullptr;
+
+		// update the base time
+		m_basetime = target;
+
+		// decide how wide the next timeslice can be
+		if (UNEXPECTED(m_adaptive_mode != adaptive_mode::OFF))
+			update_adaptive_quantum();
+	}
+
+	// execute timers
+	execute_timers();
+}
+
+
+//-------------------------------------------------
+//  execute_device - run a single device up to
+//  the target time, pulling the target back if
+//  the device stops short
+//-------------------------------------------------
+
+inline void device_scheduler::execute_device(device_execute_interface &exec, attotime &target, device_execute_interface *&executing, bool call_debugger, bool profile)
+{
+	// only process if this CPU is executing or truly halted (not yielding)
+	// and if our target is later than the CPU's current time (coarse check)
+	if (EXPECTED((exec.m_suspend == 0 || exec.m_eatcycles) && target.seconds() >= exec.m_localtime.seconds()))
+	{
+		// compute how many attoseconds to execute this CPU
+		attoseconds_t delta = target.attoseconds() - exec.m_localtime.attoseconds();
+		if (delta < 0 && target.seconds() > exec.m_localtime.seconds())
+			delta += ATTOSECONDS_PER_SECOND;
+		assert(delta == (target - exec.m_localtime).as_attoseconds());
+
+		if (exec.m_attoseconds_per_cycle == 0)
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
+			exec.m_localtime = target;
+		}
+		// if we have enough for at least 1 cycle, do the math
+		else if (delta >= exec.m_attoseconds_per_cycle)
+		{
+			// compute how many cycles we want to execute
+			int ran = exec.m_cycles_running = divu_64x32(u64(delta) >> exec.m_divshift, exec.m_divisor);
+			LOG("  cpu '%s': %d (%d cycles)\n", exec.device().tag(), delta, exec.m_cycles_running);
+
+			// if we're not suspended, actually execute
+			if (exec.m_suspend == 0)
 			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
+				if (profile)
+					g_profiler.start(exec.m_profiler);
 
-				if (exec->m_attoseconds_per_cycle == 0)
+				const bool stats = m_statistics_enabled;
+				osd_ticks_t start_ticks = 0;
+				if (UNEXPECTED(stats))
+				{
+					exec.m_stats.m_timeslices++;
+					exec.m_stats.m_cycles_requested += exec.m_cycles_running;
+					start_ticks = osd_ticks();
+				}
+
+				// note that this global variable cycles_stolen can be modified
+				// via the call to cpu_execute
+				exec.m_cycles_stolen = 0;
+				exec.m_idle_loop_head = ~offs_t(0);
+				executing = &exec;
+				*exec.m_icountptr = exec.m_cycles_running;
+				const bool trace = g_profiler_trace.enabled();
+				if (UNEXPECTED(trace))
+					g_profiler_trace.begin(exec.device().tag());
+				if (!call_debugger)
+					exec.run();
+				else
 				{
-					exec->m_localtime = target;
+					exec.debugger_start_cpu_hook(target);
+					exec.run();
+					exec.debugger_stop_cpu_hook();
 				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
+				if (UNEXPECTED(trace))
+					g_profiler_trace.end();
+
+				// adjust for any cycles we took back
+				assert(ran >= *exec.m_icountptr);
+				ran -= *exec.m_icountptr;
+				assert(ran >= exec.m_cycles_stolen);
+				ran -= exec.m_cycles_stolen;
+
+				if (UNEXPECTED(m_pc_profile_interval != 0))
+					sample_pc(exec);
+				if (UNEXPECTED(stats))
 				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
-					else
-					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, &remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
-					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
-					}
+					exec.m_stats.m_host_ticks += osd_ticks() - start_ticks;
+					exec.m_stats.m_cycles_executed += ran;
 				}
+				if (profile)
+					g_profiler.stop();
+			}
+
+			// account for these cycles
+			exec.m_totalcycles += ran;
+
+			// update the local time for this CPU
+			attotime deltatime;
+			if (ran < exec.m_cycles_per_second)
+				deltatime = attotime(0, exec.m_attoseconds_per_cycle * ran);
+			else
+			{
+				u32 remainder;
+				s32 secs = divu_64x32_rem(ran, exec.m_cycles_per_second, &remainder);
+				deltatime = attotime(secs, u64(remainder) * exec.m_attoseconds_per_cycle);
+			}
+			assert(deltatime >= attotime::zero);
+			exec.m_localtime += deltatime;
+			LOG("         %d ran, %d total, time = %s\n", ran, s32(exec.m_totalcycles), exec.m_localtime.as_string(PRECISION));
+
+			// if the new local CPU time is less than our target, move the target up, but not before the base
+			if (exec.m_localtime < target)
+			{
+				target = std::max(exec.m_localtime, m_basetime);
+				LOG("         (new target)\n");
 			}
 		}
-		m_executing_device = nullptr;
+	}
+}
 
-		// update the base time
-		m_basetime = target;
+
+//-------------------------------------------------
+//  execute_groups - run the main thread's devices
+//  while worker threads run the other execution
+//  groups towards the same target
+//-------------------------------------------------
+
+void device_scheduler::execute_groups(attotime &target, bool call_debugger)
+{
+	// every group starts from the same target, so the outcome doesn't
+	// depend on the order in which the groups happen to run
+	for (execution_group &group : m_execution_groups)
+		group.m_target = target;
+	m_groups_executing = true;
+	osd_work_item_queue_multiple(m_group_queue, &device_scheduler::execute_group_callback, m_execution_groups.size(), &m_execution_groups[0], sizeof(m_execution_groups[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// run group 0 on this thread
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		if (exec->m_execution_group == 0)
+			execute_device(*exec, target, m_executing_device, call_debugger, true);
+
+	// wait for the workers and take the earliest time anyone reached; there
+	// is no safe way to carry on while a group is still running, so keep
+	// waiting however long it takes
+	while (!osd_work_queue_wait(m_group_queue, osd_ticks_per_second()))
+	{
 	}
+	m_groups_executing = false;
+	for (execution_group &group : m_execution_groups)
+		target = std::min(target, group.m_target);
+}
 
-	// execute timers
-	execute_timers();
+
+//-------------------------------------------------
+//  execute_group_callback - work queue callback
+//  to run one execution group
+//-------------------------------------------------
+
+void *device_scheduler::execute_group_callback(void *param, int threadid)
+{
+	execution_group &group = *reinterpret_cast<execution_group *>(param);
+
+	// the timer heap and quantum list are not locked; devices in worker
+	// groups must not touch them (checked by timer_heap_update() and friends)
+
+	// the profiler isn't thread-safe, so don't record these
+	for (device_execute_interface *exec : group.m_devices)
+		group.m_scheduler->execute_device(*exec, group.m_target, s_group_executing, false, false);
+	s_group_executing = nullptr;
+	return nullptr;
 }
 
 
@@ -552,8 +676,9 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice()
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	device_execute_interface *const exec = currently_executing();
+	if (exec != nullptr)
+		exec->abort_timeslice();
 }
 
 
@@ -588,10 +713,46 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
+
+	// charge the request to whoever is executing
+	device_execute_interface *const exec = currently_executing();
+	if (UNEXPECTED(m_statistics_enabled) && (exec != nullptr))
+		exec->m_stats.m_boosts++;
+
+	// a device asking for tighter interleave is interacting with someone
+	if (exec != nullptr)
+		note_interaction();
+
 	add_scheduling_quantum(timeslice_time, boost_duration);
 }
 
 
+//-------------------------------------------------
+//  enable_statistics - start or stop gathering
+//  per-device execution statistics
+//-------------------------------------------------
+
+void device_scheduler::enable_statistics(bool enable)
+{
+	if (enable && !m_statistics_enabled)
+		reset_statistics();
+	m_statistics_enabled = enable;
+}
+
+
+//-------------------------------------------------
+//  reset_statistics - clear all per-device
+//  execution statistics
+//-------------------------------------------------
+
+void device_scheduler::reset_statistics()
+{
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+		exec.reset_stats();
+	m_statistics_start = time();
+}
+
+
 //-------------------------------------------------
 //  timer_alloc - allocate a global non-device
 //  timer and return a pointer
@@ -611,6 +772,10 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
 {
+	// synchronizing from an executing device means it's talking to someone
+	if (duration.is_zero() && (currently_executing() != nullptr))
+		note_interaction();
+
 	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
 }
 
@@ -634,6 +799,10 @@ emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, v
 
 void device_scheduler::timer_set(const attotime &duration, device_t &device, device_timer_id id, int param, void *ptr)
 {
+	// synchronizing from an executing device means it's talking to someone
+	if (duration.is_zero() && (currently_executing() != nullptr))
+		note_interaction();
+
 	m_timer_allocator.alloc()->init(device, id, ptr, true).adjust(duration, param);
 }
 
@@ -681,25 +850,21 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
-	// remove all timers and make a private list of permanent ones
-	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
+	// temporary timers go away entirely (except our special never-expiring one)
+	emu_timer *next;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = next)
 	{
-		emu_timer &timer = *m_timer_list;
-
-		// temporary timers go away entirely (except our special never-expiring one)
-		if (timer.m_temporary && !timer.expire().is_never())
-			m_timer_allocator.reclaim(timer.release());
-
-		// permanent ones get added to our private list
-		else
-			private_list.append(timer_list_remove(timer));
+		next = timer->next();
+		if (timer->m_temporary && !timer->expire().is_never())
+			m_timer_allocator.reclaim(timer->release());
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
-	emu_timer *timer;
-	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
+	// the loaded state invalidates every heap key, so rebuild from scratch
+	for (timer_heap_entry &entry : m_timer_heap)
+		entry.m_timer->m_heap_index = emu_timer::NOT_QUEUED;
+	m_timer_heap.clear();
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+		timer_heap_update(*timer);
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -772,10 +937,39 @@ void device_scheduler::rebuild_execute_list()
 		// if the configuration specifies a device to make perfect, pick that as the minimum
 		device_execute_interface *const exec(machine().config().perfect_quantum_device());
 		if (exec)
-			min_quantum = (std::min)(attotime(0, exec->minimum_quantum()), min_quantum);
+		{
+			const attotime perfect = (std::min)(attotime(0, exec->minimum_quantum()), min_quantum);
+
+			// adaptive quantum only falls back to perfect interleave after an interaction
+			if (machine().options().adaptive_quantum())
+				m_adaptive_mode = adaptive_mode::ON;
+			else if (machine().options().adaptive_quantum_audit())
+				m_adaptive_mode = adaptive_mode::AUDIT;
+
+			if (m_adaptive_mode != adaptive_mode::OFF)
+			{
+				m_adaptive_minimum = perfect.attoseconds();
+				m_adaptive_maximum = min_quantum.attoseconds();
+				m_adaptive_current = m_adaptive_minimum;
+				if (m_adaptive_mode == adaptive_mode::AUDIT)
+					machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::adaptive_audit_report, this));
+			}
+
+			// in adaptive mode the base quantum stays wide
+			if (m_adaptive_mode != adaptive_mode::ON)
+				min_quantum = perfect;
+		}
 
 		// inform the timer system of our decision
 		add_scheduling_quantum(min_quantum, attotime::never);
+
+		// this is also the first chance to start sampling program counters
+		const int pc_profile = machine().options().pc_profile();
+		if (pc_profile > 0)
+		{
+			m_pc_profile_interval = (std::max<osd_ticks_t>)(osd_ticks_per_second() * pc_profile / 1000000, 1);
+			machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::pc_profile_report, this));
+		}
 	}
 
 	// start with an empty list
@@ -805,59 +999,54 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+
+	// gather devices in non-zero execution groups, ordered by group number;
+	// the debugger can't cope with concurrent execution, so don't bother
+	std::map<int, std::vector<device_execute_interface *> > groups;
+	if (!(machine().debug_flags & DEBUG_FLAG_ENABLED))
+		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+			if (exec->m_execution_group != 0)
+				groups[exec->m_execution_group].push_back(exec);
+
+	m_execution_groups.clear();
+	for (auto &group : groups)
+		m_execution_groups.emplace_back(execution_group{ this, std::move(group.second), attotime::zero });
+
+	// create worker threads the first time we need them
+	if (!m_execution_groups.empty() && (m_group_queue == nullptr))
+		m_group_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  timer_list_insert - add a newly allocated
+//  timer to the list of all timers
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 {
-	// disabled timers sort to the end
-	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
-
-	// loop over the timer list
-	emu_timer *prevtimer = nullptr;
-	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
-	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
-		{
-			// link the new guy in before the current list entry
-			timer.m_prev = prevtimer;
-			timer.m_next = curtimer;
-
-			if (prevtimer != nullptr)
-				prevtimer->m_next = &timer;
-			else
-				m_timer_list = &timer;
-
-			curtimer->m_prev = &timer;
-			return timer;
-		}
-	}
-
-	// need to insert after the last one
-	if (prevtimer != nullptr)
-		prevtimer->m_next = &timer;
-	else
-		m_timer_list = &timer;
-
-	timer.m_prev = prevtimer;
-	timer.m_next = nullptr;
+	assert_main_thread();
+
+	// the list is unordered, so just link in at the head
+	timer.m_prev = nullptr;
+	timer.m_next = m_timer_list;
+	if (m_timer_list != nullptr)
+		m_timer_list->m_prev = &timer;
+	m_timer_list = &timer;
 	return timer;
 }
 
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  list of all timers and from the expiry heap
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// pull it out of the heap first
+	timer_heap_remove(timer);
+
 	// remove it from the list
 	if (timer.m_prev != nullptr)
 		timer.m_prev->m_next = timer.m_next;
@@ -871,19 +1060,150 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_heap_update - place a timer in the
+//  expiry heap according to its current state;
+//  disabled timers are removed
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_update(emu_timer &timer)
+{
+	assert_main_thread();
+
+	// disabled timers never fire, so they don't need to be in the heap
+	if (!timer.m_enabled)
+	{
+		timer_heap_remove(timer);
+		return;
+	}
+
+	// add a slot at the end if we're not already queued
+	u32 index = timer.m_heap_index;
+	if (index == emu_timer::NOT_QUEUED)
+	{
+		index = m_timer_heap.size();
+		m_timer_heap.push_back(timer_heap_entry());
+	}
+
+	// a fresh sequence number sorts us after any timers with the same expiry
+	timer_heap_entry &entry = m_timer_heap[index];
+	entry.m_expire = timer.m_expire;
+	entry.m_sequence = m_timer_sequence++;
+	entry.m_timer = &timer;
+	timer.m_heap_index = index;
+	timer_heap_place(index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_remove - remove a timer from the
+//  expiry heap if it is queued
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_remove(emu_timer &timer)
+{
+	assert_main_thread();
+
+	const u32 index = timer.m_heap_index;
+	if (index == emu_timer::NOT_QUEUED)
+		return;
+	timer.m_heap_index = emu_timer::NOT_QUEUED;
+
+	// move the last entry into the hole and restore the heap property
+	const u32 last = m_timer_heap.size() - 1;
+	if (index != last)
+	{
+		m_timer_heap[index] = m_timer_heap[last];
+		m_timer_heap[index].m_timer->m_heap_index = index;
+		m_timer_heap.pop_back();
+		timer_heap_place(index);
+	}
+	else
+	{
+		m_timer_heap.pop_back();
+	}
+}
+
+
+//-------------------------------------------------
+//  timer_heap_place - move an entry whose key
+//  has changed to its correct heap position
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_place(u32 index)
+{
+	if ((index > 0) && (m_timer_heap[index] < m_timer_heap[(index - 1) / 2]))
+		timer_heap_sift_up(index);
+	else
+		timer_heap_sift_down(index);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move an entry towards
+//  the root until its parent expires first
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_up(u32 index)
+{
+	const timer_heap_entry entry = m_timer_heap[index];
+	while (index > 0)
+	{
+		const u32 parent = (index - 1) / 2;
+		if (!(entry < m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index].m_timer->m_heap_index = index;
+		index = parent;
+	}
+	m_timer_heap[index] = entry;
+	entry.m_timer->m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move an entry towards
+//  the leaves until both children expire later
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_down(u32 index)
+{
+	const u32 count = m_timer_heap.size();
+	const timer_heap_entry entry = m_timer_heap[index];
+	while (true)
+	{
+		// pick the earlier of the two children
+		u32 child = index * 2 + 1;
+		if (child >= count)
+			break;
+		if ((child + 1 < count) && (m_timer_heap[child + 1] < m_timer_heap[child]))
+			child++;
+
+		// stop if we already expire first
+		if (!(m_timer_heap[child] < entry))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index].m_timer->m_heap_index = index;
+		index = child;
+	}
+	m_timer_heap[index] = entry;
+	entry.m_timer->m_heap_index = index;
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_heap.front().m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_timer_heap.front().m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = next_timer();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -937,6 +1257,7 @@ inline void device_scheduler::execute_timers()
 void device_scheduler::add_scheduling_quantum(const attotime &quantum, const attotime &duration)
 {
 	assert(quantum.seconds() == 0);
+	assert_main_thread();
 
 	attotime curtime = time();
 	attotime expire = curtime + duration;
@@ -973,6 +1294,125 @@ void device_scheduler::add_scheduling_quantum(const attotime &quantum, const att
 }
 
 
+//-------------------------------------------------
+//  update_adaptive_quantum - narrow the adaptive
+//  quantum after a timeslice with interactions,
+//  otherwise let it grow
+//-------------------------------------------------
+
+void device_scheduler::update_adaptive_quantum()
+{
+	m_adaptive_slices++;
+	if (m_slice_interaction)
+	{
+		// in audit mode, count the interactions adaptive mode would have run past
+		if (m_adaptive_current > m_adaptive_minimum)
+		{
+			m_adaptive_misses++;
+			if (m_adaptive_mode == adaptive_mode::AUDIT)
+				machine().logerror("Adaptive quantum audit: interaction at %s after %s timeslice\n", m_basetime.as_string(PRECISION), attotime(0, m_adaptive_current).as_string(PRECISION));
+		}
+		m_adaptive_current = m_adaptive_minimum;
+		m_slice_interaction = false;
+	}
+	else if (m_adaptive_current < m_adaptive_maximum)
+	{
+		m_adaptive_current = std::min(m_adaptive_current * 2, m_adaptive_maximum);
+	}
+}
+
+
+//-------------------------------------------------
+//  adaptive_audit_report - summarize the audit
+//  on exit
+//-------------------------------------------------
+
+void device_scheduler::adaptive_audit_report()
+{
+	osd_printf_info("Adaptive quantum audit: %u of %u timeslices had interactions adaptive quantum would have missed\n",
+			unsigned(m_adaptive_misses), unsigned(m_adaptive_slices));
+}
+
+
+//-------------------------------------------------
+//  sample_pc - record where a device stopped if
+//  the sampling interval has elapsed for it
+//-------------------------------------------------
+
+void device_scheduler::sample_pc(device_execute_interface &exec)
+{
+	const osd_ticks_t now = osd_ticks();
+	if (now < exec.m_pc_sample_next)
+		return;
+	exec.m_pc_sample_next = now + m_pc_profile_interval;
+
+	device_state_interface *state;
+	if (exec.device().interface(state))
+		exec.m_pc_samples[state->pcbase()]++;
+}
+
+
+//-------------------------------------------------
+//  pc_profile_report - write the sampled program
+//  counter histogram, hottest first, on exit
+//-------------------------------------------------
+
+void device_scheduler::pc_profile_report()
+{
+	emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	const std::string filename = util::string_format("%s" PATH_SEPARATOR "pcprofile.txt", machine().basename());
+	if (file.open(filename) != osd_file::error::NONE)
+	{
+		osd_printf_error("Unable to write program counter profile %s\n", filename);
+		return;
+	}
+
+	// reading memory to disassemble must not disturb the machine
+	auto dis = machine().disable_side_effects();
+
+	for (device_execute_interface &exec : execute_interface_iterator(machine().root_device()))
+	{
+		if (exec.m_pc_samples.empty())
+			continue;
+
+		// sort by hit count, then by address for a stable report
+		std::vector<std::pair<offs_t, u32> > samples(exec.m_pc_samples.begin(), exec.m_pc_samples.end());
+		std::sort(samples.begin(), samples.end(),
+				[] (const std::pair<offs_t, u32> &a, const std::pair<offs_t, u32> &b) { return (a.second > b.second) || ((a.second == b.second) && (a.first < b.first)); });
+		u64 total = 0;
+		for (const auto &sample : samples)
+			total += sample.second;
+
+		// only devices that can be disassembled get symbolic output
+		device_t &device = exec.device();
+		device_disasm_interface *dasm;
+		device_memory_interface *memory;
+		std::unique_ptr<debug_disasm_buffer> buffer;
+		if (device.interface(dasm) && device.interface(memory) && memory->has_space(AS_PROGRAM))
+			buffer = std::make_unique<debug_disasm_buffer>(device);
+
+		file.printf("'%s' (%s): %u samples at %u distinct addresses\n", device.tag(), device.shortname(), unsigned(total), unsigned(samples.size()));
+		for (const auto &sample : samples)
+		{
+			const double percent = double(sample.second) * 100.0 / double(total);
+			if (buffer)
+			{
+				std::string instruction;
+				offs_t next_pc, size;
+				u32 info;
+				buffer->disassemble(sample.first, instruction, next_pc, size, info);
+				file.printf("%10u %6.2f%%  %s: %s\n", sample.second, percent, buffer->pc_to_string(sample.first), instruction);
+			}
+			else
+			{
+				file.printf("%10u %6.2f%%  %X\n", sample.second, percent, sample.first);
+			}
+		}
+		file.printf("\n");
+	}
+}
+
+
 //-------------------------------------------------
 //  dump_timers - dump the current timer state
 //-------------------------------------------------
@@ -92,10 +92,13 @@ private:
 	void dump() const;
 	static void device_timer_expired(emu_timer &timer, void *ptr, s32 param);
 
+	static constexpr u32 NOT_QUEUED = ~u32(0);
+
 	// internal state
 	running_machine *   m_machine;      // reference to the owning machine
 	emu_timer *         m_next;         // next timer in order in the list
 	emu_timer *         m_prev;         // previous timer in order in the list
+	u32                 m_heap_index;   // index in the scheduler's expiry heap, or NOT_QUEUED
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	void *              m_ptr;          // pointer parameter
@@ -125,7 +128,7 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
 	emu_timer *first_timer() const { return m_timer_list; }
-	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
+	device_execute_interface *currently_executing() const noexcept { return (UNEXPECTED(m_groups_executing) && s_group_executing) ? s_group_executing : m_executing_device; }
 	bool can_save() const;
 
 	// execution
@@ -135,6 +138,15 @@ public:
 	void boost_interleave(const attotime &timeslice_time, const attotime &boost_duration);
 	void suspend_resume_changed() { m_suspend_changes_pending = true; }
 
+	// execution statistics
+	bool statistics_enabled() const noexcept { return m_statistics_enabled; }
+	void enable_statistics(bool enable = true);
+	void reset_statistics();
+	attotime statistics_elapsed() const { return time() - m_statistics_start; }
+
+	// note that executing devices interacted, for adaptive quantum
+	void note_interaction() noexcept { m_slice_interaction = true; }
+
 	// timers, specified by callback/name
 	emu_timer *timer_alloc(timer_expired_delegate callback, void *ptr = nullptr);
 	void timer_set(const attotime &duration, timer_expired_delegate callback, int param = 0, void *ptr = nullptr);
@@ -161,11 +173,25 @@ private:
 	void rebuild_execute_list();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
+	void update_adaptive_quantum();
+	void adaptive_audit_report();
+	void sample_pc(device_execute_interface &exec);
+	void pc_profile_report();
+	void execute_device(device_execute_interface &exec, attotime &target, device_execute_interface *&executing, bool call_debugger, bool profile);
+	void execute_groups(attotime &target, bool call_debugger);
+	static void *execute_group_callback(void *param, int threadid);
+	void assert_main_thread() const noexcept { assert(!m_groups_executing || !s_group_executing); }
 
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_heap_update(emu_timer &timer);
+	void timer_heap_remove(emu_timer &timer);
+	void timer_heap_sift_up(u32 index);
+	void timer_heap_sift_down(u32 index);
+	void timer_heap_place(u32 index);
 	void execute_timers();
+	emu_timer &next_timer() const { return *m_timer_heap.front().m_timer; }
 
 	// internal state
 	running_machine &           m_machine;                  // reference to our machine
@@ -173,8 +199,33 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// devices that run concurrently on worker threads, by execution group
+	struct execution_group
+	{
+		device_scheduler *                      m_scheduler;    // owning scheduler
+		std::vector<device_execute_interface *> m_devices;      // devices in execution order
+		attotime                                m_target;       // target time on entry, earliest local time on exit
+	};
+	std::vector<execution_group> m_execution_groups;            // non-zero execution groups
+	osd_work_queue *            m_group_queue;              // work queue for running execution groups
+	bool                        m_groups_executing;         // true while worker threads are running groups
+	static thread_local device_execute_interface *s_group_executing; // device executing on this worker thread
+
+	// an entry in the expiry heap; the sort key is kept inline to avoid
+	// chasing timer pointers while sifting
+	struct timer_heap_entry
+	{
+		bool operator<(const timer_heap_entry &that) const { return (m_expire < that.m_expire) || ((m_expire == that.m_expire) && (m_sequence < that.m_sequence)); }
+
+		attotime                m_expire;                   // expiration time of the timer
+		u64                     m_sequence;                 // insertion order, to keep equal times first-in first-out
+		emu_timer *             m_timer;                    // the timer itself
+	};
+
+	// list of allocated timers, and heap of enabled timers ordered by expiry
+	emu_timer *                 m_timer_list;               // head of the allocated list
+	std::vector<timer_heap_entry> m_timer_heap;             // binary min-heap of enabled timers
+	u64                         m_timer_sequence;           // next heap insertion sequence number
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
 	// other internal states
@@ -182,6 +233,9 @@ private:
 	bool                        m_callback_timer_modified;  // true if the current callback timer was modified
 	attotime                    m_callback_timer_expire_time; // the original expiration time
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
+	bool                        m_statistics_enabled;       // gather per-device execution statistics?
+	attotime                    m_statistics_start;         // time when statistics were last reset
+	osd_ticks_t                 m_pc_profile_interval;      // host ticks between program counter samples (0 = disabled)
 
 	// scheduling quanta
 	class quantum_slot
@@ -199,6 +253,16 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// adaptive quantum
+	enum class adaptive_mode { OFF, ON, AUDIT };
+	adaptive_mode               m_adaptive_mode;            // whether adaptive quantum is in use
+	attoseconds_t               m_adaptive_minimum;         // perfect quantum, used after interactions
+	attoseconds_t               m_adaptive_maximum;         // widest quantum we will grow to
+	attoseconds_t               m_adaptive_current;         // current adaptive quantum
+	bool                        m_slice_interaction;        // devices interacted during this timeslice
+	u64                         m_adaptive_slices;          // timeslices examined
+	u64                         m_adaptive_misses;          // interactions following a widened timeslice
 };
 
 
@@ -840,6 +840,11 @@ void screen_device::device_start()
 	m_texture[1] = machine().render().texture_alloc();
 	m_texture[1]->set_id((u64(m_unique_id) << 57) | 1);
 
+	// bitmaps are only drawn while their texture is not displayed, so the
+	// OSD only needs to upload them when update_quads sets them again
+	m_texture[0]->set_track_changes(true);
+	m_texture[1]->set_track_changes(true);
+
 	// configure the default cliparea
 	render_container::user_settings settings;
 	m_container->get_user_settings(settings);
@@ -98,7 +98,10 @@ public:
 		: m_format(BITMAP_FORMAT_RGB32)
 		, m_texformat(TEXFORMAT_RGB32)
 		, m_live(&m_rgb32)
-	{ }
+	{
+		m_ind16.set_aligned_rows(true);
+		m_rgb32.set_aligned_rows(true);
+	}
 	screen_bitmap(bitmap_ind16 &orig)
 		: m_format(BITMAP_FORMAT_IND16)
 		, m_texformat(TEXFORMAT_PALETTE16)
@@ -214,14 +214,16 @@ softlist_parser::softlist_parser(util::core_file &file, const std::string &filen
 	XML_SetElementHandler(m_parser, &softlist_parser::start_handler, &softlist_parser::end_handler);
 	XML_SetCharacterDataHandler(m_parser, &softlist_parser::data_handler);
 
-	// parse the file contents
+	// parse the file contents, reading straight into the parser's own buffer
 	m_file.seek(0, SEEK_SET);
-	char buffer[1024];
 	while (!m_done)
 	{
-		u32 length = m_file.read(buffer, sizeof(buffer));
+		void *const buffer = XML_GetBuffer(m_parser, PARSE_CHUNK_SIZE);
+		if (buffer == nullptr)
+			throw std::bad_alloc();
+		u32 length = m_file.read(buffer, PARSE_CHUNK_SIZE);
 		m_done = m_file.eof();
-		if (XML_Parse(m_parser, buffer, length, m_done) == XML_STATUS_ERROR)
+		if (XML_ParseBuffer(m_parser, length, m_done) == XML_STATUS_ERROR)
 		{
 			parse_error("%s", parser_error());
 			break;
@@ -153,6 +153,8 @@ public:
 	softlist_parser(util::core_file &file, const std::string &filename, std::string &description, std::list<software_info> &infolist, std::ostringstream &errors);
 
 private:
+	static constexpr int PARSE_CHUNK_SIZE = 64 * 1024;    // bytes handed to the XML parser at a time
+
 	enum parse_position
 	{
 		POS_ROOT,
@@ -177,6 +177,7 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_infomap.clear();
 }
 
 
@@ -254,6 +255,22 @@ const software_info *software_list_device::find(const std::string &look_for)
 
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
+
+	// plain names can be looked up directly
+	if (!iswild)
+	{
+		if (m_infomap.empty())
+		{
+			for (const software_info &info : info_list)
+			{
+				std::string name(info.shortname());
+				m_infomap.emplace(std::move(strmakelower(name)), &info);
+			}
+		}
+		std::string name(look_for);
+		auto const found = m_infomap.find(strmakelower(name));
+		return (found != m_infomap.end()) ? found->second : nullptr;
+	}
 	auto iter = std::find_if(
 			info_list.begin(),
 			info_list.end(),
@@ -16,6 +16,8 @@
 
 #include "softlist.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -156,6 +158,7 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+	std::unordered_map<std::string, const software_info *> m_infomap;  // lowercase short name to entry, built on first lookup
 };
 
 
@@ -65,7 +65,10 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_output_sampindex(0),
 		m_output_update_sampindex(0),
 		m_output_base_sampindex(0),
-		m_callback(std::move(callback))
+		m_callback(std::move(callback)),
+		m_profile_samples(0),
+		m_profile_callback_ticks(0),
+		m_profile_resample_ticks(0)
 {
 	// get the device's sound interface
 	device_sound_interface *sound;
@@ -630,6 +633,7 @@ void sound_stream::generate_samples(int samples)
 
 	VPRINTF(("generate_samples(%p, %d)\n", (void *) this, samples));
 	assert(samples > 0);
+	const bool profiling = m_device.machine().sound().profiling();
 
 	// ensure all inputs are up to date and generate resampled data
 	for (unsigned int inputnum = 0; inputnum < m_input.size(); inputnum++)
@@ -640,7 +644,16 @@ void sound_stream::generate_samples(int samples)
 			input.m_source->m_stream->update();
 
 		// generate the resampled data
-		m_input_array[inputnum] = generate_resampled_data(input, samples);
+		if (UNEXPECTED(profiling))
+		{
+			const osd_ticks_t start = osd_ticks();
+			m_input_array[inputnum] = generate_resampled_data(input, samples);
+			m_profile_resample_ticks += osd_ticks() - start;
+		}
+		else
+		{
+			m_input_array[inputnum] = generate_resampled_data(input, samples);
+		}
 	}
 
 	if (!m_input.empty())
@@ -662,7 +675,17 @@ void sound_stream::generate_samples(int samples)
 
 	// run the callback
 	VPRINTF(("  callback(%p, %d)\n", (void *)this, samples));
-	m_callback(*this, inputs, outputs, samples);
+	if (UNEXPECTED(profiling))
+	{
+		const osd_ticks_t start = osd_ticks();
+		m_callback(*this, inputs, outputs, samples);
+		m_profile_callback_ticks += osd_ticks() - start;
+		m_profile_samples += samples;
+	}
+	else
+	{
+		m_callback(*this, inputs, outputs, samples);
+	}
 	VPRINTF(("  callback done\n"));
 }
 
@@ -710,8 +733,12 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 	// compute the stepping fraction
 	u32 step = (u64(input_stream.m_sample_rate) << FRAC_BITS) / m_sample_rate;
 
+	// if we have equal sample rates and unity gain, we can copy the samples straight across
+	if (step == FRAC_ONE && gain == 0x100)
+		std::copy_n(source, numsamples, dest);
+
 	// if we have equal sample rates, we just need to copy
-	if (step == FRAC_ONE)
+	else if (step == FRAC_ONE)
 	{
 		while (numsamples--)
 		{
@@ -844,7 +871,9 @@ sound_manager::sound_manager(running_machine &machine)
 		m_nosound_mode(machine.osd().no_sound()),
 		m_wavfile(nullptr),
 		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds()),
-		m_last_update(attotime::zero)
+		m_last_update(attotime::zero),
+		m_profiling(machine.options().profile_sound()),
+		m_profile_mix_ticks(0)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -866,6 +895,8 @@ sound_manager::sound_manager(running_machine &machine)
 	machine.add_notifier(MACHINE_NOTIFY_RESUME, machine_notify_delegate(&sound_manager::resume, this));
 	machine.add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&sound_manager::reset, this));
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::stop_recording, this));
+	if (m_profiling)
+		machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&sound_manager::profile_report, this));
 
 	// register global states
 	machine.save().save_item(NAME(m_last_update));
@@ -1072,6 +1103,42 @@ void sound_manager::config_save(config_type cfg_type, util::xml::data_node *pare
 }
 
 
+//-------------------------------------------------
+//  profile_report - list the host time spent in
+//  each stream, most expensive first, on exit
+//-------------------------------------------------
+
+void sound_manager::profile_report()
+{
+	std::vector<sound_stream *> streams;
+	osd_ticks_t total = m_profile_mix_ticks;
+	for (auto &stream : m_stream_list)
+	{
+		streams.push_back(stream.get());
+		total += stream->profile_callback_ticks() + stream->profile_resample_ticks();
+	}
+	std::stable_sort(streams.begin(), streams.end(),
+			[] (const sound_stream *a, const sound_stream *b) { return (a->profile_callback_ticks() + a->profile_resample_ticks()) > (b->profile_callback_ticks() + b->profile_resample_ticks()); });
+
+	const double ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+	const double percent_per_tick = total ? (100.0 / double(total)) : 0.0;
+	osd_printf_info("Sound stream profile (host time in ms):\n");
+	osd_printf_info("%10s %10s %7s %12s  %s\n", "callback", "resample", "share", "samples", "device");
+	for (const sound_stream *stream : streams)
+	{
+		const osd_ticks_t ticks = stream->profile_callback_ticks() + stream->profile_resample_ticks();
+		osd_printf_info("%10.2f %10.2f %6.2f%% %12u  '%s' (%s)\n",
+				double(stream->profile_callback_ticks()) * ms_per_tick,
+				double(stream->profile_resample_ticks()) * ms_per_tick,
+				double(ticks) * percent_per_tick,
+				stream->profile_samples(),
+				stream->device().tag(),
+				stream->device().shortname());
+	}
+	osd_printf_info("%10.2f %10s %6.2f%% %12s  final mix\n", double(m_profile_mix_ticks) * ms_per_tick, "", double(m_profile_mix_ticks) * percent_per_tick, "");
+}
+
+
 //-------------------------------------------------
 //  update - mix everything down to its final form
 //  and send it to the OSD layer
@@ -1089,31 +1156,48 @@ void sound_manager::update(void *ptr, int param)
 		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
 
 	// now downmix the final result
+	const osd_ticks_t mixstart = m_profiling ? osd_ticks() : 0;
 	u32 finalmix_step = machine().video().speed_factor();
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
 	int sample;
-	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+	if (finalmix_step == 1000 && m_finalmix_leftover < 1000)
 	{
-		int sampindex = sample / 1000;
-
-		// clamp the left side
-		s32 samp = m_leftmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
-
-		// clamp the right side
-		samp = m_rightmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
+		// at normal speed every mixed sample is used once, so skip the index arithmetic
+		for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
+		{
+			finalmix[finalmix_offset++] = std::min(std::max(m_leftmix[sampindex], -32768), 32767);
+			finalmix[finalmix_offset++] = std::min(std::max(m_rightmix[sampindex], -32768), 32767);
+		}
+		sample = m_finalmix_leftover + m_samples_this_update * 1000;
+	}
+	else
+	{
+		// otherwise step through the mix according to the speed factor
+		for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
+		{
+			int sampindex = sample / 1000;
+
+			// clamp the left side
+			s32 samp = m_leftmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+
+			// clamp the right side
+			samp = m_rightmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+		}
 	}
 	m_finalmix_leftover = sample - m_samples_this_update * 1000;
+	if (m_profiling)
+		m_profile_mix_ticks += osd_ticks() - mixstart;
 
 	// play the result
 	if (finalmix_offset > 0)
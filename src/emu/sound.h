@@ -109,6 +109,11 @@ public:
 	float input_gain(int inputnum) const;
 	float output_gain(int outputnum) const;
 
+	// profiling (only accumulated when sound profiling is enabled)
+	u64 profile_samples() const { return m_profile_samples; }
+	osd_ticks_t profile_callback_ticks() const { return m_profile_callback_ticks; }
+	osd_ticks_t profile_resample_ticks() const { return m_profile_resample_ticks; }
+
 	// operations
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
 	void update();
@@ -167,6 +172,11 @@ private:
 
 	// callback information
 	stream_update_delegate  m_callback;                   // callback function
+
+	// profiling information
+	u64                 m_profile_samples;            // total samples generated
+	osd_ticks_t         m_profile_callback_ticks;     // host ticks spent in the callback
+	osd_ticks_t         m_profile_resample_ticks;     // host ticks spent resampling inputs
 };
 
 
@@ -200,6 +210,8 @@ public:
 	attoseconds_t update_attoseconds() const { return m_update_attoseconds; }
 	int sample_count() const { return m_samples_this_update; }
 	void samples(s16 *buffer);
+	bool profiling() const { return m_profiling; }
+	osd_ticks_t profile_mix_ticks() const { return m_profile_mix_ticks; }
 
 	// stream creation
 	sound_stream *stream_alloc(device_t &device, int inputs, int outputs, int sample_rate, stream_update_delegate callback = stream_update_delegate());
@@ -224,6 +236,7 @@ private:
 	void resume();
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
+	void profile_report();
 
 	void update(void *ptr = nullptr, s32 param = 0);
 
@@ -247,6 +260,10 @@ private:
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list;    // list of streams
 	attoseconds_t       m_update_attoseconds;   // attoseconds between global updates
 	attotime            m_last_update;          // last update time
+
+	// profiling data
+	bool                m_profiling;            // accumulate per-stream host time
+	osd_ticks_t         m_profile_mix_ticks;    // host ticks spent in the final mix
 };
 
 
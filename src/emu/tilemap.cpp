@@ -397,12 +397,17 @@ void tilemap_t::init_common(
 	m_dy_flipped = 0;
 
 	// allocate pixmap
+	m_pixmap.set_aligned_rows(true);
 	m_pixmap.allocate(m_width, m_height);
 
 	// allocate transparency mapping
+	m_flagsmap.set_aligned_rows(true);
 	m_flagsmap.allocate(m_width, m_height);
 	memset(m_pen_to_flags, 0, sizeof(m_pen_to_flags));
 
+	// the tile cache is opt-in
+	m_tile_cache = false;
+
 	// create the initial mappings
 	mappings_create();
 
@@ -512,6 +517,74 @@ void tilemap_t::mark_tile_dirty(tilemap_memory_index memindex)
 }
 
 
+//-------------------------------------------------
+//  memory_usage - return the number of bytes
+//  allocated for pixel data and tile state
+//-------------------------------------------------
+
+size_t tilemap_t::memory_usage() const
+{
+	size_t bytes = m_pixmap.allocated_bytes() + m_flagsmap.allocated_bytes();
+	for (int band = 0; band < PARALLEL_MAX_BANDS; band++)
+		bytes += m_strip_pixmap[band].allocated_bytes() + m_strip_flagsmap[band].allocated_bytes();
+
+	bytes += m_tileflags.size();
+	bytes += m_memory_to_logical.size() * sizeof(m_memory_to_logical[0]);
+	bytes += m_logical_to_memory.size() * sizeof(m_logical_to_memory[0]);
+	bytes += (m_rowscroll.size() + m_colscroll.size()) * sizeof(s32);
+	bytes += m_tilecache_index.size() * sizeof(m_tilecache_index[0]);
+	bytes += m_tilecache_pixels.size() * sizeof(m_tilecache_pixels[0]);
+	bytes += m_tilecache_flags.size() + m_tilecache_summary.size();
+	return bytes;
+}
+
+
+//-------------------------------------------------
+//  set_tile_cache - switch between drawing from
+//  a full pixmap and drawing from a cache of
+//  rendered tiles
+//-------------------------------------------------
+
+void tilemap_t::set_tile_cache(bool enable)
+{
+	if (enable == m_tile_cache)
+		return;
+	m_tile_cache = enable;
+
+	if (enable)
+	{
+		// release the full pixmap; only one row of tiles per band is assembled at a time
+		m_pixmap.reset();
+		m_flagsmap.reset();
+		m_tilecache_index.resize(m_tileflags.size());
+		for (int band = 0; band < PARALLEL_MAX_BANDS; band++)
+		{
+			m_strip_pixmap[band].set_aligned_rows(true);
+			m_strip_pixmap[band].allocate(m_width, m_tileheight);
+			m_strip_flagsmap[band].set_aligned_rows(true);
+			m_strip_flagsmap[band].allocate(m_width, m_tileheight);
+		}
+	}
+	else
+	{
+		// drop the cache and go back to a full pixmap
+		tile_cache_flush();
+		m_tilecache_index.clear();
+		m_tilecache_index.shrink_to_fit();
+		for (int band = 0; band < PARALLEL_MAX_BANDS; band++)
+		{
+			m_strip_pixmap[band].reset();
+			m_strip_flagsmap[band].reset();
+		}
+		m_pixmap.allocate(m_width, m_height);
+		m_flagsmap.allocate(m_width, m_height);
+	}
+
+	// everything needs to be rendered again
+	mark_all_dirty();
+}
+
+
 //-------------------------------------------------
 //  map_pens_to_layer - specify the mapping of one
 //  or more pens (where (<pen> & mask) == pen) to
@@ -755,7 +828,46 @@ inline void tilemap_t::realize_all_dirty_tiles()
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
 		m_gfx_used = 0;
+		if (m_tile_cache)
+			tile_cache_flush();
 	}
+
+	// once the cache holds more entries than there are tiles, it is mostly
+	// stale; start over rather than let it grow without bound
+	else if (m_tile_cache && m_tilecache_summary.size() > m_tileflags.size())
+	{
+		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
+		m_all_tiles_clean = false;
+		tile_cache_flush();
+	}
+}
+
+
+//-------------------------------------------------
+//  tile_cache_flush - discard all rendered tiles
+//  in the tile cache
+//-------------------------------------------------
+
+void tilemap_t::tile_cache_flush()
+{
+	m_tilecache_map.clear();
+	m_tilecache_pixels.clear();
+	m_tilecache_flags.clear();
+	m_tilecache_summary.clear();
+}
+
+
+//-------------------------------------------------
+//  tile_cache_offset - return the offset of a
+//  tilemap pixel within the tile cache
+//-------------------------------------------------
+
+inline u32 tilemap_t::tile_cache_offset(u32 x, u32 y) const
+{
+	u32 const col = x / m_tilewidth;
+	u32 const row = y / m_tileheight;
+	u32 const entry = m_tilecache_index[row * m_cols + col];
+	return (entry * m_tileheight + (y - row * m_tileheight)) * m_tilewidth + (x - col * m_tilewidth);
 }
 
 //-------------------------------------------------
@@ -806,15 +918,69 @@ g_profiler.start(PROFILER_TILEMAP_UPDATE);
 	// apply the global tilemap flip to the returned flip flags
 	u32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
 
-	// draw the tile, using either direct or transparent
-	u32 x0 = m_tilewidth * col;
-	u32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
+	// find where the tile's pixels go
+	u16 *pixptr;
+	u8 *flagsptr;
+	int pixrowpixels, flagsrowpixels;
+	bool render = true;
+	u32 entry = 0;
+	if (!m_tile_cache)
+	{
+		u32 x0 = m_tilewidth * col;
+		u32 y0 = m_tileheight * row;
+		pixptr = &m_pixmap.pix16(y0, x0);
+		flagsptr = &m_flagsmap.pix8(y0, x0);
+		pixrowpixels = m_pixmap.rowpixels();
+		flagsrowpixels = m_flagsmap.rowpixels();
+	}
+	else
+	{
+		// tiles drawn from anything other than decoded gfx may change
+		// without the gfx being dirtied, so they get a private entry
+		tile_cache_key key;
+		key.pen_data = m_tileinfo.pen_data;
+		key.mask_data = m_tileinfo.mask_data;
+		key.palette_base = m_tileinfo.palette_base;
+		key.owner = (m_tileinfo.gfxnum == 0xff || m_tileinfo.mask_data != nullptr) ? logindex : INVALID_LOGICAL_INDEX;
+		key.category = m_tileinfo.category;
+		key.group = m_tileinfo.group;
+		key.flags = flags;
+		key.pen_mask = m_tileinfo.pen_mask;
+
+		// reuse a matching entry, or add a new one
+		u32 const tilesize = m_tilewidth * m_tileheight;
+		auto const found = m_tilecache_map.emplace(key, u32(m_tilecache_summary.size()));
+		entry = found.first->second;
+		if (found.second)
+		{
+			m_tilecache_pixels.resize(m_tilecache_pixels.size() + tilesize);
+			m_tilecache_flags.resize(m_tilecache_flags.size() + tilesize);
+			m_tilecache_summary.push_back(0);
+		}
+		else if (key.owner == INVALID_LOGICAL_INDEX)
+		{
+			m_tileflags[logindex] = m_tilecache_summary[entry];
+			render = false;
+		}
+		m_tilecache_index[logindex] = entry;
+		pixptr = &m_tilecache_pixels[entry * tilesize];
+		flagsptr = &m_tilecache_flags[entry * tilesize];
+		pixrowpixels = flagsrowpixels = m_tilewidth;
+	}
+
+	if (render)
+	{
+		// draw the tile, using either direct or transparent
+		m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, pixptr, flagsptr, pixrowpixels, flagsrowpixels,
+			m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
 
-	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+		// if mask data is specified, apply it
+		if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
+			m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, flagsptr, flagsrowpixels, m_tileinfo.category, flags);
+
+		if (m_tile_cache)
+			m_tilecache_summary[entry] = m_tileflags[logindex];
+	}
 
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
@@ -829,43 +995,39 @@ g_profiler.stop();
 
 //-------------------------------------------------
 //  tile_draw - draw a single tile to the
-//  tilemap's internal pixmap, using the pen as
-//  the pen_to_flags lookup value, and adding
-//  the palette_base
+//  tilemap's internal pixmap or tile cache, using
+//  the pen as the pen_to_flags lookup value, and
+//  adding the palette_base
 //-------------------------------------------------
 
-u8 tilemap_t::tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask)
+u8 tilemap_t::tile_draw(const u8 *pendata, u16 *pixptr, u8 *flagsptr, int pixrowpixels, int flagsrowpixels, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask)
 {
 	// OR in the force layer flags
 	category |= flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2);
 
 	// if we're vertically flipped, point to the bottom row and work backwards
-	int dy0 = 1;
 	if (flags & TILE_FLIPY)
 	{
-		y0 += m_tileheight - 1;
-		dy0 = -1;
+		pixptr += (m_tileheight - 1) * pixrowpixels;
+		flagsptr += (m_tileheight - 1) * flagsrowpixels;
+		pixrowpixels = -pixrowpixels;
+		flagsrowpixels = -flagsrowpixels;
 	}
 
 	// if we're horizontally flipped, point to the rightmost column and work backwards
 	int dx0 = 1;
 	if (flags & TILE_FLIPX)
 	{
-		x0 += m_tilewidth - 1;
+		pixptr += m_tilewidth - 1;
+		flagsptr += m_tilewidth - 1;
 		dx0 = -1;
 	}
 
 	// iterate over rows
 	const u8 *penmap = m_pen_to_flags + group * MAX_PEN_TO_FLAGS;
 	u8 andmask = ~0, ormask = 0;
-	for (u16 ty = 0; ty < m_tileheight; ty++)
+	for (u16 ty = 0; ty < m_tileheight; ty++, pixptr += pixrowpixels, flagsptr += flagsrowpixels)
 	{
-		u16 *pixptr = &m_pixmap.pix16(y0, x0);
-		u8 *flagsptr = &m_flagsmap.pix8(y0, x0);
-
-		// pre-advance to the next row
-		y0 += dy0;
-
 		// 8bpp data
 		int xoffs = 0;
 		for (u16 tx = 0; tx < m_tilewidth; tx++)
@@ -886,36 +1048,31 @@ u8 tilemap_t::tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8
 //-------------------------------------------------
 //  tile_apply_bitmask - apply a bitmask to an
 //  already-rendered tile by modifying the
-//  flagsmap appropriately
+//  flags appropriately
 //-------------------------------------------------
 
-u8 tilemap_t::tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags)
+u8 tilemap_t::tile_apply_bitmask(const u8 *maskdata, u8 *flagsptr, int flagsrowpixels, u8 category, u8 flags)
 {
 	// if we're vertically flipped, point to the bottom row and work backwards
-	int dy0 = 1;
 	if (flags & TILE_FLIPY)
 	{
-		y0 += m_tileheight - 1;
-		dy0 = -1;
+		flagsptr += (m_tileheight - 1) * flagsrowpixels;
+		flagsrowpixels = -flagsrowpixels;
 	}
 
 	// if we're horizontally flipped, point to the rightmost column and work backwards
 	int dx0 = 1;
 	if (flags & TILE_FLIPX)
 	{
-		x0 += m_tilewidth - 1;
+		flagsptr += m_tilewidth - 1;
 		dx0 = -1;
 	}
 
 	// iterate over rows
 	u8 andmask = ~0, ormask = 0;
 	int bitoffs = 0;
-	for (u16 ty = 0; ty < m_tileheight; ty++)
+	for (u16 ty = 0; ty < m_tileheight; ty++, flagsptr += flagsrowpixels)
 	{
-		// pre-advance to the next row
-		u8 *flagsptr = &m_flagsmap.pix8(y0, x0);
-		y0 += dy0;
-
 		// anywhere the bitmask is 0 should be transparent
 		int xoffs = 0;
 		for (u16 tx = 0; tx < m_tilewidth; tx++)
@@ -951,6 +1108,7 @@ void tilemap_t::configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &pr
 	// set the target bitmap
 	blit.priority = &priority_bitmap;
 	blit.cliprect = cliprect;
+	blit.band = 0;
 
 	// set the priority code and alpha
 	blit.tilemap_priority_code = priority | (priority_mask << 8) | (m_palette_offset << 16);
@@ -1007,6 +1165,30 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
+	// large draws are split into horizontal bands on worker threads; the
+	// tiles are realized here first because get_info callbacks and gfx
+	// decoding aren't thread-safe
+	int const bands = parallel_bands(blit.cliprect);
+	if (bands > 1)
+	{
+		pixmap_update();
+		draw_parallel(screen, dest, blit, bands);
+	}
+	else
+		draw_blit(screen, dest, blit);
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_blit - draw every visible instance of
+//  the tilemap that falls within the blit
+//  cliprect
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_blit(screen_device &screen, _BitmapClass &dest, blit_parameters blit)
+{
 	// flip the tilemap around the center of the visible area
 	rectangle const visarea = screen.visible_area();
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
@@ -1095,7 +1277,61 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  parallel_bands - return how many horizontal
+//  bands a draw to the given cliprect should be
+//  split into; 1 or less means draw serially
+//-------------------------------------------------
+
+int tilemap_t::parallel_bands(const rectangle &cliprect) const
+{
+	if (cliprect.width() * cliprect.height() < PARALLEL_MIN_PIXELS)
+		return 1;
+	return std::min(cliprect.height() / PARALLEL_BAND_ROWS, PARALLEL_MAX_BANDS);
+}
+
+
+//-------------------------------------------------
+//  draw_parallel - split a blit into horizontal
+//  bands and draw them concurrently; each band
+//  owns its rows of both the destination and the
+//  priority bitmap, so priority semantics are
+//  the same as for a serial draw
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_parallel(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int bands)
+{
+	draw_band<_BitmapClass> work[PARALLEL_MAX_BANDS];
+	int const top = blit.cliprect.top();
+	int const height = blit.cliprect.height();
+	for (int band = 0; band < bands; band++)
+	{
+		work[band].tilemap = this;
+		work[band].screen = &screen;
+		work[band].dest = &dest;
+		work[band].blit = blit;
+		work[band].blit.cliprect.sety(top + height * band / bands, top + height * (band + 1) / bands - 1);
+		work[band].blit.band = band;
+	}
+
+	// hand all but the first band to the workers and draw that one here
+	osd_work_queue *queue = m_manager->work_queue();
+	osd_work_item_queue_multiple(queue, &tilemap_t::draw_band_callback<_BitmapClass>, bands - 1, &work[1], sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	draw_blit(screen, dest, work[0].blit);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+}
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_callback(void *param, int threadid)
+{
+	draw_band<_BitmapClass> &band = *reinterpret_cast<draw_band<_BitmapClass> *>(param);
+	profiler_trace_scope trace("tilemap band");
+	band.tilemap->draw_blit(*band.screen, *band.dest, band.blit);
+	return nullptr;
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
@@ -1141,11 +1377,14 @@ g_profiler.start(PROFILER_TILEMAP_DRAW_ROZ);
 	assert(dest.cliprect().contains(cliprect));
 	assert(screen.cliprect().contains(cliprect) || blit.tilemap_priority_code == 0xff00);
 
-	// get the full pixmap for the tilemap
-	pixmap();
+	// bring the full pixmap or tile cache up to date
+	pixmap_update();
 
 	// then do the roz copy
-	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	if (m_tile_cache)
+		draw_roz_core<true>(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	else
+		draw_roz_core<false>(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
 g_profiler.stop();
 }
 
@@ -1197,9 +1436,12 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 	x2 -= xpos;
 	y2 -= ypos;
 
-	// get tilemap pixels
-	const u16 *source_baseaddr = &m_pixmap.pix16(y1);
-	const u8 *mask_baseaddr = &m_flagsmap.pix8(y1);
+	// get tilemap pixels; in tile cache mode these point into a strip that
+	// holds the current row of tiles and is refilled for each row
+	bitmap_ind16 &source_bitmap = m_tile_cache ? m_strip_pixmap[blit.band] : m_pixmap;
+	bitmap_ind8 &mask_bitmap = m_tile_cache ? m_strip_flagsmap[blit.band] : m_flagsmap;
+	const u16 *source_baseaddr = m_tile_cache ? nullptr : &m_pixmap.pix16(y1);
+	const u8 *mask_baseaddr = m_tile_cache ? nullptr : &m_flagsmap.pix8(y1);
 
 	// get start/stop columns, rounding outward
 	int mincol = x1 / m_tilewidth;
@@ -1216,6 +1458,31 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 		int row = y / m_tileheight;
 		int x_start = x1;
 
+		// assemble the needed lines of this row of tiles from the cache
+		if (m_tile_cache)
+		{
+			int const liney = y - row * m_tileheight;
+			int const lines = nexty - y;
+			u32 const tilesize = m_tilewidth * m_tileheight;
+			for (int column = mincol; column < maxcol; column++)
+			{
+				logical_index logindex = row * m_cols + column;
+				if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+					tile_update(logindex, column, row);
+
+				u32 const offs = m_tilecache_index[logindex] * tilesize + liney * m_tilewidth;
+				const u16 *srcpix = &m_tilecache_pixels[offs];
+				const u8 *srcflags = &m_tilecache_flags[offs];
+				for (int line = 0; line < lines; line++, srcpix += m_tilewidth, srcflags += m_tilewidth)
+				{
+					memcpy(&source_bitmap.pix16(liney + line, column * m_tilewidth), srcpix, m_tilewidth * sizeof(u16));
+					memcpy(&mask_bitmap.pix8(liney + line, column * m_tilewidth), srcflags, m_tilewidth);
+				}
+			}
+			source_baseaddr = &source_bitmap.pix16(liney);
+			mask_baseaddr = &mask_bitmap.pix8(liney);
+		}
+
 		// iterate across the applicable tilemap columns
 		trans_t prev_trans = WHOLLY_TRANSPARENT;
 		trans_t cur_trans;
@@ -1277,7 +1544,7 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 							scanline_draw_opaque_rgb32_alpha(reinterpret_cast<u32 *>(dest0), source0, x_end - x_start, clut, pmap0, blit.tilemap_priority_code, blit.alpha);
 
 						dest0 += dest_rowpixels;
-						source0 += m_pixmap.rowpixels();
+						source0 += source_bitmap.rowpixels();
 						pmap0 += priority_bitmap.rowpixels();
 					}
 				}
@@ -1298,8 +1565,8 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 							scanline_draw_masked_rgb32_alpha(reinterpret_cast<u32 *>(dest0), source0, mask0, blit.mask, blit.value, x_end - x_start, clut, pmap0, blit.tilemap_priority_code, blit.alpha);
 
 						dest0 += dest_rowpixels;
-						source0 += m_pixmap.rowpixels();
-						mask0 += m_flagsmap.rowpixels();
+						source0 += source_bitmap.rowpixels();
+						mask0 += mask_bitmap.rowpixels();
 						pmap0 += priority_bitmap.rowpixels();
 					}
 				}
@@ -1316,8 +1583,11 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 
 		// advance to the next row on all our bitmaps
 		priority_baseaddr += priority_bitmap.rowpixels() * (nexty - y);
-		source_baseaddr += m_pixmap.rowpixels() * (nexty - y);
-		mask_baseaddr += m_flagsmap.rowpixels() * (nexty - y);
+		if (!m_tile_cache)
+		{
+			source_baseaddr += m_pixmap.rowpixels() * (nexty - y);
+			mask_baseaddr += m_flagsmap.rowpixels() * (nexty - y);
+		}
 		dest_baseaddr += dest_rowpixels * (nexty - y);
 
 		// increment the Y counter
@@ -1330,8 +1600,8 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 
 //-------------------------------------------------
 //  tilemap_draw_roz_core - render the tilemap's
-//  pixmap to the destination with rotation
-//  and zoom
+//  pixmap or tile cache to the destination with
+//  rotation and zoom
 //-------------------------------------------------
 
 #define ROZ_PLOT_PIXEL(INPUT_VAL)                                           \
@@ -1344,17 +1614,19 @@ do {                                                                        \
 		*dest = alpha_blend_r32(*dest, clut[INPUT_VAL], alpha);             \
 } while (0)
 
-template<class _BitmapClass>
+template<bool Cached, class _BitmapClass>
 void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit,
 		u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound)
 {
 	// pre-cache all the inner loop values
 	const rgb_t *clut = m_palette->palette()->entry_list_adjusted() + (blit.tilemap_priority_code >> 16);
 	bitmap_ind8 &priority_bitmap = *blit.priority;
-	const int xmask = m_pixmap.width() - 1;
-	const int ymask = m_pixmap.height() - 1;
-	const int widthshifted = m_pixmap.width() << 16;
-	const int heightshifted = m_pixmap.height() << 16;
+	const u16 *const cachepix = Cached ? m_tilecache_pixels.data() : nullptr;
+	const u8 *const cacheflags = Cached ? m_tilecache_flags.data() : nullptr;
+	const int xmask = m_width - 1;
+	const int ymask = m_height - 1;
+	const int widthshifted = m_width << 16;
+	const int heightshifted = m_height << 16;
 	const u32 priority = blit.tilemap_priority_code;
 	u8 mask = blit.mask;
 	u8 value = blit.value;
@@ -1397,17 +1669,18 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 
 				// get source and priority pointers
 				u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix8(sy, sx) : nullptr;
-				const u16 *src = &m_pixmap.pix16(cy);
-				const u8 *maskptr = &m_flagsmap.pix8(cy);
+				const u16 *src = Cached ? cachepix : &m_pixmap.pix16(cy);
+				const u8 *maskptr = Cached ? cacheflags : &m_flagsmap.pix8(cy);
 				typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 
 				// loop over columns
 				while (x <= ex && cx < widthshifted)
 				{
 					// plot if we match the mask
-					if ((maskptr[cx >> 16] & mask) == value)
+					u32 const offs = Cached ? tile_cache_offset(cx >> 16, cy) : (cx >> 16);
+					if ((maskptr[offs] & mask) == value)
 					{
-						ROZ_PLOT_PIXEL(src[cx >> 16]);
+						ROZ_PLOT_PIXEL(src[offs]);
 						if (priority != 0xff00)
 							*pri = (*pri & (priority >> 8)) | priority;
 					}
@@ -1446,9 +1719,12 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			while (x <= ex)
 			{
 				// plot if we match the mask
-				if ((m_flagsmap.pix8((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
+				u32 const px = (cx >> 16) & xmask;
+				u32 const py = (cy >> 16) & ymask;
+				u32 const offs = Cached ? tile_cache_offset(px, py) : 0;
+				if (((Cached ? cacheflags[offs] : m_flagsmap.pix8(py, px)) & mask) == value)
 				{
-					ROZ_PLOT_PIXEL(m_pixmap.pix16((cy >> 16) & ymask, (cx >> 16) & xmask));
+					ROZ_PLOT_PIXEL(Cached ? cachepix[offs] : m_pixmap.pix16(py, px));
 					if (priority != 0xff00)
 						*pri = (*pri & (priority >> 8)) | priority;
 				}
@@ -1489,12 +1765,15 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			{
 				// plot if we're within the bitmap and we match the mask
 				if (cx < widthshifted && cy < heightshifted)
-					if ((m_flagsmap.pix8(cy >> 16, cx >> 16) & mask) == value)
+				{
+					u32 const offs = Cached ? tile_cache_offset(cx >> 16, cy >> 16) : 0;
+					if (((Cached ? cacheflags[offs] : m_flagsmap.pix8(cy >> 16, cx >> 16)) & mask) == value)
 					{
-						ROZ_PLOT_PIXEL(m_pixmap.pix16(cy >> 16, cx >> 16));
+						ROZ_PLOT_PIXEL(Cached ? cachepix[offs] : m_pixmap.pix16(cy >> 16, cx >> 16));
 						if (priority != 0xff00)
 							*pri = (*pri & (priority >> 8)) | priority;
 					}
+				}
 
 				// advance in X
 				cx += incxx;
@@ -1576,7 +1855,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(nullptr)
 {
 }
 
@@ -1600,6 +1880,22 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the queue used for
+//  parallel drawing, creating it if needed
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	return m_work_queue;
 }
 
 
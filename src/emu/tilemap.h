@@ -154,6 +154,17 @@
         tilemap_t::pixmap() to get a reference to the updated bitmap_ind16
         containing the tilemap graphics.
 
+    7. For very large tilemaps of which only a small window is ever
+        visible (for example big ROZ layers), you can call
+        tilemap_t::set_tile_cache(true) after creating the tilemap. The
+        full pixmap and flagsmap are then released, and each tile is
+        rendered once per unique code/color/flip combination into a
+        shared cache. When drawing, each row of visible tiles is copied
+        from the cache into a small strip pixmap (one per drawing band),
+        and the strips are then drawn to the destination. Calling
+        tilemap_t::pixmap() or tilemap_t::flagsmap() switches the
+        tilemap back to a full pixmap. No driver uses this yet.
+
 ****************************************************************************
 
     The following example shows how to use the tilemap system to create
@@ -304,6 +315,7 @@
 #pragma once
 
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -423,6 +435,11 @@ class tilemap_t
 	// maximum index in each array
 	static const pen_t MAX_PEN_TO_FLAGS = 256;
 
+	// limits for splitting a draw into horizontal bands across worker threads
+	static const int PARALLEL_MIN_PIXELS = 256 * 256;
+	static const int PARALLEL_BAND_ROWS = 32;
+	static const int PARALLEL_MAX_BANDS = 8;
+
 	void init_common(tilemap_manager &manager, device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, u16 tilewidth, u16 tileheight, u32 cols, u32 rows);
 
 protected:
@@ -453,8 +470,10 @@ public:
 	int scrolldy() const { return (m_attributes & TILEMAP_FLIPY) ? m_dy_flipped : m_dy; }
 	int scrollx(int which = 0) const { return (which < m_scrollrows) ? m_rowscroll[which] : 0; }
 	int scrolly(int which = 0) const { return (which < m_scrollcols) ? m_colscroll[which] : 0; }
-	bitmap_ind16 &pixmap() { pixmap_update(); return m_pixmap; }
-	bitmap_ind8 &flagsmap() { pixmap_update(); return m_flagsmap; }
+	bitmap_ind16 &pixmap() { if (m_tile_cache) set_tile_cache(false); pixmap_update(); return m_pixmap; }
+	bitmap_ind8 &flagsmap() { if (m_tile_cache) set_tile_cache(false); pixmap_update(); return m_flagsmap; }
+	bool tile_cache() const { return m_tile_cache; }
+	size_t memory_usage() const;
 	u8 *tile_flags() { pixmap_update(); return &m_tileflags[0]; }
 	tilemap_memory_index memory_index(u32 col, u32 row) { return m_mapper(col, row, m_cols, m_rows); }
 	void get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &color);
@@ -473,6 +492,7 @@ public:
 	void set_scroll_rows(u32 scroll_rows) { assert(scroll_rows <= m_height); m_scrollrows = scroll_rows; }
 	void set_scroll_cols(u32 scroll_cols) { assert(scroll_cols <= m_width); m_scrollcols = scroll_cols; }
 	void set_flip(u32 attributes) { if (m_attributes != attributes) { m_attributes = attributes; mappings_update(); } }
+	void set_tile_cache(bool enable);
 
 	// dirtying
 	void mark_mapping_dirty() { mappings_update(); }
@@ -524,6 +544,46 @@ private:
 		u8                  mask;
 		u8                  value;
 		u8                  alpha;
+		u8                  band;
+	};
+
+	// identity of a rendered tile in the tile cache
+	struct tile_cache_key
+	{
+		const u8 *          pen_data;
+		const u8 *          mask_data;
+		u32                 palette_base;
+		logical_index       owner;          // INVALID_LOGICAL_INDEX if shareable between tiles
+		u8                  category;
+		u8                  group;
+		u8                  flags;
+		u8                  pen_mask;
+
+		bool operator==(const tile_cache_key &rhs) const
+		{
+			return pen_data == rhs.pen_data && mask_data == rhs.mask_data && palette_base == rhs.palette_base && owner == rhs.owner
+				&& category == rhs.category && group == rhs.group && flags == rhs.flags && pen_mask == rhs.pen_mask;
+		}
+	};
+	struct tile_cache_key_hash
+	{
+		size_t operator()(const tile_cache_key &key) const
+		{
+			size_t result = std::hash<const u8 *>()(key.pen_data) ^ (std::hash<const u8 *>()(key.mask_data) << 1);
+			result = result * 31 + key.palette_base;
+			result = result * 31 + key.owner;
+			return result * 31 + (key.category | (key.group << 8) | (key.flags << 16) | (key.pen_mask << 24));
+		}
+	};
+
+	// one horizontal band of a parallel draw
+	template<class _BitmapClass>
+	struct draw_band
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
 	};
 
 	// inline helpers
@@ -550,13 +610,19 @@ private:
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, u32 col, u32 row);
-	u8 tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
-	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
+	u8 tile_draw(const u8 *pendata, u16 *pixptr, u8 *flagsptr, int pixrowpixels, int flagsrowpixels, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
+	u8 tile_apply_bitmask(const u8 *maskdata, u8 *flagsptr, int flagsrowpixels, u8 category, u8 flags);
+	void tile_cache_flush();
+	u32 tile_cache_offset(u32 x, u32 y) const;
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_blit(screen_device &screen, _BitmapClass &dest, blit_parameters blit);
+	template<class _BitmapClass> void draw_parallel(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int bands);
+	template<class _BitmapClass> static void *draw_band_callback(void *param, int threadid);
+	int parallel_bands(const rectangle &cliprect) const;
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
-	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
+	template<bool Cached, class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
 
 	// managers and devices
 	tilemap_manager *           m_manager;              // reference to the owning manager
@@ -608,6 +674,16 @@ private:
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
+
+	// tile cache used in place of the full pixmap
+	bool                        m_tile_cache;           // true if drawing from the tile cache
+	std::unordered_map<tile_cache_key, u32, tile_cache_key_hash> m_tilecache_map; // map from rendered tile to cache entry
+	std::vector<u32>            m_tilecache_index;      // cache entry for each logical tile
+	std::vector<u16>            m_tilecache_pixels;     // cached pixel data, one tile per entry
+	std::vector<u8>             m_tilecache_flags;      // cached per-pixel flags, one tile per entry
+	std::vector<u8>             m_tilecache_summary;    // per-tile flags for each entry
+	bitmap_ind16                m_strip_pixmap[PARALLEL_MAX_BANDS]; // one row of tiles assembled for drawing
+	bitmap_ind8                 m_strip_flagsmap[PARALLEL_MAX_BANDS]; // flags for the assembled row of tiles
 };
 
 
@@ -643,6 +719,9 @@ public:
 	void set_flip_all(u32 attributes);
 
 private:
+	// work queue for parallel drawing, allocated on first use
+	osd_work_queue *work_queue();
+
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_standard_mapper mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -654,6 +733,7 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;
 };
 
 
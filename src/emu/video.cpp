@@ -235,7 +235,10 @@ void video_manager::frame_update(bool from_debugger)
 
 	// ask the OSD to update
 	g_profiler.start(PROFILER_BLIT);
-	machine().osd().update(!from_debugger && skipped_it);
+	{
+		profiler_trace_scope trace("OSD update");
+		machine().osd().update(!from_debugger && skipped_it);
+	}
 	g_profiler.stop();
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
@@ -617,6 +620,14 @@ void video_manager::end_recording_avi(uint32_t index)
 	avi_info_t &info = m_avis[index];
 	if (info.m_avi_file)
 	{
+		// let any frames still being written complete, and consume the
+		// result so it can't be mistaken for one from a later recording
+		if (info.m_avi_pending.valid())
+		{
+			avi_file::error const avierr = info.m_avi_pending.get();
+			if (avierr != avi_file::error::NONE)
+				osd_printf_error("Error writing AVI: %s\n", avi_file::error_string(avierr));
+		}
 		info.m_avi_file.reset();
 
 		// reset the state
@@ -664,8 +675,8 @@ void video_manager::add_sound_to_recording(const s16 *sound, int numsamples)
 void video_manager::add_sound_to_avi_recording(const s16 *sound, int numsamples, uint32_t index)
 {
 	avi_info_t &info = m_avis[index];
-	// only record if we have a file
-	if (info.m_avi_file != nullptr)
+	// only record if we have a file; the frame writer also uses the sound buffers
+	if (info.m_avi_file != nullptr && finish_avi_frames(index))
 	{
 		g_profiler.start(PROFILER_MOVIE_REC);
 
@@ -1472,26 +1483,40 @@ void video_manager::record_frame()
 		// create the bitmap
 		create_snapshot_bitmap(iter.current());
 
-		// handle an AVI recording
-		if ((index < m_avis.size()) && m_avis[index].m_avi_file)
+		// handle an AVI recording; wait for the previous frame to be written first
+		if ((index < m_avis.size()) && m_avis[index].m_avi_file && finish_avi_frames(index))
 		{
 			avi_info_t &avi_info = m_avis[index];
 
 			// loop until we hit the right time
+			u32 frames = 0;
 			while (avi_info.m_avi_next_frame_time <= curtime)
 			{
-				// write the next frame
-				avi_file::error avierr = avi_info.m_avi_file->append_video_frame(m_snap_bitmap);
-				if (avierr != avi_file::error::NONE)
-				{
-					g_profiler.stop(); // FIXME: double exit if this happens?
-					end_recording_avi(index);
-					break;
-				}
-
 				// advance time
 				avi_info.m_avi_next_frame_time += avi_info.m_avi_frame_period;
 				avi_info.m_avi_frame++;
+				frames++;
+			}
+
+			// write the frames in the background while emulation continues
+			if (frames != 0)
+			{
+				if (avi_info.m_avi_bitmap.width() != m_snap_bitmap.width() || avi_info.m_avi_bitmap.height() != m_snap_bitmap.height())
+					avi_info.m_avi_bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+				copybitmap(avi_info.m_avi_bitmap, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+
+				avi_file &file = *avi_info.m_avi_file;
+				bitmap_rgb32 &bitmap = avi_info.m_avi_bitmap;
+				avi_info.m_avi_pending = std::async(std::launch::async, [&file, &bitmap, frames] ()
+				{
+					for (u32 frame = 0; frame < frames; frame++)
+					{
+						avi_file::error const avierr = file.append_video_frame(bitmap);
+						if (avierr != avi_file::error::NONE)
+							return avierr;
+					}
+					return avi_file::error::NONE;
+				});
 			}
 		}
 
@@ -1540,6 +1565,27 @@ void video_manager::record_frame()
 	g_profiler.stop();
 }
 
+//-------------------------------------------------
+//  finish_avi_frames - wait for frames being
+//  written to an AVI recording, and stop the
+//  recording if writing them failed
+//-------------------------------------------------
+
+bool video_manager::finish_avi_frames(uint32_t index)
+{
+	avi_info_t &info = m_avis[index];
+	if (!info.m_avi_pending.valid())
+		return true;
+
+	avi_file::error const avierr = info.m_avi_pending.get();
+	if (avierr == avi_file::error::NONE)
+		return true;
+
+	osd_printf_error("Error writing AVI: %s\n", avi_file::error_string(avierr));
+	end_recording_avi(index);
+	return false;
+}
+
 //-------------------------------------------------
 //  toggle_throttle
 //-------------------------------------------------
@@ -19,6 +19,8 @@
 
 #include "aviio.h"
 
+#include <future>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -131,6 +133,7 @@ private:
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
 	void record_frame();
+	bool finish_avi_frames(uint32_t index);
 
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
@@ -210,6 +213,8 @@ private:
 		attotime            m_avi_frame_period;         // period of a single movie frame
 		attotime            m_avi_next_frame_time;      // time of next frame
 		u32                 m_avi_frame;                // current movie frame number
+		bitmap_rgb32        m_avi_bitmap;               // copy of the frame being written
+		std::future<avi_file::error> m_avi_pending;     // frames being written in the background
 	};
 	std::vector<avi_info_t> m_avis;
 
@@ -701,16 +701,16 @@ void output_one_device(std::ostream &out, machine_config &config, device_t &devi
 
 void output_devices(std::ostream &out, emu_options &lookup_options, device_type_set const *filter)
 {
-	// get config for empty machine
-	machine_config config(GAME_NAME(___empty), lookup_options);
-
-	auto const action = [&config, &out] (device_type type)
+	// each device gets its own empty machine config so they can be described in parallel
+	auto const action = [&lookup_options] (std::add_pointer_t<device_type> type)
 			{
+				machine_config config(GAME_NAME(___empty), lookup_options);
+
 				// add it at the root of the machine config
 				device_t *dev;
 				{
 					machine_config::token const tok(config.begin_configuration(config.root_device()));
-					dev = config.device_add("_tmp", type, 0);
+					dev = config.device_add("_tmp", *type, 0);
 				}
 
 				// notify this device and all its subdevices that they are now configured
@@ -718,20 +718,39 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 					if (!device.configured())
 						device.config_complete();
 
-				// print details and remove it
-				output_one_device(out, config, *dev, dev->tag());
-				machine_config::token const tok(config.begin_configuration(config.root_device()));
-				config.device_remove("_tmp");
+				// print details
+				std::ostringstream stream;
+				output_one_device(stream, config, *dev, dev->tag());
+				return stream.str();
+			};
+
+	// keep a window of devices in flight, emitting them in order
+	std::queue<std::future<std::string>> queue;
+	auto const enqueue = [&action, &out, &queue] (std::add_pointer_t<device_type> type)
+			{
+				queue.push(std::async(std::launch::async, action, type));
+				if (queue.size() >= 20)
+				{
+					out << queue.front().get();
+					queue.pop();
+				}
 			};
 
 	// run through devices
 	if (filter)
 	{
-		for (std::add_pointer_t<device_type> type : *filter) action(*type);
+		for (std::add_pointer_t<device_type> type : *filter) enqueue(type);
 	}
 	else
 	{
-		for (device_type type : registered_device_types) action(type);
+		for (device_type type : registered_device_types) enqueue(&type);
+	}
+
+	// emit whatever is still outstanding
+	while (!queue.empty())
+	{
+		out << queue.front().get();
+		queue.pop();
 	}
 }
 
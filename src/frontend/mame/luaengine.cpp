@@ -26,6 +26,8 @@
 #include "softlist.h"
 #include "inputdev.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <thread>
 
@@ -692,6 +694,10 @@ void lua_engine::on_machine_start()
 void lua_engine::on_machine_stop()
 {
 	execute_function("LUA_ON_STOP");
+
+	// watched spaces and ports go away with the machine
+	for (context *ctx : m_contexts)
+		ctx->watches.clear();
 }
 
 void lua_engine::on_machine_before_load_settings()
@@ -711,6 +717,8 @@ void lua_engine::on_machine_resume()
 
 void lua_engine::on_machine_frame()
 {
+	for (context *ctx : m_contexts)
+		ctx->sample();
 	execute_function("LUA_ON_FRAME");
 }
 
@@ -1006,13 +1014,24 @@ void lua_engine::initialize()
  *                     in a new empty (other than modules) lua context.
  *                     thread runs until yield() and/or terminates on return.
  * thread:continue(val) - resume thread that has yielded and pass val to it
+ * thread:watch_memory(name, space, addr, width) - sample memory at the end of every frame
+ * thread:watch_port(name, port) - sample an ioport at the end of every frame
+ * thread:watch_output(name, output) - sample a named output at the end of every frame
+ * thread:unwatch() - stop sampling
+ * thread:receive() - pop the next message sent by the thread, nil if none
  *
  * thread.result - get result of a terminated thread as string
  * thread.busy - check if thread is running
  * thread.yield - check if thread is yielded
+ *
+ * inside the thread:
+ * snapshot(wait) - get table of the latest sampled values and the frame number,
+ *                  if wait is true block until a new frame has been sampled
+ *                  (returns nil after one second without a frame)
+ * send(msg) - queue msg (string) for thread:receive() on the emulation thread
  */
 
-	auto thread_type = emu.create_simple_usertype<context>(sol::call_constructor, sol::constructors<sol::types<>>());
+	auto thread_type = emu.create_simple_usertype<context>(sol::call_constructor, sol::initializers([this](context &ctx) { new (&ctx) context(*this); }));
 	thread_type.set("start", [](context &ctx, const char *scr) {
 			std::string script(scr);
 			if(ctx.busy)
@@ -1027,6 +1046,21 @@ void lua_engine::initialize()
 					if(res.valid())
 					{
 						sol::protected_function func = res.get<sol::protected_function>();
+						u64 seen = ~u64(0);
+						thstate["snapshot"] = [&ctx, &thstate, &seen](bool wait) -> std::tuple<sol::object, sol::object> {
+								std::unique_lock<std::mutex> lock(ctx.lock);
+								if(wait && !ctx.framesync.wait_for(lock, std::chrono::seconds(1), [&ctx, &seen]() { return ctx.frame != seen; }))
+									return std::make_tuple(sol::make_object(thstate, sol::nil), sol::make_object(thstate, sol::nil));
+								seen = ctx.frame;
+								sol::table values = thstate.create_table();
+								for(auto &value : ctx.snapshot)
+									values[value.first] = value.second;
+								return std::make_tuple(sol::make_object(thstate, values), sol::make_object(thstate, ctx.frame));
+							};
+						thstate["send"] = [&ctx](const char *msg) {
+								std::lock_guard<std::mutex> lock(ctx.lock);
+								ctx.messages.emplace_back(msg);
+							};
 						thstate["yield"] = [&ctx, &thstate]() {
 								std::mutex m;
 								std::unique_lock<std::mutex> lock(m);
@@ -1058,6 +1092,36 @@ void lua_engine::initialize()
 			ctx.result = val;
 			ctx.sync.notify_all();
 		});
+	thread_type.set("watch_memory", [](context &ctx, const char *name, addr_space &sp, offs_t address, int width) {
+			address_space &space = sp.space;
+			std::function<u64 ()> read;
+			switch(width)
+			{
+				case 8: read = [&space, address]() -> u64 { return space.read_byte(address); }; break;
+				case 16: read = [&space, address]() -> u64 { return space.read_word_unaligned(address); }; break;
+				case 32: read = [&space, address]() -> u64 { return space.read_dword_unaligned(address); }; break;
+				case 64: read = [&space, address]() -> u64 { return space.read_qword_unaligned(address); }; break;
+				default: return false;
+			}
+			ctx.watches.push_back(context::watch{ name, std::move(read) });
+			return true;
+		});
+	thread_type.set("watch_port", [](context &ctx, const char *name, ioport_port &port) {
+			ctx.watches.push_back(context::watch{ name, [&port]() -> u64 { return port.read(); } });
+		});
+	thread_type.set("watch_output", [this](context &ctx, const char *name, const char *output) {
+			std::string outname(output);
+			ctx.watches.push_back(context::watch{ name, [this, outname]() -> u64 { return machine().output().get_value(outname.c_str()); } });
+		});
+	thread_type.set("unwatch", [](context &ctx) { ctx.watches.clear(); });
+	thread_type.set("receive", [this](context &ctx) -> sol::object {
+			std::lock_guard<std::mutex> lock(ctx.lock);
+			if(ctx.messages.empty())
+				return sol::make_object(sol(), sol::nil);
+			std::string msg(std::move(ctx.messages.front()));
+			ctx.messages.pop_front();
+			return sol::make_object(sol(), msg);
+		});
 	thread_type.set("result", sol::property([](context &ctx) -> std::string {
 			if(ctx.busy && !ctx.yield)
 				return "";
@@ -1296,11 +1360,15 @@ void lua_engine::initialize()
  * machine:input() - get input_manager
  * machine:uiinput() - get ui_input_manager
  * machine:debugger() - get debugger_manager
+ * machine:reset_exec_stats() - clear execution statistics for all devices
+ * machine:memory_usage() - get bytes used per device (k=tag, v=table of k=category, v=bytes)
  *
  * machine.paused - get paused state
  * machine.samplerate - get audio sample rate
  * machine.exit_pending
  * machine.hard_reset_pending
+ * machine.exec_stats_enabled - get/set per-device execution statistics gathering
+ * machine.exec_stats_elapsed - emulated seconds since execution statistics were reset
  *
  * machine.devices[] - get device table (k=tag, v=device_t)
  * machine.screens[] - get screens table (k=tag, v=screen_device)
@@ -1358,6 +1426,22 @@ void lua_engine::initialize()
 	machine_type.set("samplerate", sol::property(&running_machine::sample_rate));
 	machine_type.set("exit_pending", sol::property(&running_machine::exit_pending));
 	machine_type.set("hard_reset_pending", sol::property(&running_machine::hard_reset_pending));
+	machine_type.set("exec_stats_enabled", sol::property(
+			[](running_machine &m) { return m.scheduler().statistics_enabled(); },
+			[](running_machine &m, bool enable) { m.scheduler().enable_statistics(enable); }));
+	machine_type.set("exec_stats_elapsed", sol::property([](running_machine &m) { return m.scheduler().statistics_elapsed().as_double(); }));
+	machine_type.set("reset_exec_stats", [](running_machine &m) { m.scheduler().reset_statistics(); });
+	machine_type.set("memory_usage", [this](running_machine &m) {
+			sol::table table = sol().create_table();
+			for (auto const &device : m.memory_usage())
+			{
+				sol::table categories = sol().create_table();
+				for (auto const &category : device.second)
+					categories[category.first] = category.second;
+				table[device.first] = categories;
+			}
+			return table;
+		});
 	machine_type.set("devices", sol::property([this](running_machine &m) {
 			std::function<void(device_t &, sol::table)> tree;
 			sol::table table = sol().create_table();
@@ -1627,6 +1711,7 @@ void lua_engine::initialize()
  * device:tag() - device tree tag
  * device:owner() - device parent tag
  * device:debug() - debug interface, cpus only
+ * device:exec_stats() - execution statistics table, executing devices only
  *
  * device.spaces[] - device address spaces table (k=name, v=addr_space)
  * device.state[] - device state entries table (k=name, v=device_state_entry)
@@ -1643,6 +1728,20 @@ void lua_engine::initialize()
 				return sol::make_object(sol(), sol::nil);
 			return sol::make_object(sol(), dev.debug());
 		});
+	device_type.set("exec_stats", [this](device_t &dev) -> sol::object {
+			device_execute_interface *exec;
+			if(!dev.interface(exec))
+				return sol::make_object(sol(), sol::nil);
+			const device_execute_interface::statistics &stats = exec->stats();
+			sol::table table = sol().create_table();
+			table["host_seconds"] = double(stats.m_host_ticks) / double(osd_ticks_per_second());
+			table["timeslices"] = stats.m_timeslices;
+			table["cycles_requested"] = stats.m_cycles_requested;
+			table["cycles_executed"] = stats.m_cycles_executed;
+			table["aborts"] = stats.m_aborts;
+			table["boosts"] = stats.m_boosts;
+			return table;
+		});
 	device_type.set("spaces", sol::property([this](device_t &dev) {
 			device_memory_interface *memdev = dynamic_cast<device_memory_interface *>(&dev);
 			sol::table sp_table = sol().create_table();
@@ -1702,6 +1801,11 @@ void lua_engine::initialize()
  * space:write_direct_*(addr, val)
  * space:read_range(first_addr, last_addr, width, [opt] step) - read range of addresses and
  *                                                              return as a binary string
+ * space:enable_access_stats([opt] page_shift) - start counting accesses per handler and page
+ * space:disable_access_stats() - stop counting and discard the counts
+ * space:reset_access_stats() - clear the access counts
+ * space:access_stats() - table with handlers (k=name) and pages (k=page start address) of
+ *                        {reads, writes}, or nil if not counting
  *
  * space.name - address space name
  * space.shift - address bus shift, bitshift required for a bytewise address
@@ -1821,6 +1925,35 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, byte_count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		});
+	addr_space_type.set("enable_access_stats", [](addr_space &sp, sol::object page_shift) {
+			sp.space.enable_access_statistics(page_shift.is<u8>() ? page_shift.as<u8>() : 12);
+		});
+	addr_space_type.set("disable_access_stats", [](addr_space &sp) { sp.space.disable_access_statistics(); });
+	addr_space_type.set("reset_access_stats", [](addr_space &sp) {
+			if(sp.space.access_statistics())
+				sp.space.access_statistics()->reset();
+		});
+	addr_space_type.set("access_stats", [this](addr_space &sp) -> sol::object {
+			memory_access_statistics *stats = sp.space.access_statistics();
+			if(!stats)
+				return sol::make_object(sol(), sol::nil);
+			auto const make_counts = [this](const memory_access_statistics::counts &counts) {
+					sol::table table = sol().create_table();
+					table["reads"] = counts.m_reads;
+					table["writes"] = counts.m_writes;
+					return table;
+				};
+			sol::table handlers = sol().create_table();
+			for(auto const &handler : stats->handlers())
+				handlers[handler.first] = make_counts(handler.second);
+			sol::table pages = sol().create_table();
+			for(auto const &page : stats->pages())
+				pages[offs_t(page.first << stats->page_shift())] = make_counts(page.second);
+			sol::table table = sol().create_table();
+			table["handlers"] = handlers;
+			table["pages"] = pages;
+			return table;
+		});
 	addr_space_type.set("name", sol::property([](addr_space &sp) { return sp.space.name(); }));
 	addr_space_type.set("shift", sol::property([](addr_space &sp) { return sp.space.addr_shift(); }));
 	addr_space_type.set("index", sol::property([](addr_space &sp) { return sp.space.spacenum(); }));
@@ -2178,8 +2311,10 @@ void lua_engine::initialize()
  * sound:ui_mute(turn_off) - turns on/off UI sound
  * sound:system_mute() - turns on/off system sound
  * sound:samples() - get current audio buffer contents in binary form as string (updates 50 times per second)
+ * sound:stream_profile() - get per-stream host time in seconds and sample counts (requires -profile_sound)
  *
  * sound.attenuation - sound attenuation
+ * sound.mix_profile - host time in seconds spent in the final mix (requires -profile_sound)
  */
 
 	auto sound_type = sol().registry().create_simple_usertype<sound_manager>("new", sol::no_constructor);
@@ -2197,6 +2332,22 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		});
+	sound_type.set("stream_profile", [this](sound_manager &sm) {
+			sol::table table = sol().create_table();
+			const double seconds_per_tick = 1.0 / double(osd_ticks_per_second());
+			int index = 1;
+			for (auto &stream : sm.streams())
+			{
+				sol::table entry = sol().create_table();
+				entry["tag"] = stream->device().tag();
+				entry["samples"] = stream->profile_samples();
+				entry["callback"] = double(stream->profile_callback_ticks()) * seconds_per_tick;
+				entry["resample"] = double(stream->profile_resample_ticks()) * seconds_per_tick;
+				table[index++] = entry;
+			}
+			return table;
+		});
+	sound_type.set("mix_profile", sol::property([](sound_manager &sm) { return double(sm.profile_mix_ticks()) / double(osd_ticks_per_second()); }));
 	sound_type.set("attenuation", sol::property(&sound_manager::attenuation, &sound_manager::set_attenuation));
 	sol().registry().set_usertype("sound", sound_type);
 
@@ -2910,6 +3061,42 @@ void lua_engine::initialize()
 	sol()["mame_manager"] = std::ref(*mame_machine_manager::instance());
 }
 
+//-------------------------------------------------
+//  context - thread state, tracked so watched
+//  values can be sampled at the end of each frame
+//-------------------------------------------------
+
+lua_engine::context::context(lua_engine &eng) : busy(false), yield(false), engine(eng), frame(0)
+{
+	engine.m_contexts.push_back(this);
+}
+
+lua_engine::context::~context()
+{
+	auto it = std::find(engine.m_contexts.begin(), engine.m_contexts.end(), this);
+	if (it != engine.m_contexts.end())
+		engine.m_contexts.erase(it);
+}
+
+void lua_engine::context::sample()
+{
+	if (watches.empty())
+		return;
+
+	// read outside the lock so the thread is only held up by the copy
+	std::vector<std::pair<std::string, u64>> values;
+	values.reserve(watches.size());
+	for (watch &w : watches)
+		values.emplace_back(w.name, w.read());
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		snapshot.swap(values);
+		frame++;
+	}
+	framesync.notify_all();
+}
+
 //-------------------------------------------------
 //  frame_hook - called at each frame refresh, used to draw a HUD
 //-------------------------------------------------
@@ -15,8 +15,11 @@
 #include "iptseqpoll.h"
 
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #if defined(__GNUC__) && (__GNUC__ > 6)
 #pragma GCC diagnostic ignored "-Wnoexcept-type"
@@ -168,12 +171,30 @@ private:
 
 	struct context
 	{
-		context() { busy = false; yield = false; }
+		context(lua_engine &eng);
+		~context();
+		void sample();
+
 		std::string result;
 		std::condition_variable sync;
 		bool busy;
 		bool yield;
+
+		// values sampled on the emulation thread at the end of every frame
+		struct watch
+		{
+			std::string name;
+			std::function<u64 ()> read;
+		};
+		lua_engine &engine;
+		std::vector<watch> watches;
+		std::mutex lock;
+		std::condition_variable framesync;
+		std::vector<std::pair<std::string, u64>> snapshot;
+		u64 frame;
+		std::deque<std::string> messages;
 	};
+	std::vector<context *> m_contexts;
 
 	template<typename TFunc, typename... TArgs>
 	sol::protected_function_result invoke(TFunc &&func, TArgs&&... args);
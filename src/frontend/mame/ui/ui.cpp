@@ -732,6 +732,7 @@ void mame_ui_manager::set_show_profiler(bool show)
 {
 	m_show_profiler = show;
 	g_profiler.enable(show);
+	machine().scheduler().enable_statistics(show);
 }
 
 
@@ -1241,7 +1242,23 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 		show_fps_temp(0.5);
 	}
 	else
-		machine().video().set_fastforward(false);
+	{
+		// optionally fast forward while loading from tape
+		bool tape_busy = false;
+		if (machine().options().tape_turbo())
+		{
+			for (cassette_image_device &cass : cassette_device_iterator(machine().root_device()))
+			{
+				cassette_state const state = cass.get_state();
+				if ((state & CASSETTE_MASK_UISTATE) == CASSETTE_PLAY && (state & CASSETTE_MASK_MOTOR) == CASSETTE_MOTOR_ENABLED)
+				{
+					tape_busy = true;
+					break;
+				}
+			}
+		}
+		machine().video().set_fastforward(tape_busy);
+	}
 
 	return 0;
 }
@@ -124,8 +124,8 @@ namespace netlist
 		m_qsize = this->size();
 		for (std::size_t i = 0; i < m_qsize; i++ )
 		{
-			m_times[i] =  this->listptr()[i].exec_time().as_raw();
-			m_net_ids[i] = state().find_net_id(this->listptr()[i].object());
+			m_times[i] =  (*this)[i].exec_time().as_raw();
+			m_net_ids[i] = state().find_net_id((*this)[i].object());
 		}
 	}
 
@@ -281,6 +281,7 @@ namespace netlist
 		ENTRY(PHAS_PMF_INTERNAL)
 		ENTRY(NL_USE_MEMPOOL)
 		ENTRY(NL_USE_QUEUE_STATS)
+		ENTRY(NL_USE_QUEUE_WHEEL)
 		ENTRY(NL_USE_COPY_INSTEAD_OF_REFERENCE)
 		ENTRY(NL_USE_TRUTHTABLE_7448)
 		ENTRY(NL_AUTO_DEVICES)
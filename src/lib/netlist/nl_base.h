@@ -1311,8 +1311,13 @@ namespace netlist
 			family_setter_t(core_device_t &dev, const logic_family_desc_t &desc);
 		};
 
+#if (NL_USE_QUEUE_WHEEL)
+		template <class T, bool TS>
+		using timed_queue = plib::timed_queue_wheel<T, TS>;
+#else
 		template <class T, bool TS>
 		using timed_queue = plib::timed_queue_linear<T, TS>;
+#endif
 
 		// Use timed_queue_heap to use stdc++ heap functions instead of linear processing.
 		// This slows down processing by about 25% on a Kaby Lake.
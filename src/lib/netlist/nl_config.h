@@ -53,6 +53,20 @@
 #define NL_USE_QUEUE_STATS             (0)
 #endif
 
+/// \brief  Use a bucketed time wheel for the event queue.
+///
+/// Set to 1 to use \ref plib::timed_queue_wheel instead of the sorted
+/// linear list. Insertion costs depend on the number of entries within
+/// the same 1.6ns time bucket instead of the number of pending entries,
+/// which pays off for netlists with many pending events. For small
+/// queues, e.g. pong and breakout, the linear list is faster. Both deliver
+/// events in the same order. Use nltool -c queuebench to compare them.
+///
+
+#ifndef NL_USE_QUEUE_WHEEL
+#define NL_USE_QUEUE_WHEEL             (0)
+#endif
+
 /// \brief  Store input values in logic_terminal_t.
 ///
 /// Set to 1 to store values in logic_terminal_t instead of
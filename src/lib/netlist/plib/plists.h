@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <iterator>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -516,6 +517,325 @@ namespace plib {
 		pperfcount_t<true> m_prof_retime;
 	};
 
+	/// \brief Bucketed time wheel queue.
+	///
+	/// Entries are hashed by execution time into BUCKETS buckets, each
+	/// covering 2^SHIFT time units. Only the bucket being inserted into is
+	/// kept sorted, so most pushes only compare against a handful of entries
+	/// instead of every pending one. Entries beyond the horizon of the wheel
+	/// are kept in a sorted overflow list and migrated as the wheel advances.
+	///
+	/// The wheel is anchored at the bucket of the last entry popped. Entries
+	/// pushed should not be earlier than this entry, which holds for event
+	/// driven simulation. Earlier entries are supported but slow.
+	///
+	/// With the default parameters and the 100ps netlist time resolution a
+	/// bucket covers 1.6ns and the wheel about 410ns, which covers the gate
+	/// delays of TTL logic families.
+	///
+	/// Entries with the same time are delivered in the same order as by
+	/// \ref timed_queue_linear. Indexing via operator[] returns entries latest
+	/// first, i.e. the element returned by top() is at index size() - 1.
+	///
+	template <class T, bool TS, std::size_t SHIFT = 4, std::size_t BUCKETS = 256>
+	class timed_queue_wheel : nocopyassignmove
+	{
+	public:
+
+		static_assert((BUCKETS & (BUCKETS - 1)) == 0 && BUCKETS >= 64, "BUCKETS must be a power of 2 and at least 64");
+
+		explicit timed_queue_wheel(const std::size_t list_size)
+		: m_buckets(BUCKETS)
+		, m_never(T::never())
+		{
+			for (auto &b : m_buckets)
+				b.reserve(8);
+			m_overflow.reserve(list_size);
+			clear();
+		}
+
+		std::size_t capacity() const noexcept { return m_overflow.capacity(); }
+		bool empty() const noexcept { return m_count == 0; }
+
+		template <bool KEEPSTAT>
+		void push(T && e) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			do_push<KEEPSTAT>(std::move(e));
+			if (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		void pop() noexcept
+		{
+			--m_count;
+			if (m_wheel_count == 0)
+			{
+				set_base(raw(m_overflow.back()));
+				m_overflow.pop_back();
+				migrate();
+				return;
+			}
+
+			// move the anchor to the bucket of the entry popped
+			m_cur = (m_cur + m_top) & MASK;
+			m_base += static_cast<time_type>(m_top) * WIDTH;
+			m_top = 0;
+
+			auto &b = m_buckets[m_cur];
+			b.pop_back();
+			--m_wheel_count;
+			if (b.empty())
+			{
+				m_used[m_cur >> 6] &= ~(std::uint64_t(1) << (m_cur & 63));
+				if (m_wheel_count > 0)
+					m_top = next_used(m_cur);
+			}
+			migrate();
+		}
+
+		const T &top() const noexcept
+		{
+			if (m_wheel_count > 0)
+				return m_buckets[(m_cur + m_top) & MASK].back();
+			return m_count > 0 ? m_overflow.back() : m_never;
+		}
+
+		template <bool KEEPSTAT, class R>
+		void remove(const R &elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_remove.inc();
+			do_remove(elem);
+		}
+
+		template <bool KEEPSTAT, class R>
+		void retime(R && elem) noexcept
+		{
+			// Lock
+			lock_guard_type lck(m_lock);
+			if (KEEPSTAT)
+				m_prof_retime.inc();
+			time_type old(0);
+			if (do_remove(elem, &old)) // partial equal!
+			{
+				// like timed_queue_linear, an entry moved to an earlier
+				// time goes behind entries with the same time
+				T e(std::forward<R>(elem));
+				if (raw(e) < old)
+					do_push<KEEPSTAT, true>(std::move(e));
+				else
+					do_push<KEEPSTAT, false>(std::move(e));
+			}
+		}
+
+		void clear() noexcept
+		{
+			lock_guard_type lck(m_lock);
+			for (auto &b : m_buckets)
+				b.clear();
+			m_used.fill(0);
+			m_overflow.clear();
+			m_count = 0;
+			m_wheel_count = 0;
+			m_cur = 0;
+			m_top = 0;
+			m_base = 0;
+		}
+
+		// save state support & mame disasm
+
+		std::size_t size() const noexcept { return m_count; }
+		const T & operator[](std::size_t index) const noexcept
+		{
+			if (index < m_overflow.size())
+				return m_overflow[index];
+			index -= m_overflow.size();
+			for (std::size_t i = BUCKETS; i-- > 0; )
+			{
+				const auto &b = m_buckets[(m_cur + i) & MASK];
+				if (index < b.size())
+					return b[index];
+				index -= b.size();
+			}
+			return m_never;
+		}
+	private:
+		using mutex_type = pspin_mutex<TS>;
+		using lock_guard_type = std::lock_guard<mutex_type>;
+		using time_type = decltype(std::declval<T>().exec_time().as_raw());
+
+		static constexpr const std::size_t MASK = BUCKETS - 1;
+		static constexpr const time_type WIDTH = time_type(1) << SHIFT;
+		static constexpr const time_type HORIZON = WIDTH * static_cast<time_type>(BUCKETS);
+
+		static time_type raw(const T &e) noexcept { return e.exec_time().as_raw(); }
+
+		// insert into a list kept sorted latest first, BEHIND places the
+		// entry after existing entries with the same time
+		template <bool KEEPSTAT, bool BEHIND = false>
+		void insert_sorted(std::vector<T> &list, T && e) noexcept
+		{
+			list.push_back(std::move(e));
+			for (T *i = &list.back(); i != &list.front() && (BEHIND ? *(i-1) <= *i : *(i-1) < *i); --i)
+			{
+				std::swap(*(i-1), *i);
+				if (KEEPSTAT)
+					m_prof_sortmove.inc();
+			}
+		}
+
+		template <bool KEEPSTAT, bool BEHIND = false>
+		void insert_wheel(T && e) noexcept
+		{
+			const std::size_t d = static_cast<std::size_t>((raw(e) - m_base) >> SHIFT);
+			const std::size_t b = (m_cur + d) & MASK;
+			insert_sorted<KEEPSTAT, BEHIND>(m_buckets[b], std::move(e));
+			m_used[b >> 6] |= std::uint64_t(1) << (b & 63);
+			if (m_wheel_count++ == 0 || d < m_top)
+				m_top = d;
+		}
+
+		template <bool KEEPSTAT, bool BEHIND = false>
+		void do_push(T && e) noexcept
+		{
+			const time_type t = raw(e);
+			if (m_count == 0)
+				set_base(t);
+			else if (t < m_base)
+				rebase(t);
+
+			if (t - m_base < HORIZON)
+				insert_wheel<KEEPSTAT, BEHIND>(std::move(e));
+			else
+				insert_sorted<KEEPSTAT, BEHIND>(m_overflow, std::move(e));
+			++m_count;
+		}
+
+		template <class R>
+		bool do_remove(const R &elem, time_type *old = nullptr) noexcept
+		{
+			// pending entries are usually close to the current time
+			for (std::size_t i = next_used(m_cur); i < BUCKETS; i += 1 + next_used(m_cur + i + 1))
+			{
+				const std::size_t bi = (m_cur + i) & MASK;
+				auto &b = m_buckets[bi];
+				// == operator ignores time!
+				auto it = std::find(b.rbegin(), b.rend(), elem);
+				if (it != b.rend())
+				{
+					if (old != nullptr)
+						*old = raw(*it);
+					b.erase(std::next(it).base());
+					--m_wheel_count;
+					--m_count;
+					if (b.empty())
+					{
+						m_used[bi >> 6] &= ~(std::uint64_t(1) << (bi & 63));
+						if (i == m_top && m_wheel_count > 0)
+							m_top = next_used(m_cur);
+					}
+					return true;
+				}
+			}
+			auto it = std::find(m_overflow.begin(), m_overflow.end(), elem);
+			if (it != m_overflow.end())
+			{
+				if (old != nullptr)
+					*old = raw(*it);
+				m_overflow.erase(it);
+				--m_count;
+				return true;
+			}
+			return false;
+		}
+
+		// distance from bucket 'from' to the next bucket holding entries,
+		// BUCKETS if there is none
+		std::size_t next_used(std::size_t from) const noexcept
+		{
+			for (std::size_t d = 0; d < BUCKETS; )
+			{
+				const std::size_t b = (from + d) & MASK;
+				std::uint64_t w = m_used[b >> 6] >> (b & 63);
+				if (w != 0)
+				{
+					while (!(w & 1))
+					{
+						w >>= 1;
+						++d;
+					}
+					return std::min(d, BUCKETS);
+				}
+				d += 64 - (b & 63);
+			}
+			return BUCKETS;
+		}
+
+		void set_base(time_type t) noexcept
+		{
+			m_base = t & ~(WIDTH - 1);
+			m_cur = static_cast<std::size_t>(m_base >> SHIFT) & MASK;
+		}
+
+		// move entries from the overflow list which are now within the
+		// horizon, keeping the order of entries with the same time
+		void migrate() noexcept
+		{
+			auto first = m_overflow.end();
+			while (first != m_overflow.begin() && raw(*(first - 1)) - m_base < HORIZON)
+				--first;
+			for (auto i = first; i != m_overflow.end(); ++i)
+				insert_wheel<false>(std::move(*i));
+			m_overflow.erase(first, m_overflow.end());
+		}
+
+		// slow path: t is earlier than the anchor
+		void rebase(time_type t) noexcept
+		{
+			std::vector<T> tmp;
+			tmp.reserve(m_wheel_count);
+			for (std::size_t i = 0; i < BUCKETS; i++)
+			{
+				auto &b = m_buckets[(m_cur + i) & MASK];
+				std::move(b.begin(), b.end(), std::back_inserter(tmp));
+				b.clear();
+			}
+			m_used.fill(0);
+			m_wheel_count = 0;
+			set_base(t);
+			for (auto &e : tmp)
+			{
+				if (raw(e) - m_base < HORIZON)
+					insert_wheel<false>(std::move(e));
+				else
+					insert_sorted<false>(m_overflow, std::move(e));
+			}
+		}
+
+		mutex_type              m_lock;
+		PALIGNAS_CACHELINE()
+		std::size_t             m_cur;
+		std::size_t             m_top;
+		time_type               m_base;
+		std::size_t             m_count;
+		std::size_t             m_wheel_count;
+		std::array<std::uint64_t, BUCKETS / 64> m_used;
+		std::vector<std::vector<T>> m_buckets;
+		std::vector<T>          m_overflow;
+		T                       m_never;
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sortmove;
+		pperfcount_t<true> m_prof_call;
+		pperfcount_t<true> m_prof_remove;
+		pperfcount_t<true> m_prof_retime;
+	};
+
 } // namespace plib
 
 #endif // PLISTS_H_
@@ -22,6 +22,7 @@
 #include <iomanip> // scanf
 #include <ios>
 #include <iostream> // scanf
+#include <random>
 
 class tool_app_t : public plib::app
 {
@@ -29,7 +30,7 @@ public:
 	tool_app_t() :
 		plib::app(),
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","static","header","docheader"}), "run|validate|convert|listdevices|static|header|docheader"),
+		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","static","header","docheader","queuebench"}), "run|validate|convert|listdevices|static|header|docheader|queuebench"),
 		opt_file(*this,     "f", "file",        "-",        "file to process (default is stdin)"),
 		opt_includes(*this, "I", "include",                 "Add the directory to the list of directories to be searched for header files. This option may be specified repeatedly."),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
@@ -66,6 +67,10 @@ public:
 		opt_tabwidth(*this, "", "tab-width", 4,          "Tab width for output."),
 		opt_linewidth(*this,"", "line-width", 72,       "Line width for output."),
 
+		opt_grp8(*this,     "Options for queuebench command",  "These options are only used by the queuebench command."),
+		opt_qnets(*this,    "", "nets",      200,       "Number of nets scheduling events."),
+		opt_qevents(*this,  "", "events",    2000000,   "Number of events to process."),
+
 		opt_ex1(*this,     "nltool -c run -t 3.5 -f nl_examples/cdelay.c -n cap_delay",
 				"Run netlist \"cap_delay\" from file nl_examples/cdelay.c for 3.5 seconds"),
 		opt_ex2(*this,     "nltool --cmd=listdevices",
@@ -107,6 +112,9 @@ public:
 	plib::option_group  opt_grp7;
 	plib::option_num<unsigned> opt_tabwidth;
 	plib::option_num<unsigned> opt_linewidth;
+	plib::option_group  opt_grp8;
+	plib::option_num<unsigned> opt_qnets;
+	plib::option_num<unsigned> opt_qevents;
 	plib::option_example opt_ex1;
 	plib::option_example opt_ex2;
 	plib::option_example opt_ex3;
@@ -142,6 +150,7 @@ private:
 	void create_docheader();
 
 	void listdevices();
+	void queuebench();
 
 	std::vector<pstring> m_defines;
 
@@ -922,6 +931,92 @@ void tool_app_t::listdevices()
 	}
 }
 
+// -------------------------------------------------
+//    queuebench - compare timed queue implementations
+// -------------------------------------------------
+
+namespace {
+
+	struct qbench_net
+	{
+		bool m_queued = false;
+	};
+
+	using qbench_entry = plib::pqentry_t<qbench_net *, netlist::netlist_time_ext>;
+
+	// Synthetic logic workload: each delivered event schedules one or two
+	// nets with typical TTL gate delays. Nets already queued are removed
+	// first like net_t::push_to_queue does. A stop entry is queued for every
+	// 48kHz slice like netlist_t::process_queue does.
+	template <typename Q>
+	void qbench_run(tool_app_t &app, const pstring &name, std::vector<qbench_net> &nets, std::size_t events)
+	{
+		using tt = netlist::netlist_time_ext;
+
+		std::mt19937 rng(1234);
+		std::vector<std::uint32_t> rnd(65536);
+		for (auto &r : rnd)
+			r = rng();
+		std::size_t ri = 0;
+		auto next_rnd = [&rnd, &ri]() { return rnd[ri++ & 0xffff]; };
+
+		const tt slice(tt::from_hz(48000));
+		const std::array<tt, 3> delays = { tt::from_nsec(10), tt::from_nsec(15), tt::from_nsec(20) };
+
+		Q q(4096);
+		for (auto &n : nets)
+			n.m_queued = false;
+		for (std::size_t i = 0; i < nets.size() / 4; i++)
+		{
+			nets[i].m_queued = true;
+			q.template push<false>(qbench_entry(delays[next_rnd() % 3], &nets[i]));
+		}
+		q.template push<false>(qbench_entry(slice, nullptr));
+
+		std::size_t qsize = 0;
+		plib::chrono::timer<plib::chrono::system_ticks> t;
+		{
+			auto t_guard(t.guard());
+			for (std::size_t e = 0; e < events; e++)
+			{
+				const tt now(q.top().exec_time());
+				qbench_net *obj(q.top().object());
+				q.pop();
+				qsize += q.size();
+				if (obj == nullptr)
+				{
+					q.template push<false>(qbench_entry(now + slice, nullptr));
+					continue;
+				}
+				obj->m_queued = false;
+				const std::size_t fanout = 1 + (next_rnd() % 3 == 0 ? 1 : 0);
+				for (std::size_t f = 0; f < fanout; f++)
+				{
+					qbench_net &n(nets[next_rnd() % nets.size()]);
+					if (n.m_queued)
+						q.template remove<false>(&n);
+					n.m_queued = true;
+					q.template push<false>(qbench_entry(now + delays[next_rnd() % 3], &n));
+				}
+			}
+		}
+		app.pout("{1:-8} {2:10.3f} ms {3:8.2f} ns/event, average queue size {4:.1f}\n", name,
+			t.as_seconds<nl_fptype>() * netlist::nlconst::magic(1000.0),
+			t.as_seconds<nl_fptype>() * netlist::nlconst::magic(1e9) / static_cast<nl_fptype>(events),
+			static_cast<nl_fptype>(qsize) / static_cast<nl_fptype>(events));
+	}
+
+} // namespace
+
+void tool_app_t::queuebench()
+{
+	std::vector<qbench_net> nets(std::max(opt_qnets(), 1U));
+	const std::size_t events(opt_qevents());
+
+	qbench_run<plib::timed_queue_linear<qbench_entry, false>>(*this, "linear", nets, events);
+	qbench_run<plib::timed_queue_wheel<qbench_entry, false>>(*this, "wheel", nets, events);
+}
+
 // -------------------------------------------------
 //    convert - convert spice et al to netlist
 // -------------------------------------------------
@@ -1045,6 +1140,8 @@ int tool_app_t::execute()
 			create_docheader();
 		else if (cmd == "convert")
 			convert();
+		else if (cmd == "queuebench")
+			queuebench();
 		else
 		{
 			perr("Unknown command {}\n", cmd.c_str());
@@ -96,7 +96,8 @@ namespace solver
 				if (maxrow != i)
 				{
 					// Swap the maxrow and ith row
-					for (std::size_t k = 0; k < kN; k++) {
+					// Columns left of i are already eliminated and never read again
+					for (std::size_t k = i; k < kN; k++) {
 						std::swap(m_A[i][k], m_A[maxrow][k]);
 					}
 					std::swap(this->m_RHS[i], this->m_RHS[maxrow]);
@@ -12,6 +12,8 @@
 
 #include "bitmap.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <new>
 
 
@@ -26,7 +28,42 @@
 
 inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 {
-	return width + 2 * xslop;
+	if (!m_aligned_rows)
+		return width + 2 * xslop;
+
+	// aligned rows keep at least ROW_ALIGN bytes of readable padding on the right
+	int32_t const align = ROW_ALIGN * 8 / m_bpp;
+	int32_t const right = std::max<int32_t>(xslop, align);
+	return (compute_leftslop(xslop) + width + right + align - 1) & ~(align - 1);
+}
+
+
+//-------------------------------------------------
+//  compute_leftslop - compute the number of pixels
+//  preceding column 0 in each row
+//-------------------------------------------------
+
+inline int32_t bitmap_t::compute_leftslop(int xslop)
+{
+	if (!m_aligned_rows)
+		return xslop;
+
+	// round up so that column 0 lands on a ROW_ALIGN boundary
+	int32_t const align = ROW_ALIGN * 8 / m_bpp;
+	return (xslop + align - 1) & ~(align - 1);
+}
+
+
+//-------------------------------------------------
+//  compute_allocbytes - compute the number of
+//  bytes needed to hold a bitmap
+//-------------------------------------------------
+
+inline uint32_t bitmap_t::compute_allocbytes(int32_t rowpixels, int height, int yslop)
+{
+	// aligned bitmaps need extra space to align the start of the allocation
+	uint32_t const bytes = rowpixels * (height + 2 * yslop) * m_bpp / 8;
+	return m_aligned_rows ? (bytes + ROW_ALIGN) : bytes;
 }
 
 
@@ -37,7 +74,10 @@ inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 
 inline void bitmap_t::compute_base(int xslop, int yslop)
 {
-	m_base = m_alloc.get() + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
+	uint8_t *base = m_alloc.get();
+	if (m_aligned_rows)
+		base += (ROW_ALIGN - (reinterpret_cast<uintptr_t>(base) & (ROW_ALIGN - 1))) & (ROW_ALIGN - 1);
+	m_base = base + (m_rowpixels * yslop + compute_leftslop(xslop)) * (m_bpp / 8);
 }
 
 
@@ -93,6 +133,7 @@ bitmap_t::bitmap_t(bitmap_t &&that)
 	, m_bpp(that.m_bpp)
 	, m_palette(nullptr)
 	, m_cliprect(that.m_cliprect)
+	, m_aligned_rows(that.m_aligned_rows)
 {
 	set_palette(that.m_palette);
 	that.reset();
@@ -119,6 +160,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, int width, int height, int
 	, m_format(format)
 	, m_bpp(bpp)
 	, m_palette(nullptr)
+	, m_aligned_rows(false)
 {
 	assert(valid_format());
 
@@ -150,6 +192,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, void *base, int width, int
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, width - 1, 0, height - 1)
+	, m_aligned_rows(false)
 {
 	assert(valid_format());
 }
@@ -176,6 +219,7 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, bitmap_t &source, const re
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, subrect.width() - 1, 0, subrect.height() - 1)
+	, m_aligned_rows(false)
 {
 	assert(format == source.m_format);
 	assert(bpp == source.m_bpp);
@@ -208,6 +252,7 @@ bitmap_t &bitmap_t::operator=(bitmap_t &&that)
 	m_bpp = that.m_bpp;
 	set_palette(that.m_palette);
 	m_cliprect = that.m_cliprect;
+	m_aligned_rows = that.m_aligned_rows;
 	that.reset();
 	return *this;
 }
@@ -245,7 +290,7 @@ void bitmap_t::allocate(int width, int height, int xslop, int yslop)
 	m_cliprect.set(0, width - 1, 0, height - 1);
 
 	// allocate memory for the bitmap itself
-	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8;
+	m_allocbytes = compute_allocbytes(m_rowpixels, m_height, yslop);
 	m_alloc.reset(new uint8_t[m_allocbytes]);
 
 	// clear to 0 by default
@@ -280,7 +325,7 @@ void bitmap_t::resize(int width, int height, int xslop, int yslop)
 
 	// determine how much memory we need for the new bitmap
 	int new_rowpixels = compute_rowpixels(width, xslop);
-	uint32_t new_allocbytes = new_rowpixels * (height + 2 * yslop) * m_bpp / 8;
+	uint32_t new_allocbytes = compute_allocbytes(new_rowpixels, height, yslop);
 
 	// if we need more memory, just realloc
 	if (new_allocbytes > m_allocbytes)
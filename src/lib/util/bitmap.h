@@ -131,6 +131,9 @@ protected:
 	bitmap_t &operator=(bitmap_t &&that);
 
 public:
+	// row alignment (in bytes) guaranteed by aligned allocations
+	static constexpr int ROW_ALIGN = 64;
+
 	// allocation/deallocation
 	void reset();
 
@@ -144,8 +147,11 @@ public:
 	bool valid() const { return (m_base != nullptr); }
 	palette_t *palette() const { return m_palette; }
 	const rectangle &cliprect() const { return m_cliprect; }
+	bool aligned_rows() const { return m_aligned_rows; }
+	uint32_t allocated_bytes() const { return m_alloc ? m_allocbytes : 0; }
 
 	// allocation/sizing
+	void set_aligned_rows(bool aligned) { m_aligned_rows = aligned; }
 	void allocate(int width, int height, int xslop = 0, int yslop = 0);
 	void resize(int width, int height, int xslop = 0, int yslop = 0);
 
@@ -172,6 +178,8 @@ protected:
 private:
 	// internal helpers
 	int32_t compute_rowpixels(int width, int xslop);
+	int32_t compute_leftslop(int xslop);
+	uint32_t compute_allocbytes(int32_t rowpixels, int height, int yslop);
 	void compute_base(int xslop, int yslop);
 	bool valid_format() const;
 
@@ -186,6 +194,7 @@ private:
 	uint8_t                     m_bpp;          // bits per pixel
 	palette_t *                 m_palette;      // optional palette
 	rectangle                   m_cliprect;     // a clipping rectangle covering the full bitmap
+	bool                        m_aligned_rows; // allocate rows on ROW_ALIGN boundaries with a readable right pad
 };
 
 
@@ -21,6 +21,7 @@
 #include "cdrom.h"
 
 #include <cstdlib>
+#include <mutex>
 #include "chdcd.h"
 
 
@@ -116,6 +117,15 @@ struct cdrom_file
 	chdcd_track_input_info track_info;      /* track info */
 	/** @brief  The fhandle[ CD maximum tracks]. */
 	util::core_file::ptr fhandle[CD_MAX_TRACKS];/* file handle */
+
+	/** @brief  Guards the CHD against the read-ahead work item. */
+	std::mutex          lock;
+	/** @brief  Queue for read-ahead of CHD hunks (CHDs only). */
+	osd_work_queue *    queue = nullptr;
+	/** @brief  The hunk most recently read. */
+	uint32_t            lasthunk = ~0U;
+	/** @brief  The hunk most recently queued for read-ahead. */
+	uint32_t            readahead = ~0U;
 };
 
 
@@ -393,6 +403,9 @@ cdrom_file *cdrom_open(chd_file *chd)
 	file->cdtoc.tracks[i].logframeofs = logofs;
 	file->cdtoc.tracks[i].chdframeofs = chdofs;
 
+	/* sequential reads decompress the next hunk in the background */
+	file->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 	return file;
 }
 
@@ -422,6 +435,12 @@ void cdrom_close(cdrom_file *file)
 		}
 	}
 
+	if (file->queue != nullptr)
+	{
+		osd_work_queue_wait(file->queue, 30 * osd_ticks_per_second());
+		osd_work_queue_free(file->queue);
+	}
+
 	delete file;
 }
 
@@ -431,6 +450,48 @@ void cdrom_close(cdrom_file *file)
     CORE READ ACCESS
 ***************************************************************************/
 
+/**
+ * @fn  static void *readahead_callback(void *param, int threadid)
+ *
+ * @brief   Work item that decompresses the queued read-ahead hunk into the CHD's cache.
+ *
+ * @param [in,out]  param   The cdrom_file.
+ * @param   threadid        The threadid.
+ *
+ * @return  null.
+ */
+
+static void *readahead_callback(void *param, int threadid)
+{
+	cdrom_file *file = (cdrom_file *)param;
+	std::lock_guard<std::mutex> guard(file->lock);
+	file->chd->prefetch_hunk(file->readahead);
+	return nullptr;
+}
+
+/**
+ * @fn  static void queue_readahead(cdrom_file *file, uint32_t hunknum)
+ *
+ * @brief   Queues the hunk after hunknum for read-ahead if reads are sequential; must be
+ *          called with the lock held.
+ *
+ * @param [in,out]  file    If non-null, the file.
+ * @param   hunknum         The hunk just read.
+ */
+
+static void queue_readahead(cdrom_file *file, uint32_t hunknum)
+{
+	bool const sequential = (hunknum == file->lasthunk) || (hunknum == file->lasthunk + 1);
+	file->lasthunk = hunknum;
+	if (!sequential || (file->queue == nullptr) || (file->readahead == hunknum + 1))
+		return;
+	if (hunknum + 1 >= file->chd->hunk_count())
+		return;
+
+	file->readahead = hunknum + 1;
+	osd_work_item_queue(file->queue, readahead_callback, file, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
 /**
  * @fn  chd_error read_partial_sector(cdrom_file *file, void *dest, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t startoffs, uint32_t length)
  *
@@ -466,7 +527,10 @@ chd_error read_partial_sector(cdrom_file *file, void *dest, uint32_t lbasector,
 	// if a CHD, just read
 	if (file->chd != nullptr)
 	{
-		result = file->chd->read_bytes(uint64_t(chdsector) * uint64_t(CD_FRAME_SIZE) + startoffs, dest, length);
+		uint64_t const offset = uint64_t(chdsector) * uint64_t(CD_FRAME_SIZE) + startoffs;
+		std::lock_guard<std::mutex> guard(file->lock);
+		result = file->chd->read_bytes(offset, dest, length);
+		queue_readahead(file, offset / file->chd->hunk_bytes());
 		/* swap CDDA in the case of LE GDROMs */
 		if ((file->cdtoc.flags & CD_FLAG_GDROMLE) && (file->cdtoc.tracks[tracknum].trktype == CD_TRACK_AUDIO))
 			needswap = true;
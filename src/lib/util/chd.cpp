@@ -788,7 +788,7 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 	m_file = &file;
 	m_owns_file = false;
 	m_parent = parent;
-	m_cachehunk = ~0;
+	reset_cache();
 	return open_common(writeable);
 }
 
@@ -844,7 +844,7 @@ void chd_file::close()
 
 	// reset caching
 	m_cache.clear();
-	m_cachehunk = ~0;
+	reset_cache();
 }
 
 /**
@@ -1063,15 +1063,16 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 			// write the map entry back
 			be_write(rawmap, rawentry, 4);
 			file_write(m_mapoffset + hunknum * 4, rawmap, 4);
-
-			// update the cached hunk if we just wrote it
-			if (hunknum == m_cachehunk && buffer != &m_cache[0])
-				memcpy(&m_cache[0], buffer, m_hunkbytes);
 		}
 
 		// otherwise, just overwrite
 		else
 			file_write(uint64_t(rawentry) * uint64_t(m_hunkbytes), buffer, m_hunkbytes);
+
+		// update the cached hunk if we just wrote it
+		uint8_t *const cached = find_cached_hunk(hunknum);
+		if (cached != nullptr && cached != buffer)
+			memcpy(cached, buffer, m_hunkbytes);
 		return CHDERR_NONE;
 	}
 
@@ -1120,6 +1121,30 @@ chd_error chd_file::write_units(uint64_t unitnum, const void *buffer, uint32_t c
 	return write_bytes(unitnum * uint64_t(m_unitbytes), buffer, count * m_unitbytes);
 }
 
+/**
+ * @fn  chd_error chd_file::prefetch_hunk(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            prefetch_hunk - decompress a hunk into the partial read cache ahead of it being
+ *            needed by read_bytes
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::prefetch_hunk(uint32_t hunknum)
+{
+	if (hunknum >= m_hunkcount)
+		return CHDERR_HUNK_OUT_OF_RANGE;
+
+	uint8_t *cached = find_cached_hunk(hunknum);
+	if (cached != nullptr)
+		return CHDERR_NONE;
+	return cache_hunk(hunknum, cached);
+}
+
 /**
  * @fn  chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
  *
@@ -1147,22 +1172,47 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just read directly from disk unless it's the cached hunk
+		// uncompressed full hunks that are laid out back to back in the file can be read in one go
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		uint8_t *cached = find_cached_hunk(curhunk);
+		if (startoffs == 0 && cached == nullptr && m_version == 5 && !compressed() && last_hunk < m_hunkcount)
+		{
+			uint32_t const fullhunks = last_hunk - curhunk + (((offset + bytes) % m_hunkbytes) ? 0 : 1);
+			uint32_t const firstentry = be_read(&m_rawmap[m_mapentrybytes * curhunk], 4);
+			uint32_t runhunks = 0;
+			if (firstentry != 0)
+				while (runhunks < fullhunks && be_read(&m_rawmap[m_mapentrybytes * (curhunk + runhunks)], 4) == firstentry + runhunks && find_cached_hunk(curhunk + runhunks) == nullptr)
+					runhunks++;
+			if (runhunks > 1)
+			{
+				try
+				{
+					file_read(uint64_t(firstentry) * uint64_t(m_hunkbytes), dest, runhunks * m_hunkbytes);
+				}
+				catch (chd_error &readerr)
+				{
+					return readerr;
+				}
+				curhunk += runhunks - 1;
+				dest += runhunks * m_hunkbytes;
+				continue;
+			}
+		}
+
+		// if it's a full block, just read directly from disk unless it's a cached hunk
+		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cached == nullptr)
 			err = read_hunk(curhunk, dest);
 
 		// otherwise, read from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
+			if (cached == nullptr)
 			{
-				err = read_hunk(curhunk, &m_cache[0]);
+				err = cache_hunk(curhunk, cached);
 				if (err != CHDERR_NONE)
 					return err;
-				m_cachehunk = curhunk;
 			}
-			memcpy(dest, &m_cache[startoffs], endoffs + 1 - startoffs);
+			memcpy(dest, &cached[startoffs], endoffs + 1 - startoffs);
 		}
 
 		// handle errors and advance
@@ -1200,23 +1250,23 @@ chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t by
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just write directly to disk unless it's the cached hunk
+		// if it's a full block, just write directly to disk unless it's a cached hunk
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		uint8_t *cached = find_cached_hunk(curhunk);
+		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && cached == nullptr)
 			err = write_hunk(curhunk, source);
 
 		// otherwise, write from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
+			if (cached == nullptr)
 			{
-				err = read_hunk(curhunk, &m_cache[0]);
+				err = cache_hunk(curhunk, cached);
 				if (err != CHDERR_NONE)
 					return err;
-				m_cachehunk = curhunk;
 			}
-			memcpy(&m_cache[startoffs], source, endoffs + 1 - startoffs);
-			err = write_hunk(curhunk, &m_cache[0]);
+			memcpy(&cached[startoffs], source, endoffs + 1 - startoffs);
+			err = write_hunk(curhunk, cached);
 		}
 
 		// handle errors and advance
@@ -2467,7 +2517,83 @@ void chd_file::create_open_common()
 
 	// allocate the temporary compressed buffer and a buffer for caching
 	m_compressed.resize(m_hunkbytes);
-	m_cache.resize(m_hunkbytes);
+	m_cache.resize(CACHE_HUNKS * m_hunkbytes);
+}
+
+/**
+ * @fn  void chd_file::reset_cache()
+ *
+ * @brief   -------------------------------------------------
+ *            reset_cache - mark every hunk cache slot as empty
+ *          -------------------------------------------------.
+ */
+
+void chd_file::reset_cache()
+{
+	for (unsigned slot = 0; slot < CACHE_HUNKS; slot++)
+	{
+		m_cachehunk[slot] = ~0;
+		m_cacheage[slot] = 0;
+	}
+	m_cacheclock = 0;
+}
+
+/**
+ * @fn  uint8_t *chd_file::find_cached_hunk(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            find_cached_hunk - return the cached data for a hunk, or nullptr if it is not in the
+ *            cache
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if it fails, else the cached hunk data.
+ */
+
+uint8_t *chd_file::find_cached_hunk(uint32_t hunknum)
+{
+	for (unsigned slot = 0; slot < CACHE_HUNKS; slot++)
+		if (m_cachehunk[slot] == hunknum)
+		{
+			m_cacheage[slot] = ++m_cacheclock;
+			return &m_cache[slot * m_hunkbytes];
+		}
+	return nullptr;
+}
+
+/**
+ * @fn  chd_error chd_file::cache_hunk(uint32_t hunknum, uint8_t *&data)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_hunk - read a hunk into the least recently used cache slot
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [out] data        Receives the cached hunk data.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::cache_hunk(uint32_t hunknum, uint8_t *&data)
+{
+	// pick the slot that has gone unused the longest
+	unsigned victim = 0;
+	for (unsigned slot = 1; slot < CACHE_HUNKS; slot++)
+		if ((m_cacheclock - m_cacheage[slot]) > (m_cacheclock - m_cacheage[victim]))
+			victim = slot;
+
+	// invalidate it first in case the read fails part way through
+	m_cachehunk[victim] = ~0;
+	uint8_t *const dest = &m_cache[victim * m_hunkbytes];
+	chd_error err = read_hunk(hunknum, dest);
+	if (err != CHDERR_NONE)
+		return err;
+
+	m_cachehunk[victim] = hunknum;
+	m_cacheage[victim] = ++m_cacheclock;
+	data = dest;
+	return CHDERR_NONE;
 }
 
 /**
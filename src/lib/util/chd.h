@@ -315,6 +315,7 @@ public:
 	uint32_t unit_bytes() const { return m_unitbytes; }
 	uint64_t unit_count() const { return m_unitcount; }
 	bool compressed() const { return (m_compression[0] != CHD_CODEC_NONE); }
+	bool writeable() const { return m_allow_writes && !compressed(); }
 	chd_codec_type compression(int index) const { return m_compression[index]; }
 	chd_file *parent() const { return m_parent; }
 	util::sha1_t sha1();
@@ -345,6 +346,7 @@ public:
 	chd_error read_units(uint64_t unitnum, void *buffer, uint32_t count = 1);
 	chd_error write_units(uint64_t unitnum, const void *buffer, uint32_t count = 1);
 	chd_error read_bytes(uint64_t offset, void *buffer, uint32_t bytes);
+	chd_error prefetch_hunk(uint32_t hunknum);
 	chd_error write_bytes(uint64_t offset, const void *buffer, uint32_t bytes);
 
 	// metadata management
@@ -392,6 +394,9 @@ private:
 	chd_error open_common(bool writeable);
 	void create_open_common();
 	void verify_proper_compression_append(uint32_t hunknum);
+	void reset_cache();
+	uint8_t *find_cached_hunk(uint32_t hunknum);
+	chd_error cache_hunk(uint32_t hunknum, uint8_t *&data);
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
@@ -435,8 +440,11 @@ private:
 	std::vector<uint8_t>          m_compressed;       // temporary buffer for compressed data
 
 	// caching
-	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
-	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+	static constexpr unsigned CACHE_HUNKS = 8;    // number of hunks kept for partial reads/writes
+	std::vector<uint8_t>          m_cache;            // hunk cache for partial reads/writes
+	uint32_t                  m_cachehunk[CACHE_HUNKS]; // which hunk is in each cache slot?
+	uint32_t                  m_cacheage[CACHE_HUNKS];  // when each cache slot was last used
+	uint32_t                  m_cacheclock;       // use counter for picking the slot to replace
 };
 
 
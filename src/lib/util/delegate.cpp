@@ -9,6 +9,7 @@
 ***************************************************************************/
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include "delegate.h"
@@ -77,3 +78,46 @@ delegate_generic_function delegate_mfp::convert_to_generic(delegate_generic_clas
 }
 
 #endif
+
+
+
+#if (USE_DELEGATE_TYPE == DELEGATE_TYPE_MSVC)
+
+//-------------------------------------------------
+//  convert_to_generic - apply the "this" delta and
+//  look through virtual call thunks so the delegate
+//  calls the final function directly
+//-------------------------------------------------
+
+delegate_generic_function delegate_mfp::convert_to_generic(delegate_generic_class *&object) const
+{
+	if (m_size == SINGLE_MEMFUNCPTR_SIZE + sizeof(int))
+		object = reinterpret_cast<delegate_generic_class *>(reinterpret_cast<std::uint8_t *>(object) + m_this_delta);
+
+	// skip incremental linking jump stubs
+	std::uint8_t const *func = reinterpret_cast<std::uint8_t const *>(m_function);
+	while (func[0] == 0xe9)
+		func += 5 + *reinterpret_cast<std::int32_t const *>(func + 1);
+
+	// a virtual call thunk loads the vtable with mov rax,[rcx] and jumps through it
+	if ((func[0] != 0x48) || (func[1] != 0x8b) || (func[2] != 0x01) || (func[3] != 0xff))
+		return reinterpret_cast<delegate_generic_function>(func);
+
+	std::ptrdiff_t offset;
+	if (func[4] == 0x20)
+		offset = 0; // jmp qword ptr [rax]
+	else if (func[4] == 0x60)
+		offset = *reinterpret_cast<std::int8_t const *>(func + 5); // jmp qword ptr [rax+disp8]
+	else if (func[4] == 0xa0)
+		offset = *reinterpret_cast<std::int32_t const *>(func + 5); // jmp qword ptr [rax+disp32]
+	else
+		return reinterpret_cast<delegate_generic_function>(func);
+
+	std::uint8_t const *vtable_base = *reinterpret_cast<std::uint8_t const *const *>(object);
+#if defined(LOG_DELEGATES)
+	printf("Calculated Addr = %p (VTAB)\n", reinterpret_cast<void const *>(*reinterpret_cast<delegate_generic_function const *>(vtable_base + offset)));
+#endif
+	return *reinterpret_cast<delegate_generic_function const *>(vtable_base + offset);
+}
+
+#endif
@@ -374,19 +374,15 @@ public:
 	template <typename FunctionType>
 	void update_after_bind(FunctionType &funcptr, delegate_generic_class *&object)
 	{
-		funcptr = reinterpret_cast<FunctionType>(m_function);
-		if (m_size == SINGLE_MEMFUNCPTR_SIZE + sizeof(int))
-			object = reinterpret_cast<delegate_generic_class *>(reinterpret_cast<std::uint8_t *>(object) + m_this_delta);
+		funcptr = reinterpret_cast<FunctionType>(convert_to_generic(object));
 	}
 
 private:
-	// extract the generic function and adjust the object pointer
+	// adjust the object pointer and resolve virtual call thunks to the final function
 	delegate_generic_function convert_to_generic(delegate_generic_class *&object) const;
 
 	// actual state
-	uintptr_t               m_function;         // first item can be one of two things:
-												//    if even, it's a pointer to the function
-												//    if odd, it's the byte offset into the vtable
+	uintptr_t               m_function;         // pointer to the function or to a virtual call thunk
 	int                     m_this_delta;       // delta to apply to the 'this' pointer
 
 	int                     m_dummy1;
@@ -505,7 +501,7 @@ public:
 	// call the function
 	ReturnType operator()(Params... args) const
 	{
-		if (is_mfp() && (HAS_DIFFERENT_ABI))
+		if ((HAS_DIFFERENT_ABI) && is_mfp())
 			return (*reinterpret_cast<generic_member_func>(m_function)) (m_object, std::forward<Params>(args)...);
 		else
 			return (*m_function) (m_object, std::forward<Params>(args)...);
@@ -12,6 +12,21 @@
 #include "harddisk.h"
 #include "osdcore.h"
 #include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+// once this many hunks are waiting to be written, writes are flushed
+// synchronously instead of letting the cache keep growing
+#define MAX_DIRTY_HUNKS     256
+
+
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -22,10 +37,71 @@ struct hard_disk_file
 	chd_file *          chd;                /* CHD file */
 	util::core_file     *fhandle;           /* core_file if not a CHD */
 	hard_disk_info      info;               /* hard disk info */
+
+	// write-back cache for CHDs: sector writes are merged into whole hunks,
+	// which are written by a background work item instead of on the
+	// caller's thread; the lock guards both the cache and the CHD itself
+	std::mutex          lock;
+	std::map<uint32_t, std::unique_ptr<uint8_t []>> dirty;
+	osd_work_queue *    queue = nullptr;
+	bool                writeback = true;   // cleared once the CHD is handed out
+	bool                flush_queued = false;
+	bool                write_failed = false;
 };
 
 
 
+/***************************************************************************
+    WRITE-BACK CACHE
+***************************************************************************/
+
+/*-------------------------------------------------
+    flush_one_hunk - write the lowest dirty hunk;
+    must be called with the lock held
+-------------------------------------------------*/
+
+static bool flush_one_hunk(hard_disk_file *file)
+{
+	auto it = file->dirty.begin();
+	if ((it == file->dirty.end()) || file->write_failed)
+		return false;
+
+	// a hunk that cannot be written stays cached, so reads still return
+	// what the caller wrote, and later writes report the failure
+	if (file->chd->write_hunk(it->first, it->second.get()) != CHDERR_NONE)
+	{
+		file->write_failed = true;
+		return false;
+	}
+	file->dirty.erase(it);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    flush_callback - background work item that
+    writes out the dirty hunks
+-------------------------------------------------*/
+
+static void *flush_callback(void *param, int threadid)
+{
+	hard_disk_file *file = (hard_disk_file *)param;
+
+	// take the lock one hunk at a time so the emulation can keep reading
+	while (true)
+	{
+		std::lock_guard<std::mutex> guard(file->lock);
+		if (!flush_one_hunk(file))
+		{
+			file->flush_queued = false;
+			break;
+		}
+	}
+	return nullptr;
+}
+
+
+
 /***************************************************************************
     CORE IMPLEMENTATION
 ***************************************************************************/
@@ -56,11 +132,12 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 		return nullptr;
 
 	/* allocate memory for the hard disk file */
-	file = (hard_disk_file *)malloc(sizeof(hard_disk_file));
+	file = new (std::nothrow) hard_disk_file;
 	if (file == nullptr)
 		return nullptr;
 
 	/* fill in the data */
+	file->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
 	file->chd = chd;
 	file->fhandle = nullptr;
 	file->info.cylinders = cylinders;
@@ -76,7 +153,7 @@ hard_disk_file *hard_disk_open(util::core_file &corefile, uint32_t skipoffs)
 	hard_disk_file *file;
 
 	/* allocate memory for the hard disk file */
-	file = (hard_disk_file *)malloc(sizeof(hard_disk_file));
+	file = new (std::nothrow) hard_disk_file;
 	if (file == nullptr)
 		return nullptr;
 
@@ -115,12 +192,13 @@ hard_disk_file *hard_disk_open(util::core_file &corefile, uint32_t skipoffs)
 
 void hard_disk_close(hard_disk_file *file)
 {
-	if (file->fhandle)
-	{
-		file->fhandle->flush();
-	}
+	if (!hard_disk_flush(file))
+		osd_printf_error("Hard disk: %u modified hunks could not be written to the CHD\n", unsigned(file->dirty.size()));
+
+	if (file->queue)
+		osd_work_queue_free(file->queue);
 
-	free(file);
+	delete file;
 }
 
 
@@ -131,10 +209,66 @@ void hard_disk_close(hard_disk_file *file)
 
 chd_file *hard_disk_get_chd(hard_disk_file *file)
 {
+	// the caller may use the CHD directly, so it must not be shared with
+	// the background writer; write through from now on
+	if (file->chd)
+	{
+		hard_disk_flush(file);
+		std::lock_guard<std::mutex> guard(file->lock);
+		file->writeback = false;
+	}
 	return file->chd;
 }
 
 
+/*-------------------------------------------------
+    hard_disk_read_metadata - read CHD metadata
+    without giving up the write-back cache
+-------------------------------------------------*/
+
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, std::string &output)
+{
+	if (!file->chd)
+		return CHDERR_NOT_OPEN;
+
+	std::lock_guard<std::mutex> guard(file->lock);
+	return file->chd->read_metadata(searchtag, searchindex, output);
+}
+
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, std::vector<uint8_t> &output)
+{
+	if (!file->chd)
+		return CHDERR_NOT_OPEN;
+
+	std::lock_guard<std::mutex> guard(file->lock);
+	return file->chd->read_metadata(searchtag, searchindex, output);
+}
+
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, void *output, uint32_t outputlen, uint32_t &resultlen)
+{
+	if (!file->chd)
+		return CHDERR_NOT_OPEN;
+
+	std::lock_guard<std::mutex> guard(file->lock);
+	return file->chd->read_metadata(searchtag, searchindex, output, outputlen, resultlen);
+}
+
+
+/*-------------------------------------------------
+    hard_disk_write_metadata - write CHD metadata
+    without giving up the write-back cache
+-------------------------------------------------*/
+
+chd_error hard_disk_write_metadata(hard_disk_file *file, chd_metadata_tag metatag, uint32_t metaindex, const std::string &input, uint8_t flags)
+{
+	if (!file->chd)
+		return CHDERR_NOT_OPEN;
+
+	std::lock_guard<std::mutex> guard(file->lock);
+	return file->chd->write_metadata(metatag, metaindex, input, flags);
+}
+
+
 /*-------------------------------------------------
     hard_disk_get_info - return information about
     a hard disk
@@ -177,6 +311,18 @@ uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 {
 	if (file->chd)
 	{
+		std::lock_guard<std::mutex> guard(file->lock);
+
+		// pending writes take priority over what is in the CHD
+		uint32_t const unitbytes = file->chd->unit_bytes();
+		uint32_t const unitsperhunk = file->chd->hunk_bytes() / unitbytes;
+		auto const it = file->dirty.find(lbasector / unitsperhunk);
+		if (it != file->dirty.end())
+		{
+			memcpy(buffer, &it->second[(lbasector % unitsperhunk) * unitbytes], unitbytes);
+			return 1;
+		}
+
 		chd_error err = file->chd->read_units(lbasector, buffer);
 		return (err == CHDERR_NONE);
 	}
@@ -211,8 +357,44 @@ uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *b
 {
 	if (file->chd)
 	{
-		chd_error err = file->chd->write_units(lbasector, buffer);
-		return (err == CHDERR_NONE);
+		std::unique_lock<std::mutex> guard(file->lock);
+
+		// report what can be known now synchronously, as write-through did
+		if (file->write_failed || !file->chd->writeable())
+			return 0;
+
+		if (!file->writeback)
+			return (file->chd->write_units(lbasector, buffer) == CHDERR_NONE);
+
+		// merge the sector into its cached hunk, reading the hunk in first
+		// if this is the first write to it since it was last flushed
+		uint32_t const unitbytes = file->chd->unit_bytes();
+		uint32_t const unitsperhunk = file->chd->hunk_bytes() / unitbytes;
+		uint32_t const hunknum = lbasector / unitsperhunk;
+		auto it = file->dirty.find(hunknum);
+		if (it == file->dirty.end())
+		{
+			std::unique_ptr<uint8_t []> hunk(new (std::nothrow) uint8_t[file->chd->hunk_bytes()]);
+			if (!hunk || file->chd->read_hunk(hunknum, hunk.get()) != CHDERR_NONE)
+				return 0;
+			it = file->dirty.emplace(hunknum, std::move(hunk)).first;
+		}
+		memcpy(&it->second[(lbasector % unitsperhunk) * unitbytes], buffer, unitbytes);
+
+		if (file->dirty.size() >= MAX_DIRTY_HUNKS || !file->queue)
+		{
+			// the background writer is not keeping up; catch up here
+			while (flush_one_hunk(file)) { }
+			if (file->write_failed)
+				return 0;
+		}
+		else if (!file->flush_queued)
+		{
+			file->flush_queued = true;
+			guard.unlock();
+			osd_work_item_queue(file->queue, flush_callback, file, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+		return 1;
 	}
 	else
 	{
@@ -222,3 +404,27 @@ uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *b
 		return (actual == file->info.sectorbytes);
 	}
 }
+
+
+/*-------------------------------------------------
+    hard_disk_flush - write any cached sectors
+    out to the disk
+-------------------------------------------------*/
+
+uint32_t hard_disk_flush(hard_disk_file *file)
+{
+	if (file->chd)
+	{
+		if (file->queue)
+			osd_work_queue_wait(file->queue, 30 * osd_ticks_per_second());
+
+		std::lock_guard<std::mutex> guard(file->lock);
+		while (flush_one_hunk(file)) { }
+		return !file->write_failed;
+	}
+	else
+	{
+		file->fhandle->flush();
+		return 1;
+	}
+}
@@ -44,9 +44,14 @@ hard_disk_file *hard_disk_open(util::core_file &corefile, uint32_t skipoffs);
 void hard_disk_close(hard_disk_file *file);
 
 chd_file *hard_disk_get_chd(hard_disk_file *file);
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, std::string &output);
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, std::vector<uint8_t> &output);
+chd_error hard_disk_read_metadata(hard_disk_file *file, chd_metadata_tag searchtag, uint32_t searchindex, void *output, uint32_t outputlen, uint32_t &resultlen);
+chd_error hard_disk_write_metadata(hard_disk_file *file, chd_metadata_tag metatag, uint32_t metaindex, const std::string &input, uint8_t flags = CHD_MDFLAGS_CHECKSUM);
 hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 
 uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer);
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer);
+uint32_t hard_disk_flush(hard_disk_file *file);
 
 #endif // MAME_UTIL_HARDDISK_H
@@ -13,6 +13,7 @@
 #include "hash.h"
 #include "hashing.h"
 #include <cctype>
+#include <future>
 
 
 namespace util {
@@ -30,6 +31,9 @@ char const *const hash_collection::HASH_TYPES_ALL = "RS";
 char const hash_collection::FLAG_NO_DUMP;
 char const hash_collection::FLAG_BAD_DUMP;
 
+// buffers at least this large are hashed with one thread per hash type
+static constexpr uint32_t PARALLEL_HASH_THRESHOLD = 1024 * 1024;
+
 
 
 //**************************************************************************
@@ -366,6 +370,15 @@ void hash_collection::buffer(const uint8_t *data, uint32_t length)
 {
 	assert(m_creator != nullptr);
 
+	// for large buffers, compute the CRC alongside the much slower SHA1
+	if (m_creator->m_doing_crc32 && m_creator->m_doing_sha1 && (length >= PARALLEL_HASH_THRESHOLD))
+	{
+		auto crc = std::async(std::launch::async, [this, data, length] () { m_creator->m_crc32_creator.append(data, length); });
+		m_creator->m_sha1_creator.append(data, length);
+		crc.wait();
+		return;
+	}
+
 	// append to each active hash
 	if (m_creator->m_doing_crc32)
 		m_creator->m_crc32_creator.append(data, length);
@@ -915,7 +915,7 @@ static png_error write_chunk(util::core_file &fp, const uint8_t *data, uint32_t
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32_t type, uint32_t length)
+static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32_t type, uint32_t length, int level)
 {
 	uint64_t lengthpos = fp.tell();
 	uint8_t tempbuff[8192];
@@ -937,7 +937,7 @@ static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, level);
 	if (zerr != Z_OK)
 		return PNGERR_COMPRESS_ERROR;
 
@@ -1139,7 +1139,7 @@ static png_error convert_bitmap_to_image_rgb(png_info &pnginfo, const bitmap_t &
     chunks to the given file
 -------------------------------------------------*/
 
-static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, int level)
 {
 	uint8_t tempbuff[16];
 	png_error error;
@@ -1173,7 +1173,7 @@ static png_error write_png_stream(util::core_file &fp, png_info &pnginfo, const
 		return error;
 
 	// write a single IDAT chunk */
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), level);
 	if (error != PNGERR_NONE)
 		return error;
 
@@ -1234,7 +1234,7 @@ png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t const &
 		return PNGERR_FILE_ERROR;
 
 	/* write the rest of the PNG data */
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, Z_DEFAULT_COMPRESSION);
 }
 
 
@@ -1288,7 +1288,8 @@ png_error mng_capture_start(util::core_file &fp, bitmap_t &bitmap, double rate)
 
 png_error mng_capture_frame(util::core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	// frames are captured on the emulation thread, so favour speed over size
+	return write_png_stream(fp, info, bitmap, palette_length, palette, Z_BEST_SPEED);
 }
 
 /**
@@ -31,7 +31,7 @@ namespace {
     CONSTANTS
 ***************************************************************************/
 
-constexpr unsigned TEMP_BUFFER_SIZE(4096U);
+constexpr unsigned TEMP_BUFFER_SIZE(65536U);
 std::locale const f_portable_locale("C");
 
 } // anonymous namespace
@@ -96,14 +96,13 @@ file::ptr file::read(util::core_file &file, parse_options const *opts)
 	/* loop through the file and parse it */
 	do
 	{
-		char tempbuf[TEMP_BUFFER_SIZE];
-
-		/* read as much as we can */
-		int bytes = file.read(tempbuf, sizeof(tempbuf));
+		/* read as much as we can straight into the parser's buffer */
+		void *const tempbuf = XML_GetBuffer(info.parser, TEMP_BUFFER_SIZE);
+		int bytes = tempbuf ? file.read(tempbuf, TEMP_BUFFER_SIZE) : 0;
 		done = file.eof();
 
 		/* parse the data */
-		if (XML_Parse(info.parser, tempbuf, bytes, done) == XML_STATUS_ERROR)
+		if (!tempbuf || (XML_ParseBuffer(info.parser, bytes, done) == XML_STATUS_ERROR))
 		{
 			if (opts != nullptr && opts->error != nullptr)
 			{
@@ -3540,6 +3540,7 @@ void n64_rdp::span_draw_1cycle(int32_t scanline, const extent_t &extent, const r
 
 	const bool partialreject = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_inv_pixel_color && userdata->m_color_inputs.blender1b_a[0] == &userdata->m_pixel_color);
 	const int32_t sel0 = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_memory_color) ? 1 : 0;
+	const bool use_noise = (userdata->m_color_inputs.combiner_rgbsub_a[1] == &userdata->m_noise_color);
 
 	int32_t drinc, dginc, dbinc, dainc;
 	int32_t dzinc, dzpix;
@@ -3634,8 +3635,12 @@ void n64_rdp::span_draw_1cycle(int32_t scanline, const extent_t &extent, const r
 			uint32_t t0a = userdata->m_texel0_color.get_a();
 			userdata->m_texel0_alpha.set(t0a, t0a, t0a, t0a);
 
-			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
+			// noise is only a combiner sub_a RGB input, so only generate it when selected
+			if (use_noise)
+			{
+				const uint8_t noise = machine().rand() << 3; // Not accurate
+				userdata->m_noise_color.set(0, noise, noise, noise);
+			}
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[1]);
 			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[1]);
@@ -3747,6 +3752,7 @@ void n64_rdp::span_draw_2cycle(int32_t scanline, const extent_t &extent, const r
 	bool partialreject = (userdata->m_color_inputs.blender2b_a[1] == &userdata->m_inv_pixel_color && userdata->m_color_inputs.blender1b_a[1] == &userdata->m_pixel_color);
 	int32_t sel0 = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_memory_color) ? 1 : 0;
 	int32_t sel1 = (userdata->m_color_inputs.blender2b_a[1] == &userdata->m_memory_color) ? 1 : 0;
+	const bool use_noise = (userdata->m_color_inputs.combiner_rgbsub_a[0] == &userdata->m_noise_color || userdata->m_color_inputs.combiner_rgbsub_a[1] == &userdata->m_noise_color);
 
 	int32_t drinc, dginc, dbinc, dainc;
 	int32_t dzinc, dzpix;
@@ -3861,8 +3867,12 @@ void n64_rdp::span_draw_2cycle(int32_t scanline, const extent_t &extent, const r
 			userdata->m_texel1_alpha.set(t1a, t1a, t1a, t1a);
 			userdata->m_next_texel_alpha.set(tna, tna, tna, tna);
 
-			const uint8_t noise = machine().rand() << 3; // Not accurate
-			userdata->m_noise_color.set(0, noise, noise, noise);
+			// noise is only a combiner sub_a RGB input, so only generate it when selected
+			if (use_noise)
+			{
+				const uint8_t noise = machine().rand() << 3; // Not accurate
+				userdata->m_noise_color.set(0, noise, noise, noise);
+			}
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[0]);
 			rgbaint_t rgbsub_b(*userdata->m_color_inputs.combiner_rgbsub_b[0]);
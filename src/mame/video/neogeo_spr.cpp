@@ -414,23 +414,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 			/* draw the line - no wrap-around */
 			if (x <= 0x01f0)
 			{
-				uint32_t *pixel_addr = &bitmap.pix32(scanline, x + NEOGEO_HBEND);
-
-				for (int i = 0; i < 0x10; i++)
-				{
-					if (zoom_x_table & 0x8000)
-					{
-						draw_pixel(gfx_base, pixel_addr, line_pens);
-
-						pixel_addr++;
-					}
-
-					zoom_x_table <<= 1;
-					if (zoom_x_table == 0)
-						break;
-
-					gfx_base += x_inc;
-				}
+				draw_sprite_line(gfx_base, x_inc, zoom_x_table, &bitmap.pix32(scanline, x + NEOGEO_HBEND), line_pens);
 			}
 			/* wrap-around */
 			else
@@ -465,6 +449,31 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 }
 
 
+// draws one zoomed 16-pixel sprite row, calling the derived class's
+// draw_pixel directly rather than through the vtable for every pixel
+template <typename T>
+inline void neosprite_base_device::draw_sprite_line_common(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens)
+{
+	T &self = downcast<T &>(*this);
+
+	for (int i = 0; i < 0x10; i++)
+	{
+		if (zoom_x_table & 0x8000)
+		{
+			self.T::draw_pixel(gfx_base, pixel_addr, line_pens);
+
+			pixel_addr++;
+		}
+
+		zoom_x_table <<= 1;
+		if (zoom_x_table == 0)
+			break;
+
+		gfx_base += x_inc;
+	}
+}
+
+
 void neosprite_base_device::parse_sprites(int scanline)
 {
 	uint16_t sprite_number;
@@ -652,6 +661,11 @@ inline void neosprite_regular_device::draw_pixel(int romaddr, uint32_t* dst, con
 		*dst = line_pens[gfx];
 }
 
+void neosprite_regular_device::draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens)
+{
+	draw_sprite_line_common<neosprite_regular_device>(gfx_base, x_inc, zoom_x_table, pixel_addr, line_pens);
+}
+
 
 
 /*********************************************************************************************************************************/
@@ -729,6 +743,11 @@ inline void neosprite_optimized_device::draw_pixel(int romaddr, uint32_t* dst, c
 		*dst = line_pens[gfx];
 }
 
+void neosprite_optimized_device::draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens)
+{
+	draw_sprite_line_common<neosprite_optimized_device>(gfx_base, x_inc, zoom_x_table, pixel_addr, line_pens);
+}
+
 
 /*********************************************************************************************************************************/
 /* MIDAS specific sprite handling                                                                                                */
@@ -765,6 +784,11 @@ inline void neosprite_midas_device::draw_pixel(int romaddr, uint32_t* dst, const
 		*dst = line_pens[gfx];
 }
 
+void neosprite_midas_device::draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens)
+{
+	draw_sprite_line_common<neosprite_midas_device>(gfx_base, x_inc, zoom_x_table, pixel_addr, line_pens);
+}
+
 
 void neosprite_midas_device::device_start()
 {
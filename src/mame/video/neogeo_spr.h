@@ -42,6 +42,7 @@ public:
 	void neogeo_set_fixed_layer_source(uint8_t data);
 	inline bool sprite_on_scanline(int scanline, int y, int rows);
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) = 0;
+	virtual void draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens) = 0;
 	void draw_sprites(bitmap_rgb32 &bitmap, int scanline);
 	void parse_sprites(int scanline);
 	void create_sprite_line_timer();
@@ -86,6 +87,7 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	uint32_t get_region_mask(uint8_t* rgn, uint32_t rgn_size);
+	template <typename T> void draw_sprite_line_common(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens);
 	uint8_t* m_region_sprites; uint32_t m_region_sprites_size;
 	uint8_t* m_region_fixed; uint32_t m_region_fixed_size;
 	memory_region* m_region_fixedbios;
@@ -100,6 +102,7 @@ class neosprite_regular_device : public neosprite_base_device
 public:
 	neosprite_regular_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens) override;
 	virtual void set_sprite_region(uint8_t* region_sprites, uint32_t region_sprites_size) override;
 
 };
@@ -114,6 +117,7 @@ public:
 	virtual void optimize_sprite_data() override;
 	virtual void set_optimized_sprite_data(uint8_t* sprdata, uint32_t mask) override;
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens) override;
 	std::vector<uint8_t> m_sprite_gfx;
 	uint8_t* m_spritegfx8;
 
@@ -130,6 +134,7 @@ public:
 	neosprite_midas_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprite_line(int gfx_base, int x_inc, uint16_t zoom_x_table, uint32_t *pixel_addr, const pen_t *line_pens) override;
 
 	std::unique_ptr<uint16_t[]> m_videoram_buffer;
 	void buffer_vram();
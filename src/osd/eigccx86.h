@@ -504,6 +504,10 @@ _mulu_64x64(uint64_t a, uint64_t b, uint64_t *hi)
 inline uint8_t ATTR_CONST ATTR_FORCE_INLINE
 _count_leading_zeros(uint32_t value)
 {
+#if defined(__LZCNT__)
+	// LZCNT is defined for zero input, so this compiles to one instruction
+	return value ? __builtin_clz(value) : 32U;
+#else
 	uint32_t result;
 	__asm__ (
 		" bsrl    %[value], %[result] ;"
@@ -514,6 +518,7 @@ _count_leading_zeros(uint32_t value)
 		: "cc"                          // clobbers condition codes
 	);
 	return 31U - result;
+#endif
 }
 
 
@@ -526,6 +531,9 @@ _count_leading_zeros(uint32_t value)
 inline uint8_t ATTR_CONST ATTR_FORCE_INLINE
 _count_leading_ones(uint32_t value)
 {
+#if defined(__LZCNT__)
+	return ~value ? __builtin_clz(~value) : 32U;
+#else
 	uint32_t result;
 	__asm__ (
 		" bsrl    %[value], %[result] ;"
@@ -536,6 +544,7 @@ _count_leading_ones(uint32_t value)
 		: "cc"                          // clobbers condition codes
 	);
 	return 31U - result;
+#endif
 }
 
 #endif // MAME_OSD_EIGCCX86_H
@@ -268,6 +268,12 @@ inline float recip_approx(float value)
 #ifndef mul_64x64
 inline int64_t mul_64x64(int64_t a, int64_t b, int64_t *hi)
 {
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+	// single widening multiply on 64-bit targets (e.g. SMULH on ARMv8)
+	__int128 const r(__int128(a) * b);
+	*hi = int64_t(uint64_t((unsigned __int128)r >> 64));
+	return int64_t(uint64_t((unsigned __int128)r));
+#else
 	uint64_t const a_hi = uint64_t(a) >> 32;
 	uint64_t const b_hi = uint64_t(b) >> 32;
 	uint64_t const a_lo = uint32_t(uint64_t(a));
@@ -288,6 +294,7 @@ inline int64_t mul_64x64(int64_t a, int64_t b, int64_t *hi)
 		*hi -= a;
 
 	return ab_lo + (ab_m1 << 32) + (ab_m2 << 32);
+#endif
 }
 #endif
 
@@ -300,6 +307,12 @@ inline int64_t mul_64x64(int64_t a, int64_t b, int64_t *hi)
 #ifndef mulu_64x64
 inline uint64_t mulu_64x64(uint64_t a, uint64_t b, uint64_t *hi)
 {
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+	// single widening multiply on 64-bit targets (e.g. UMULH on ARMv8)
+	unsigned __int128 const r((unsigned __int128)a * b);
+	*hi = uint64_t(r >> 64);
+	return uint64_t(r);
+#else
 	uint64_t const a_hi = uint32_t(a >> 32);
 	uint64_t const b_hi = uint32_t(b >> 32);
 	uint64_t const a_lo = uint32_t(a);
@@ -314,6 +327,7 @@ inline uint64_t mulu_64x64(uint64_t a, uint64_t b, uint64_t *hi)
 	*hi = ab_hi + (ab_m1 >> 32) + (ab_m2 >> 32) + carry;
 
 	return ab_lo + (ab_m1 << 32) + (ab_m2 << 32);
+#endif
 }
 #endif
 
@@ -332,9 +346,15 @@ inline uint64_t mulu_64x64(uint64_t a, uint64_t b, uint64_t *hi)
 inline uint8_t count_leading_zeros(uint32_t val)
 {
 	if (!val) return 32U;
+#if defined(__GNUC__)
+	// uses CPU feature if available (e.g. CLZ on ARM), otherwise falls back to a bit scan
+	static_assert(sizeof(val) == sizeof(unsigned), "expected 32-bit unsigned int");
+	return uint8_t(__builtin_clz(static_cast<unsigned>(val)));
+#else
 	uint8_t count;
 	for (count = 0; int32_t(val) >= 0; count++) val <<= 1;
 	return count;
+#endif
 }
 #endif
 
@@ -347,9 +367,15 @@ inline uint8_t count_leading_zeros(uint32_t val)
 #ifndef count_leading_ones
 inline uint8_t count_leading_ones(uint32_t val)
 {
+#if defined(__GNUC__)
+	if (!~val) return 32U;
+	static_assert(sizeof(val) == sizeof(unsigned), "expected 32-bit unsigned int");
+	return uint8_t(__builtin_clz(static_cast<unsigned>(~val)));
+#else
 	uint8_t count;
 	for (count = 0; int32_t(val) < 0; count++) val <<= 1;
 	return count;
+#endif
 }
 #endif
 
@@ -374,6 +374,7 @@ public:
 	cmd_reply handle_P(const char *buf);
 	cmd_reply handle_q(const char *buf);
 	cmd_reply handle_s(const char *buf);
+	cmd_reply handle_X(const char *buf);
 	cmd_reply handle_z(const char *buf);
 	cmd_reply handle_Z(const char *buf);
 
@@ -388,11 +389,17 @@ public:
 	readbuf_state m_readbuf_state;
 
 	void generate_target_xml();
+	void generate_memory_map_xml();
+
+	void read_memory_block(offs_t offset, uint8_t *data, size_t length);
+	void write_memory_block(offs_t offset, const uint8_t *data, size_t length);
 
 	int readchar();
 
 	void send_reply(const char *str);
+	void send_xfer_reply(const std::string &document, int offset, int length);
 	void send_stop_packet();
+	void flush_output();
 
 private:
 	running_machine *m_machine;
@@ -430,11 +437,14 @@ private:
 	device_debug::watchpoint *m_triggered_watchpoint;
 
 	std::string m_target_xml;
+	std::string m_memory_map_xml;
 
 	uint8_t  m_readbuf[512];
 	uint32_t m_readbuf_len;
 	uint32_t m_readbuf_offset;
 
+	std::string m_writebuf;     // replies are batched and sent once all pending input is handled
+
 	uint8_t m_packet_buf[MAX_PACKET_SIZE+1];
 	int     m_packet_len;
 	uint8_t m_packet_checksum;
@@ -514,6 +524,128 @@ void debug_gdbstub::generate_target_xml()
 	m_target_xml = escape_packet(target_xml);
 }
 
+//-------------------------------------------------------------------------
+void debug_gdbstub::generate_memory_map_xml()
+{
+	// Describe the whole logical address space as RAM so that clients
+	// which honour the memory map do not refuse any access.
+	uint64_t length = uint64_t(m_address_space->logaddrmask()) + 1;
+	std::string memory_map_xml;
+	memory_map_xml += "<?xml version=\"1.0\"?>\n";
+	memory_map_xml += "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" \"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n";
+	memory_map_xml += "<memory-map>\n";
+	memory_map_xml += string_format("  <memory type=\"ram\" start=\"0x0\" length=\"0x%" PRIx64 "\"/>\n", length);
+	memory_map_xml += "</memory-map>\n";
+	m_memory_map_xml = escape_packet(memory_map_xml);
+}
+
+//-------------------------------------------------------------------------
+// Convert between address space units in host order and bytes in target
+// memory order, which is what GDB sends and expects.
+template <typename T>
+static void units_to_bytes(const T *units, uint8_t *data, size_t count, bool is_be)
+{
+	for ( size_t unit = 0; unit < count; unit++ )
+		for ( size_t i = 0; i < sizeof(T); i++ )
+			*data++ = units[unit] >> (8 * (is_be ? (sizeof(T) - 1 - i) : i));
+}
+
+template <typename T>
+static void bytes_to_units(const uint8_t *data, T *units, size_t count, bool is_be)
+{
+	for ( size_t unit = 0; unit < count; unit++ )
+	{
+		T value = 0;
+		for ( size_t i = 0; i < sizeof(T); i++ )
+			value |= T(*data++) << (8 * (is_be ? (sizeof(T) - 1 - i) : i));
+		units[unit] = value;
+	}
+}
+
+//-------------------------------------------------------------------------
+// Read a block of memory, with the aligned part going through the address
+// space's block accessor instead of read_byte() for every byte.
+void debug_gdbstub::read_memory_block(offs_t offset, uint8_t *data, size_t length)
+{
+	address_space &space = *m_address_space;
+	const int width = (space.addr_shift() == 0) ? space.data_width() / 8 : 1;
+	const bool is_be = space.endianness() == ENDIANNESS_BIG;
+
+	// unaligned head
+	while ( length > 0 && (offset & (width - 1)) != 0 )
+	{
+		*data++ = space.read_byte(offset++);
+		length--;
+	}
+
+	// aligned middle; block accesses transfer whole data bus units, which
+	// don't correspond to bytes on word-addressed spaces
+	const size_t count = (space.addr_shift() == 0) ? length / width : 0;
+	if ( count > 0 )
+	{
+		std::vector<uint64_t> units((count * width + 7) / 8);
+		space.read_block(offset, units.data(), count);
+		switch ( width )
+		{
+		case 1: std::copy_n(reinterpret_cast<const uint8_t *>(units.data()), count, data); break;
+		case 2: units_to_bytes(reinterpret_cast<const uint16_t *>(units.data()), data, count, is_be); break;
+		case 4: units_to_bytes(reinterpret_cast<const uint32_t *>(units.data()), data, count, is_be); break;
+		case 8: units_to_bytes(units.data(), data, count, is_be); break;
+		}
+		offset += count * width;
+		data += count * width;
+		length -= count * width;
+	}
+
+	// tail
+	while ( length > 0 )
+	{
+		*data++ = space.read_byte(offset++);
+		length--;
+	}
+}
+
+//-------------------------------------------------------------------------
+void debug_gdbstub::write_memory_block(offs_t offset, const uint8_t *data, size_t length)
+{
+	address_space &space = *m_address_space;
+	const int width = (space.addr_shift() == 0) ? space.data_width() / 8 : 1;
+	const bool is_be = space.endianness() == ENDIANNESS_BIG;
+
+	// unaligned head
+	while ( length > 0 && (offset & (width - 1)) != 0 )
+	{
+		space.write_byte(offset++, *data++);
+		length--;
+	}
+
+	// aligned middle; block accesses transfer whole data bus units, which
+	// don't correspond to bytes on word-addressed spaces
+	const size_t count = (space.addr_shift() == 0) ? length / width : 0;
+	if ( count > 0 )
+	{
+		std::vector<uint64_t> units((count * width + 7) / 8);
+		switch ( width )
+		{
+		case 1: std::copy_n(data, count, reinterpret_cast<uint8_t *>(units.data())); break;
+		case 2: bytes_to_units(data, reinterpret_cast<uint16_t *>(units.data()), count, is_be); break;
+		case 4: bytes_to_units(data, reinterpret_cast<uint32_t *>(units.data()), count, is_be); break;
+		case 8: bytes_to_units(data, units.data(), count, is_be); break;
+		}
+		space.write_block(offset, units.data(), count);
+		offset += count * width;
+		data += count * width;
+		length -= count * width;
+	}
+
+	// tail
+	while ( length > 0 )
+	{
+		space.write_byte(offset++, *data++);
+		length--;
+	}
+}
+
 //-------------------------------------------------------------------------
 void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 {
@@ -611,6 +743,10 @@ void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 		int ch = readchar();
 		if ( ch < 0 )
 		{
+			// All pending input has been handled, so send the batched
+			// replies before waiting for more.
+			flush_output();
+
 			// TODO add support for timeout in *_osd_socket.
 			// To prevent 100% cpu usage while waiting for data to
 			// arrive from the socket, we sleep for 1 millisecond.
@@ -619,6 +755,7 @@ void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 		}
 		handle_character((char) ch);
 	}
+	flush_output();
 }
 
 //-------------------------------------------------------------------------
@@ -631,18 +768,19 @@ void debug_gdbstub::debugger_update()
 			break;
 		handle_character((char) ch);
 	}
+	flush_output();
 }
 
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_nack()
 {
-	m_socket.puts("-");
+	m_writebuf += '-';
 }
 
 //-------------------------------------------------------------------------
 void debug_gdbstub::send_ack()
 {
-	m_socket.puts("+");
+	m_writebuf += '+';
 }
 
 //-------------------------------------------------------------------------
@@ -654,8 +792,39 @@ void debug_gdbstub::send_reply(const char *str)
 	for ( size_t i = 0; i < length; i++ )
 		checksum += str[i];
 
-	std::string reply = string_format("$%s#%02x", str, checksum);
-	m_socket.puts(reply.c_str());
+	m_writebuf.reserve(m_writebuf.length() + length + 4);
+	m_writebuf += '$';
+	m_writebuf.append(str, length);
+	m_writebuf += string_format("#%02x", checksum);
+}
+
+//-------------------------------------------------------------------------
+// Send one chunk of a qXfer object, as requested by offset and length.
+void debug_gdbstub::send_xfer_reply(const std::string &document, int offset, int length)
+{
+	if ( offset >= document.length() )
+	{
+		send_reply("l");
+		return;
+	}
+	length = std::min(length, (int) document.length()-offset);
+	std::string reply;
+	if ( offset + length < document.length() )
+		reply += 'm';
+	else
+		reply += 'l';
+	reply += document.substr(offset, length);
+	send_reply(reply.c_str());
+}
+
+//-------------------------------------------------------------------------
+void debug_gdbstub::flush_output()
+{
+	if ( m_writebuf.empty() )
+		return;
+	if ( m_socket.is_open() )
+		m_socket.write(m_writebuf.data(), m_writebuf.length());
+	m_writebuf.clear();
 }
 
 
@@ -711,6 +880,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_g(const char *buf)
 	if ( *buf != '\0' )
 		return REPLY_UNSUPPORTED;
 	std::string reply;
+	reply.reserve(m_gdb_registers.size() * 16);
 	for ( const auto &reg: m_gdb_registers )
 		reply += get_register_string(reg.gdb_regnum);
 	send_reply(reply.c_str());
@@ -754,10 +924,14 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_k(const char *buf)
 	m_machine->schedule_exit();
 	m_debugger_cpu->get_visible_cpu()->debug()->go();
 	m_dettached = true;
+	flush_output();
 	m_socket.close();
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+static const char hex_digits[] = "0123456789abcdef";
+
 //-------------------------------------------------------------------------
 // Read memory.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
@@ -774,18 +948,33 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
 	// Disable side effects while reading memory.
 	auto dis = m_machine->disable_side_effects();
 
+	std::vector<uint8_t> data(length);
+	read_memory_block(offset, data.data(), length);
+
 	std::string reply;
-	reply.reserve(length * 2);
+	reply.resize(length * 2);
 	for ( int i = 0; i < length; i++ )
 	{
-		uint8_t value = m_address_space->read_byte(offset + i);
-		reply += string_format("%02x", value);
+		reply[i*2+0] = hex_digits[data[i] >> 4];
+		reply[i*2+1] = hex_digits[data[i] & 0x0f];
 	}
 	send_reply(reply.c_str());
 
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+static int hex_nibble(char ch)
+{
+	if ( ch >= '0' && ch <= '9' )
+		return ch - '0';
+	if ( ch >= 'a' && ch <= 'f' )
+		return ch - 'a' + 10;
+	if ( ch >= 'A' && ch <= 'F' )
+		return ch - 'A' + 10;
+	return -1;
+}
+
 //-------------------------------------------------------------------------
 static bool hex_decode(std::vector<uint8_t> *_data, const char *buf, size_t length)
 {
@@ -793,8 +982,11 @@ static bool hex_decode(std::vector<uint8_t> *_data, const char *buf, size_t leng
 	data.resize(length);
 	for ( int i = 0; i < length; i++ )
 	{
-		if ( sscanf(buf, "%02hhx", &data[i]) != 1 )
+		int hi = hex_nibble(buf[0]);
+		int lo = (hi < 0) ? -1 : hex_nibble(buf[1]);
+		if ( lo < 0 )
 			return false;
+		data[i] = (hi << 4) | lo;
 		buf += 2;
 	}
 	if ( *buf != '\0' )
@@ -820,8 +1012,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_M(const char *buf)
 	if ( !hex_decode(&data, buf + buf_offset, length) )
 		return REPLY_ENN;
 
-	for ( int i = 0; i < length; i++ )
-		m_address_space->write_byte(offset + i, data[i]);
+	write_memory_block(offset, data.data(), length);
 
 	return REPLY_OK;
 }
@@ -920,6 +1111,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	{
 		std::string reply = string_format("PacketSize=%x", MAX_PACKET_SIZE);
 		reply += ";qXfer:features:read+";
+		reply += ";qXfer:memory-map:read+";
 		send_reply(reply.c_str());
 		return REPLY_NONE;
 	}
@@ -934,18 +1126,24 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 			{
 				if ( m_target_xml.empty() )
 					generate_target_xml();
-				length = std::min(length, (int) m_target_xml.length()-offset);
-				std::string reply;
-				if ( offset + length < m_target_xml.length() )
-					reply += 'm';
-				else
-					reply += 'l';
-				reply += m_target_xml.substr(offset, length);
-				send_reply(reply.c_str());
+				send_xfer_reply(m_target_xml, offset, length);
 				m_target_xml_sent = true;
 				return REPLY_NONE;
 			}
 		}
+		// "memory-map:read::0,3fff"
+		else if ( strncmp(params.c_str(), "memory-map:read::", 17) == 0 )
+		{
+			int offset = 0;
+			int length = 0;
+			if ( sscanf(params.c_str() + 17, "%x,%x", &offset, &length) == 2 )
+			{
+				if ( m_memory_map_xml.empty() )
+					generate_memory_map_xml();
+				send_xfer_reply(m_memory_map_xml, offset, length);
+				return REPLY_NONE;
+			}
+		}
 	}
 	else if ( name == "fThreadInfo" )
 	{
@@ -974,6 +1172,49 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_s(const char *buf)
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+// Write memory (binary data).
+debug_gdbstub::cmd_reply debug_gdbstub::handle_X(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	int buf_offset;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64 ":%n", &address, &length, &buf_offset) != 2 )
+		return REPLY_ENN;
+
+	// The payload may contain NUL bytes, so use the packet length
+	// instead of treating it as a string.
+	const char *ptr = buf + buf_offset;
+	const char *end = (const char *) m_packet_buf + m_packet_len;
+	std::vector<uint8_t> data;
+	data.reserve(length);
+	while ( ptr < end )
+	{
+		uint8_t ch = *ptr++;
+		if ( ch == '}' )
+		{
+			if ( ptr == end )
+				return REPLY_ENN;
+			ch = *ptr++ ^ 0x20;
+		}
+		data.push_back(ch);
+	}
+	if ( data.size() != length )
+		return REPLY_ENN;
+
+	// GDB probes for binary download support with a zero-length write.
+	if ( length == 0 )
+		return REPLY_OK;
+
+	offs_t offset = address;
+	if ( !m_memory->translate(m_address_space->spacenum(), TRANSLATE_READ_DEBUG, offset) )
+		return REPLY_ENN;
+
+	write_memory_block(offset, data.data(), length);
+
+	return REPLY_OK;
+}
+
 //-------------------------------------------------------------------------
 static bool remove_breakpoint(device_debug *debug, uint64_t address, int /*kind*/)
 {
@@ -1144,6 +1385,7 @@ void debug_gdbstub::handle_packet()
 		case 'P': reply = handle_P(buf); break;
 		case 'q': reply = handle_q(buf); break;
 		case 's': reply = handle_s(buf); break;
+		case 'X': reply = handle_X(buf); break;
 		case 'z': reply = handle_z(buf); break;
 		case 'Z': reply = handle_Z(buf); break;
 	}
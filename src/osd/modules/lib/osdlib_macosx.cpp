@@ -197,6 +197,26 @@ int osd_getpid(void)
 	return getpid();
 }
 
+//============================================================
+//  osd_get_processor_topology
+//============================================================
+
+std::vector<osd_processor_info> osd_get_processor_topology()
+{
+	// not supported
+	return std::vector<osd_processor_info>();
+}
+
+//============================================================
+//  osd_set_thread_affinity
+//============================================================
+
+bool osd_set_thread_affinity(int logical)
+{
+	// not supported
+	return false;
+}
+
 //============================================================
 //  dynamic_module_posix_impl
 //============================================================
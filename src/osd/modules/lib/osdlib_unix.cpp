@@ -16,8 +16,16 @@
 #include <dlfcn.h>
 
 #include <cstdio>
+#include <fstream>
 #include <iomanip>
 #include <memory>
+#include <set>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 
 // MAME headers
@@ -133,6 +141,102 @@ int osd_getpid(void)
 	return getpid();
 }
 
+//============================================================
+//  osd_get_processor_topology
+//============================================================
+
+#if defined(__linux__)
+static int read_sysfs_int(const std::string &path, int fallback)
+{
+	std::ifstream file(path);
+	int value;
+	if (file >> value)
+		return value;
+	return fallback;
+}
+
+// parse a list like "0-3,8-11" as used by sysfs
+static std::set<int> read_sysfs_list(const std::string &path)
+{
+	std::set<int> result;
+	std::ifstream file(path);
+	std::string list;
+	if (!std::getline(file, list))
+		return result;
+
+	size_t pos = 0;
+	while (pos < list.size())
+	{
+		size_t end = list.find(',', pos);
+		if (end == std::string::npos)
+			end = list.size();
+		int first, last;
+		const std::string range = list.substr(pos, end - pos);
+		if (sscanf(range.c_str(), "%d-%d", &first, &last) == 2)
+			for (int i = first; i <= last; i++)
+				result.insert(i);
+		else if (sscanf(range.c_str(), "%d", &first) == 1)
+			result.insert(first);
+		pos = end + 1;
+	}
+	return result;
+}
+#endif
+
+std::vector<osd_processor_info> osd_get_processor_topology()
+{
+	std::vector<osd_processor_info> result;
+#if defined(__linux__)
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+		return result;
+
+	// build a map of processor to NUMA node; machines without NUMA have no node directory
+	std::vector<int> nodes(CPU_SETSIZE, 0);
+	for (int node = 0; node < 1024; node++)
+	{
+		const std::set<int> cpus = read_sysfs_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+		if (cpus.empty() && node > 0)
+			break;
+		for (int cpu : cpus)
+			if (cpu < CPU_SETSIZE)
+				nodes[cpu] = node;
+	}
+
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+	{
+		if (!CPU_ISSET(cpu, &allowed))
+			continue;
+
+		// SMT siblings share a core ID within a package
+		const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+		const int package = read_sysfs_int(base + "physical_package_id", 0);
+		const int core = read_sysfs_int(base + "core_id", cpu);
+		result.push_back(osd_processor_info{ cpu, (package << 16) | core, nodes[cpu] });
+	}
+#endif
+	return result;
+}
+
+//============================================================
+//  osd_set_thread_affinity
+//============================================================
+
+bool osd_set_thread_affinity(int logical)
+{
+#if defined(__linux__)
+	if (logical < 0 || logical >= CPU_SETSIZE)
+		return false;
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(logical, &cpus);
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+	return false;
+#endif
+}
+
 //============================================================
 //  dynamic_module_posix_impl
 //============================================================
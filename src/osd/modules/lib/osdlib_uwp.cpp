@@ -188,3 +188,23 @@ int osd_getpid(void)
 	return GetCurrentProcessId();
 }
 
+//============================================================
+//  osd_get_processor_topology
+//============================================================
+
+std::vector<osd_processor_info> osd_get_processor_topology()
+{
+	// not supported
+	return std::vector<osd_processor_info>();
+}
+
+//============================================================
+//  osd_set_thread_affinity
+//============================================================
+
+bool osd_set_thread_affinity(int logical)
+{
+	// not supported
+	return false;
+}
+
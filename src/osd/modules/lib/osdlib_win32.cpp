@@ -215,6 +215,61 @@ int osd_getpid()
 	return GetCurrentProcessId();
 }
 
+//============================================================
+//  osd_get_processor_topology
+//============================================================
+
+std::vector<osd_processor_info> osd_get_processor_topology()
+{
+	std::vector<osd_processor_info> result;
+
+	// find out how much space we need for the processor information
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+	if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+		return result;
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	if (!GetLogicalProcessorInformation(&info[0], &length))
+		return result;
+
+	DWORD_PTR process_mask, system_mask;
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+		return result;
+
+	// first pass for NUMA nodes, second pass for cores
+	std::vector<int> nodes(sizeof(DWORD_PTR) * 8, 0);
+	for (auto const &entry : info)
+		if (entry.Relationship == RelationNumaNode)
+			for (int cpu = 0; cpu < int(nodes.size()); cpu++)
+				if (entry.ProcessorMask & (DWORD_PTR(1) << cpu))
+					nodes[cpu] = entry.NumaNode.NodeNumber;
+
+	int core = 0;
+	for (auto const &entry : info)
+	{
+		if (entry.Relationship != RelationProcessorCore)
+			continue;
+
+		// every logical processor in the mask is an SMT sibling on this core
+		for (int cpu = 0; cpu < int(nodes.size()); cpu++)
+			if ((entry.ProcessorMask & process_mask) & (DWORD_PTR(1) << cpu))
+				result.push_back(osd_processor_info{ cpu, core, nodes[cpu] });
+		core++;
+	}
+	return result;
+}
+
+//============================================================
+//  osd_set_thread_affinity
+//============================================================
+
+bool osd_set_thread_affinity(int logical)
+{
+	if (logical < 0 || logical >= int(sizeof(DWORD_PTR) * 8))
+		return false;
+	return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << logical) != 0;
+}
+
 //============================================================
 //  osd_dynamic_bind
 //============================================================
@@ -19,6 +19,9 @@
 #define ASIO_HAS_EPOLL
 #endif
 
+#include <deque>
+#include <future>
+#include <mutex>
 #include <thread>
 #include <set>
 #include "asio.h"
@@ -49,16 +52,19 @@ public:
 	m_machine = &machine;
 	m_clients->insert(shared_from_this());
 	// now send "mame_start = rom" to the newly connected client
-	std::snprintf(m_data, max_length, "mame_start = %s\r", machine.system().name);
-	do_write(std::strlen(m_data));
+	std::string msg = util::string_format("mame_start = %s\r", machine.system().name);
+	deliver(msg);
 	do_read();
   }
 
 private:
   void deliver(std::string &msg)
   {
-	std::strncpy(m_data, msg.c_str(), max_length);
-	do_write(msg.size());
+	// queue the message; only one write may be outstanding on the socket
+	bool const idle = m_write_queue.empty();
+	m_write_queue.push_back(msg);
+	if (idle)
+		do_write();
   }
 
   void handle_message(char *msg)
@@ -125,16 +131,22 @@ private:
 		});
   }
 
-  void do_write(std::size_t length)
+  void do_write()
   {
 	auto self(shared_from_this());
-		asio::async_write(m_socket, asio::buffer(m_data, length),
+		asio::async_write(m_socket, asio::buffer(m_write_queue.front()),
 		[this, self](std::error_code ec, std::size_t /*length*/)
 		{
 		  if (ec)
 		  {
 			m_clients->erase(shared_from_this());
 		  }
+		  else
+		  {
+			m_write_queue.pop_front();
+			if (!m_write_queue.empty())
+			  do_write();
+		  }
 		});
   }
 
@@ -142,7 +154,7 @@ private:
 
   asio::ip::tcp::socket m_socket;
   enum { max_length = 1024 };
-  char m_data[max_length];
+  std::deque<std::string> m_write_queue;
   char m_input_m_data[max_length];
   client_set *m_clients;
   running_machine *m_machine;
@@ -207,8 +219,12 @@ public:
 
 	virtual void exit() override
 	{
-		// tell clients MAME is shutting down
+		// tell clients MAME is shutting down, and make sure the network
+		// thread has handed the batch to the sockets before stopping it
 		notify("mame_stop", 1);
+		std::promise<void> delivered;
+		asio::post(*m_io_context, [this, &delivered] () { deliver_pending(); delivered.set_value(); });
+		delivered.get_future().wait();
 		m_io_context->stop();
 		m_working_thread.join();
 		delete m_server;
@@ -219,23 +235,45 @@ public:
 
 	virtual void notify(const char *outname, int32_t value) override
 	{
-		static char buf[256];
-		sprintf(buf, "%s = %d\r", ((outname==nullptr) ? "none" : outname), value);
-		m_server->deliver_to_all(buf);
+		// coalesce changes until the network thread picks them up, so a burst
+		// of output changes goes out as a single write per client
+		std::lock_guard<std::mutex> lock(m_pending_mutex);
+		bool const idle = m_pending.empty();
+		m_pending += util::string_format("%s = %d\r", ((outname==nullptr) ? "none" : outname), value);
+		if (idle && m_io_context)
+			asio::post(*m_io_context, [this] () { deliver_pending(); });
 	}
 
 	// implementation
 	void process_output()
 	{
-		m_io_context = new asio::io_context();
-		m_server = new output_network_server(*m_io_context, 8000, machine());
+		{
+			std::lock_guard<std::mutex> lock(m_pending_mutex);
+			m_io_context = new asio::io_context();
+			m_server = new output_network_server(*m_io_context, 8000, machine());
+			if (!m_pending.empty())
+				asio::post(*m_io_context, [this] () { deliver_pending(); });
+		}
 		m_io_context->run();
 	}
 
+	void deliver_pending()
+	{
+		std::string batch;
+		{
+			std::lock_guard<std::mutex> lock(m_pending_mutex);
+			batch.swap(m_pending);
+		}
+		if (!batch.empty())
+			m_server->deliver_to_all(std::move(batch));
+	}
+
 private:
 	std::thread m_working_thread;
 	asio::io_context *m_io_context;
 	output_network_server *m_server;
+	std::mutex m_pending_mutex;
+	std::string m_pending;
 };
 
 MODULE_DEFINITION(OUTPUT_NETWORK, output_network)
@@ -13,6 +13,7 @@
 #include "emu.h"
 
 #include "drawnone.h"
+#include "modules/lib/osdobj_common.h"
 
 //============================================================
 //  drawnone_window_get_primitives
@@ -24,6 +25,10 @@ render_primitive_list *renderer_none::get_primitives()
 	if (win == nullptr)
 		return nullptr;
 
+	// nobody looks at the output while benchmarking, so don't compose it
+	if (downcast<osd_options &>(win->machine().options()).bench() > 0)
+		return nullptr;
+
 	RECT client;
 #if defined(OSD_WINDOWS)
 	GetClientRect(std::static_pointer_cast<win_window_info>(win)->platform_window(), &client);
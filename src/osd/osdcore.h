@@ -221,6 +221,30 @@ const char *osd_getenv(const char *name);
 int osd_getpid();
 
 
+/// \brief Description of a host logical processor
+struct osd_processor_info
+{
+	int logical;    ///< Logical processor number, as used for affinity.
+	int core;       ///< Identifies the physical core; SMT siblings share this.
+	int node;       ///< NUMA node the processor belongs to.
+};
+
+
+/// \brief Get host processor topology
+///
+/// \return One entry for each logical processor the process may run
+///   on, or an empty vector if the topology can't be determined.
+std::vector<osd_processor_info> osd_get_processor_topology();
+
+
+/// \brief Restrict the calling thread to a single logical processor
+///
+/// \param [in] logical Logical processor number from
+///   osd_get_processor_topology.
+/// \return True if the affinity was changed.
+bool osd_set_thread_affinity(int logical);
+
+
 /*-----------------------------------------------------------------------------
     osd_get_physical_drive_geometry: if the given path points to a physical
         drive, return the geometry of that drive
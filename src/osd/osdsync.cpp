@@ -21,6 +21,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 // MAME headers
 #include "osdcore.h"
 #include "osdsync.h"
@@ -43,9 +44,15 @@
 
 #define ENV_PROCESSORS               "OSDPROCESSORS"
 #define ENV_WORKQUEUEMAXTHREADS      "OSDWORKQUEUEMAXTHREADS"
+#define ENV_THREADAFFINITY           "OSDTHREADAFFINITY"
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
+#define WORK_INJECTOR_SIZE      4096    // capacity of the shared queue; must be a power of 2
+#define WORK_DEQUE_SIZE         256     // capacity of each thread's deque; must be a power of 2
+#define WORK_FREE_SIZE          1024    // capacity of the lock-free part of the free item pool; must be a power of 2
+#define CACHE_LINE_SIZE         64      // padding keeps the indices of the containers apart
+
 //============================================================
 //  MACROS
 //============================================================
@@ -100,6 +107,171 @@ int osd_get_num_processors()
 //  TYPE DEFINITIONS
 //============================================================
 
+struct osd_work_item;
+
+// bounded multi-producer/multi-consumer ring buffer; each cell carries a
+// sequence number that tells producers and consumers whose turn it is
+template<typename T, unsigned Size>
+class mpmc_ring
+{
+	static_assert((Size & (Size - 1)) == 0, "mpmc_ring size must be a power of 2");
+
+public:
+	mpmc_ring() : m_head(0), m_tail(0)
+	{
+		for (unsigned i = 0; i < Size; i++)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	// add a value; returns false if the ring is full
+	bool push(T value)
+	{
+		cell *c;
+		size_t pos = m_tail.load(std::memory_order_relaxed);
+		for ( ;; )
+		{
+			c = &m_cells[pos & (Size - 1)];
+			const size_t seq = c->sequence.load(std::memory_order_acquire);
+			const intptr_t diff = intptr_t(seq) - intptr_t(pos);
+			if (diff == 0)
+			{
+				if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				pos = m_tail.load(std::memory_order_relaxed);
+		}
+		c->value = value;
+		c->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// remove a value; returns false if the ring is empty
+	bool pop(T &value)
+	{
+		cell *c;
+		size_t pos = m_head.load(std::memory_order_relaxed);
+		for ( ;; )
+		{
+			c = &m_cells[pos & (Size - 1)];
+			const size_t seq = c->sequence.load(std::memory_order_acquire);
+			const intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+			if (diff == 0)
+			{
+				if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				pos = m_head.load(std::memory_order_relaxed);
+		}
+		value = c->value;
+		c->sequence.store(pos + Size, std::memory_order_release);
+		return true;
+	}
+
+	// may be stale by the time the caller looks at it
+	bool empty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+
+private:
+	struct cell
+	{
+		std::atomic<size_t> sequence;
+		T                   value;
+	};
+
+	// padding rather than alignas, so the containing structures can be
+	// allocated with plain new
+	cell                m_cells[Size];
+	char                m_pad0[CACHE_LINE_SIZE];
+	std::atomic<size_t> m_head;
+	char                m_pad1[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+	std::atomic<size_t> m_tail;
+	char                m_pad2[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+};
+
+
+// fixed-size Chase-Lev work-stealing deque; only the owning thread may
+// push or pop, any thread may steal from the other end
+template<unsigned Size>
+class work_deque
+{
+	static_assert((Size & (Size - 1)) == 0, "work_deque size must be a power of 2");
+
+public:
+	work_deque() : m_top(0), m_bottom(0)
+	{
+		for (auto &item : m_items)
+			item.store(nullptr, std::memory_order_relaxed);
+	}
+
+	// owner: add an item at the bottom; returns false if full
+	bool push(osd_work_item *item)
+	{
+		const int64_t b = m_bottom.load(std::memory_order_relaxed);
+		const int64_t t = m_top.load(std::memory_order_acquire);
+		if (b - t >= int64_t(Size))
+			return false;
+		m_items[b & (Size - 1)].store(item, std::memory_order_relaxed);
+		m_bottom.store(b + 1, std::memory_order_release);
+		return true;
+	}
+
+	// owner: take the most recently pushed item
+	osd_work_item *pop()
+	{
+		const int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = m_top.load(std::memory_order_relaxed);
+		osd_work_item *item = nullptr;
+		if (t <= b)
+		{
+			item = m_items[b & (Size - 1)].load(std::memory_order_relaxed);
+
+			// racing thieves for the last item
+			if (t == b)
+			{
+				if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					item = nullptr;
+				m_bottom.store(b + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+			m_bottom.store(b + 1, std::memory_order_relaxed);
+		return item;
+	}
+
+	// any thread: take the oldest item, or nullptr if empty or we lost a race
+	osd_work_item *steal()
+	{
+		int64_t t = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t b = m_bottom.load(std::memory_order_acquire);
+		if (t >= b)
+			return nullptr;
+		osd_work_item *const item = m_items[t & (Size - 1)].load(std::memory_order_relaxed);
+		if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return item;
+	}
+
+	// may be stale by the time the caller looks at it
+	bool empty() const { return m_bottom.load(std::memory_order_acquire) <= m_top.load(std::memory_order_acquire); }
+
+private:
+	char                                m_pad0[CACHE_LINE_SIZE];
+	std::atomic<int64_t>                m_top;
+	char                                m_pad1[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<int64_t>                m_bottom;
+	char                                m_pad2[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<osd_work_item *>        m_items[Size];
+};
+
+
 struct work_thread_info
 {
 	work_thread_info(uint32_t aid, osd_work_queue &aqueue)
@@ -108,6 +280,8 @@ struct work_thread_info
 	, wakeevent(false, false)  // auto-reset, not signalled
 	, active(0)
 	, id(aid)
+	, spinlimit(SPIN_LOOP_TIME)
+	, affinity(-1)
 #if KEEP_STATISTICS
 	, itemsdone(0)
 	, actruntime(0)
@@ -122,6 +296,9 @@ struct work_thread_info
 	osd_event           wakeevent;      // wake event for the thread
 	std::atomic<int32_t>  active;         // are we actively processing work?
 	uint32_t              id;
+	osd_ticks_t         spinlimit;      // how long to spin looking for work before sleeping
+	work_deque<WORK_DEQUE_SIZE> deque;  // items queued by work running on this thread; worker threads only
+	int                 affinity;       // logical processor to run on, or -1 to let the OS decide
 
 #if KEEP_STATISTICS
 	int32_t               itemsdone;
@@ -136,9 +313,7 @@ struct work_thread_info
 struct osd_work_queue
 {
 	osd_work_queue()
-	: list(nullptr)
-	, tailptr(nullptr)
-	, free(nullptr)
+	: freeoverflowcount(0)
 	, items(0)
 	, livethreads(0)
 	, waiting(0)
@@ -155,10 +330,12 @@ struct osd_work_queue
 	{
 	}
 
-	std::mutex          lock;           // lock for protecting the queue
-	std::atomic<osd_work_item *> list;  // list of items in the queue
-	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
-	std::atomic<osd_work_item *> free;  // free list of work items
+	std::mutex          lock;           // lock for protecting item completion events
+	mpmc_ring<osd_work_item *, WORK_INJECTOR_SIZE> injector;    // items queued from outside the worker threads
+	mpmc_ring<osd_work_item *, WORK_FREE_SIZE> freepool;        // released items available for reuse
+	std::mutex          freelock;       // lock for the free pool overflow
+	std::vector<osd_work_item *> freeoverflow;                  // released items that did not fit in the free pool
+	std::atomic<int32_t>  freeoverflowcount; // number of items in the overflow, checked before locking
 	std::atomic<int32_t>  items;          // items in the queue
 	std::atomic<int32_t>  livethreads;    // number of live threads
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
@@ -207,14 +384,28 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+// the worker this host thread is currently acting as, if any
+static thread_local work_thread_info *t_current_thread = nullptr;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
 static int effective_num_processors();
+static const std::vector<int> &worker_affinity_slots();
 static void * worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread);
+static void queue_inject_item(osd_work_queue *queue, osd_work_item *item);
+static void queue_wake_threads(osd_work_queue *queue, int32_t numitems);
+static bool spin_for_items(osd_work_queue *queue, osd_ticks_t timeout);
+static bool free_pool_pop(osd_work_queue *queue, osd_work_item *&item);
+static void free_pool_push(osd_work_queue *queue, osd_work_item *item);
+
+// the calling thread and the single-threaded fallback slot can be used by
+// several host threads at once, so only real workers own their deque
+static inline bool owns_deque(osd_work_queue *queue, work_thread_info *thread) { return thread->id < queue->threads; }
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -261,7 +452,6 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	queue = new osd_work_queue();
 
 	// initialize basic queue members
-	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
 
 	// determine how many threads to create...
@@ -296,6 +486,15 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
 		queue->thread.push_back(new work_thread_info(threadnum, *queue));
 
+	// spread multi queue workers across physical cores if requested
+	if (flags & WORK_QUEUE_FLAG_MULTI)
+	{
+		const std::vector<int> &slots = worker_affinity_slots();
+		if (!slots.empty())
+			for (threadnum = 0; threadnum < queue->threads; threadnum++)
+				queue->thread[threadnum]->affinity = slots[threadnum % slots.size()];
+	}
+
 	// iterate over threads
 	for (threadnum = 0; threadnum < queue->threads; threadnum++)
 	{
@@ -437,28 +636,31 @@ void osd_work_queue_free(osd_work_queue *queue)
 	}
 #endif
 
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
-	queue->thread.clear();
-
-	// free all items in the free list
-	while (queue->free.load() != nullptr)
+	// free all items in the free pool
+	osd_work_item *item;
+	while (free_pool_pop(queue, item))
 	{
-		auto *item = (osd_work_item *)queue->free;
-		queue->free = item->next;
 		delete item->event;
 		delete item;
 	}
 
-	// free all items in the active list
-	while (queue->list.load() != nullptr)
+	// free all items that were never taken
+	while (queue->injector.pop(item))
 	{
-		auto *item = (osd_work_item *)queue->list;
-		queue->list = item->next;
 		delete item->event;
 		delete item;
 	}
+	for (work_thread_info *thread : queue->thread)
+		while ((item = thread->deque.steal()) != nullptr)
+		{
+			delete item->event;
+			delete item;
+		}
+
+	// free the thread information
+	for (auto & th : queue->thread)
+		delete th;
+	queue->thread.clear();
 
 #if KEEP_STATISTICS
 	printf("Items queued   = %9d\n", queue->itemsqueued.load());
@@ -478,26 +680,25 @@ void osd_work_queue_free(osd_work_queue *queue)
 
 osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, uint32_t flags)
 {
-	osd_work_item *itemlist = nullptr, *lastitem = nullptr;
-	osd_work_item **item_tailptr = &itemlist;
+	osd_work_item *lastitem = nullptr;
 	int itemnum;
 
-	// loop over items, building up a local list of work
+	// work queued from one of our own worker threads goes on that thread's
+	// deque, where it can be taken back cheaply or stolen by idle threads;
+	// everything else goes through the shared queue
+	work_thread_info *const owner = (t_current_thread != nullptr && &t_current_thread->queue == queue && owns_deque(queue, t_current_thread)) ? t_current_thread : nullptr;
+
+	// count the items before anyone can see them, so waiters don't see zero early
+	queue->items += numitems;
+	add_to_stat(queue->itemsqueued, numitems);
+
+	// loop over items, publishing each one as soon as it's ready
 	for (itemnum = 0; itemnum < numitems; itemnum++)
 	{
 		osd_work_item *item;
 
-		// first allocate a new work item; try the free list first
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-			do
-			{
-				item = (osd_work_item *)queue->free;
-			} while (item != nullptr && !queue->free.compare_exchange_weak(item, item->next, std::memory_order_release, std::memory_order_relaxed));
-		}
-
-		// if nothing, allocate something new
-		if (item == nullptr)
+		// first allocate a new work item; try the free pool first
+		if (!free_pool_pop(queue, item))
 		{
 			// allocate the item
 			item = new osd_work_item(*queue);
@@ -518,44 +719,15 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 
 		// advance to the next
 		lastitem = item;
-		*item_tailptr = item;
-		item_tailptr = &item->next;
 		parambase = (uint8_t *)parambase + paramstep;
-	}
 
-	// enqueue the whole thing within the critical section
-	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
+		// hand it over
+		if (owner == nullptr || !owner->deque.push(item))
+			queue_inject_item(queue, item);
 	}
 
-	// increment the number of items in the queue
-	queue->items += numitems;
-	add_to_stat(queue->itemsqueued, numitems);
-
 	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
-	{
-		int threadnum;
-
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
-		{
-			work_thread_info *thread = queue->thread[threadnum];
-
-			// if this thread is not active, wake him up
-			if (!thread->active)
-			{
-				thread->wakeevent.set();
-				add_to_stat(queue->setevents, 1);
-
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
-			}
-		}
-	}
+	queue_wake_threads(queue, numitems);
 
 	// if no threads, run the queue now on this thread
 	if (queue->threads == 0)
@@ -620,18 +792,11 @@ void *osd_work_item_result(osd_work_item *item)
 
 void osd_work_item_release(osd_work_item *item)
 {
-	osd_work_item *next;
-
 	// make sure we're done first
 	osd_work_item_wait(item, 100 * osd_ticks_per_second());
 
-	// add us to the free list on our queue
-	std::lock_guard<std::mutex> lock(item->queue.lock);
-	do
-	{
-		next = (osd_work_item *) item->queue.free;
-		item->next = next;
-	} while (!item->queue.free.compare_exchange_weak(next, item, std::memory_order_release, std::memory_order_relaxed));
+	// add us to the free pool on our queue
+	free_pool_push(&item->queue, item);
 }
 
 
@@ -664,6 +829,59 @@ static int effective_num_processors()
 }
 
 
+//============================================================
+//  worker_affinity_slots
+//============================================================
+
+static const std::vector<int> &worker_affinity_slots()
+{
+	// computed once; the thread that first allocates a multi queue is
+	// treated as the main thread and keeps the first core to itself
+	static const std::vector<int> slots = [] ()
+	{
+		std::vector<int> result;
+
+		// placement is opt-in: "1" spreads across cores, "node" also
+		// prefers the main thread's NUMA node
+		const char *mode = osd_getenv(ENV_THREADAFFINITY);
+		if (mode == nullptr || (strcmp(mode, "1") != 0 && strcmp(mode, "node") != 0))
+			return result;
+		const bool prefer_node = (strcmp(mode, "node") == 0);
+
+		const std::vector<osd_processor_info> topology = osd_get_processor_topology();
+		if (topology.size() < 2 || !osd_set_thread_affinity(topology[0].logical))
+			return result;
+		const osd_processor_info &main = topology[0];
+
+		// one processor per distinct core first, then SMT siblings once
+		// distinct cores run out; the main thread's core counts as taken
+		std::vector<osd_processor_info> primary, siblings;
+		for (const osd_processor_info &info : topology)
+		{
+			if (info.logical == main.logical)
+				continue;
+			bool const seen = (info.core == main.core) || std::any_of(
+					primary.begin(),
+					primary.end(),
+					[&info] (const osd_processor_info &other) { return other.core == info.core; });
+			(seen ? siblings : primary).push_back(info);
+		}
+		if (prefer_node)
+		{
+			auto const local = [&main] (const osd_processor_info &info) { return info.node == main.node; };
+			std::stable_partition(primary.begin(), primary.end(), local);
+			std::stable_partition(siblings.begin(), siblings.end(), local);
+		}
+		for (const osd_processor_info &info : primary)
+			result.push_back(info.logical);
+		for (const osd_processor_info &info : siblings)
+			result.push_back(info.logical);
+		return result;
+	}();
+	return slots;
+}
+
+
 //============================================================
 //  worker_thread_entry
 //============================================================
@@ -673,6 +891,10 @@ static void *worker_thread_entry(void *param)
 	auto *thread = (work_thread_info *)param;
 	osd_work_queue &queue = thread->queue;
 
+	// pin to the processor picked when the queue was created
+	if (thread->affinity >= 0)
+		osd_set_thread_affinity(thread->affinity);
+
 	// loop until we exit
 	for ( ;; )
 	{
@@ -701,12 +923,16 @@ static void *worker_thread_entry(void *param)
 			// process as much as we can
 			worker_thread_process(&queue, thread);
 
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			// if we're a high frequency queue, spin for a while before giving up;
+			// spin longer next time if it paid off, and back off if it didn't
+			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && !queue_has_list_items(&queue))
 			{
 				// spin for a while looking for more work
 				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
+				if (spin_for_items(&queue, thread->spinlimit))
+					thread->spinlimit = std::min<osd_ticks_t>(thread->spinlimit * 2, SPIN_LOOP_TIME * 8);
+				else
+					thread->spinlimit = std::max<osd_ticks_t>(thread->spinlimit / 2, std::max<osd_ticks_t>(SPIN_LOOP_TIME / 8, 1));
 				end_timing(thread->spintime);
 			}
 
@@ -733,37 +959,18 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 {
 	int threadid = thread->id;
 
+	// anything queued by the callbacks goes on this thread's deque
+	work_thread_info *const prevthread = t_current_thread;
+	t_current_thread = thread;
+
 	begin_timing(thread->runtime);
 
 	// loop until everything is processed
 	while (true)
 	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
-
-		// use a critical section to synchronize the removal of items
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
-			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
-			}
-		}
-
-		if (end_loop)
+		// our own deque first, then the shared queue, then other threads' deques
+		osd_work_item *item = queue_take_item(queue, thread);
+		if (item == nullptr)
 			break;
 
 		// process non-NULL items
@@ -801,6 +1008,8 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 		}
 	}
 
+	t_current_thread = prevthread;
+
 	// we don't need to set the doneevent for multi queues because they spin
 	if (queue->waiting)
 	{
@@ -811,9 +1020,163 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 	end_timing(thread->runtime);
 }
 
+
+//============================================================
+//  queue_has_list_items
+//============================================================
+
 bool queue_has_list_items(osd_work_queue *queue)
 {
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
+	if (!queue->injector.empty())
+		return true;
+	for (work_thread_info *thread : queue->thread)
+		if (!thread->deque.empty())
+			return true;
+	return false;
+}
+
+
+//============================================================
+//  queue_take_item
+//============================================================
+
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread)
+{
+	// most recent item of our own, which is likely to be warm in cache
+	osd_work_item *item;
+	if (owns_deque(queue, thread))
+	{
+		item = thread->deque.pop();
+		if (item != nullptr)
+			return item;
+	}
+
+	// then anything queued from outside
+	if (queue->injector.pop(item))
+		return item;
+
+	// finally try stealing, starting with our neighbour to spread contention
+	const size_t count = queue->thread.size();
+	for (size_t offset = 1; offset < count; offset++)
+	{
+		work_thread_info *const victim = queue->thread[(thread->id + offset) % count];
+		while (!victim->deque.empty())
+		{
+			item = victim->deque.steal();
+			if (item != nullptr)
+				return item;
+		}
+	}
+	return nullptr;
+}
+
+
+//============================================================
+//  queue_inject_item
+//============================================================
+
+static void queue_inject_item(osd_work_queue *queue, osd_work_item *item)
+{
+	// if the shared queue is full, get it drained rather than fail
+	while (!queue->injector.push(item))
+	{
+		if (queue->threads == 0)
+		{
+			worker_thread_process(queue, queue->thread[0]);
+		}
+		else
+		{
+			queue_wake_threads(queue, queue->threads);
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+//============================================================
+//  queue_wake_threads
+//============================================================
+
+static void queue_wake_threads(osd_work_queue *queue, int32_t numitems)
+{
+	if (queue->livethreads < queue->threads)
+	{
+		int threadnum;
+
+		// iterate over all the threads
+		for (threadnum = 0; threadnum < queue->threads; threadnum++)
+		{
+			work_thread_info *thread = queue->thread[threadnum];
+
+			// if this thread is not active, wake him up
+			if (!thread->active)
+			{
+				thread->wakeevent.set();
+				add_to_stat(queue->setevents, 1);
+
+				// for non-shared, the first one we find is good enough
+				if (--numitems == 0)
+					break;
+			}
+		}
+	}
+}
+
+
+//============================================================
+//  spin_for_items
+//============================================================
+
+static bool spin_for_items(osd_work_queue *queue, osd_ticks_t timeout)
+{
+	osd_ticks_t stopspin = osd_ticks() + timeout;
+
+	do {
+		int spin = 1000;
+		while (--spin)
+		{
+			if (queue_has_list_items(queue))
+				return true;
+		}
+	} while (osd_ticks() < stopspin);
+	return false;
+}
+
+
+//============================================================
+//  free_pool_pop
+//============================================================
+
+static bool free_pool_pop(osd_work_queue *queue, osd_work_item *&item)
+{
+	if (queue->freepool.pop(item))
+		return true;
+
+	// only take the lock if a burst has spilled items into the overflow
+	if (queue->freeoverflowcount == 0)
+		return false;
+
+	std::lock_guard<std::mutex> lock(queue->freelock);
+	if (queue->freeoverflow.empty())
+		return false;
+	item = queue->freeoverflow.back();
+	queue->freeoverflow.pop_back();
+	--queue->freeoverflowcount;
+	return true;
+}
+
+
+//============================================================
+//  free_pool_push
+//============================================================
+
+static void free_pool_push(osd_work_queue *queue, osd_work_item *item)
+{
+	if (queue->freepool.push(item))
+		return;
+
+	// the pool grows to fit the largest burst rather than freeing items
+	std::lock_guard<std::mutex> lock(queue->freelock);
+	queue->freeoverflow.push_back(item);
+	++queue->freeoverflowcount;
 }
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <cassert>
 #include <cstring>
+#include <future>
 #include <limits>
 #include <memory>
 #include <new>
@@ -1562,25 +1563,35 @@ static void do_verify(parameters_t &params)
 	if (raw_sha1 == util::sha1_t::null)
 		report_error(0, "No verification to be done; CHD has no checksum");
 
-	// create an array to read into
-	std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
+	// create a pair of arrays to read into, so one can be hashed while the next is decompressed
+	std::vector<uint8_t> buffer[2];
+	buffer[0].resize((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
+	buffer[1].resize(buffer[0].size());
 
 	// read all the data and build up an SHA-1
 	util::sha1_creator rawsha1;
+	std::future<void> hashing;
+	int curbuf = 0;
 	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
 	{
 		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
 
 		// determine how much to read
-		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_chd.logical_bytes() - offset);
-		chd_error err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
+		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer[curbuf].size(), input_chd.logical_bytes() - offset);
+		chd_error err = input_chd.read_bytes(offset, &buffer[curbuf][0], bytes_to_read);
 		if (err != CHDERR_NONE)
 			report_error(1, "Error reading CHD file (%s): %s", params.find(OPTION_INPUT)->second->c_str(), chd_file::error_string(err));
 
-		// add to the checksum
-		rawsha1.append(&buffer[0], bytes_to_read);
+		// add to the checksum once the previous block is done
+		if (hashing.valid())
+			hashing.get();
+		uint8_t const *const data = &buffer[curbuf][0];
+		hashing = std::async(std::launch::async, [&rawsha1, data, bytes_to_read] () { rawsha1.append(data, bytes_to_read); });
 		offset += bytes_to_read;
+		curbuf ^= 1;
 	}
+	if (hashing.valid())
+		hashing.get();
 	util::sha1_t computed_sha1 = rawsha1.finish();
 
 	// finish up
@@ -0,0 +1,35 @@
+#include "catch.hpp"
+
+#include "emu.h"
+#include "cpu/drcuml.h"
+
+TEST_CASE("dataflow propagates a constant through same-size moves", "[emu]")
+{
+	uml::instruction inst[2];
+	inst[0].dmov(uml::I0, u64(0x123456789abcdef0U));
+	inst[1].dadd(uml::I1, uml::I0, 1);
+
+	drcuml_block::optimize_dataflow(inst, 2);
+
+	REQUIRE(inst[1].opcode() == uml::OP_MOV);
+	REQUIRE(inst[1].param(1).is_immediate_value(0x123456789abcdef1U));
+}
+
+TEST_CASE("dataflow does not widen a constant through a 4-byte move", "[emu]")
+{
+	uml::instruction inst[4];
+	inst[0].dmov(uml::I0, u64(0x123456789abcdef0U));
+	inst[1].mov(uml::I1, uml::I0);
+	inst[2].dadd(uml::I2, uml::I1, 1);
+	inst[3].add(uml::I3, uml::I1, 1);
+
+	drcuml_block::optimize_dataflow(inst, 4);
+
+	// the upper half of I1 is not known after a 4-byte move
+	REQUIRE(inst[2].opcode() == uml::OP_ADD);
+	REQUIRE(inst[2].param(1).is_int_register());
+
+	// 4-byte users see the truncated value
+	REQUIRE(inst[3].opcode() == uml::OP_MOV);
+	REQUIRE(inst[3].param(1).is_immediate_value(0x9abcdef1U));
+}